@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/direction.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+//==============================================================================
+// Rotation of a bank of isotropic directions, with a number of directions
+// given by the benchmark argument. The scattering cosines are pre-sampled,
+// and the azimuthal angles are sampled from an RNGStream, as they would be
+// after sampling a secondary distribution.
+struct Bank {
+  std::vector<double> x, y, z, mu;
+};
+
+Bank isotropic_bank(const benchmark::State& state) {
+  const std::size_t N = static_cast<std::size_t>(state.range(0));
+  RNGStream rng(21);
+  Bank b;
+  for (std::size_t i = 0; i < N; i++) {
+    const double mu = 2. * rng() - 1.;
+    const double phi = 2. * std::numbers::pi * rng();
+    const double s = std::sqrt(1. - mu * mu);
+    b.x.push_back(s * std::cos(phi));
+    b.y.push_back(s * std::sin(phi));
+    b.z.push_back(mu);
+    b.mu.push_back(2. * rng() - 1.);
+  }
+  return b;
+}
+
+void BM_RotateScalar(benchmark::State& state) {
+  Bank b = isotropic_bank(state);
+  RNGStream rng;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < b.x.size(); i++) {
+      const Direction u =
+          Direction{b.x[i], b.y[i], b.z[i]}.rotate(b.mu[i], rng);
+      b.x[i] = u.x;
+      b.y[i] = u.y;
+      b.z[i] = u.z;
+    }
+    benchmark::DoNotOptimize(b.x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_RotateBatch(benchmark::State& state) {
+  Bank b = isotropic_bank(state);
+  RNGStream rng;
+  for (auto _ : state) {
+    Direction::rotate(b.x, b.y, b.z, b.mu, rng);
+    benchmark::DoNotOptimize(b.x.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_RotateScalar)->Arg(64)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_RotateBatch)->Arg(64)->Arg(1024)->Arg(16384);
+
+}  // namespace
+}  // namespace pndl
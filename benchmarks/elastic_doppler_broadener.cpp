@@ -0,0 +1,221 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/cross_section.hpp>
+#include <PapillonNDL/elastic_dbrc.hpp>
+#include <PapillonNDL/elastic_rvs.hpp>
+#include <PapillonNDL/elastic_svt.hpp>
+#include <PapillonNDL/energy_grid.hpp>
+#include <PapillonNDL/rng.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+// Boltzmann constant in MeV / K
+constexpr double K_BOLTZMANN = 8.617333262E-11;
+
+// Atomic weight ratio of U238
+constexpr double AWR_U238 = 236.0058;
+
+//==============================================================================
+// Synthetic 0 Kelvin elastic cross section. This consists of a constant
+// potential scattering cross section, with a series of narrow Breit-Wigner
+// like resonances, loosely modeled on the low lying s-wave resonances of
+// U238. The grid is dense enough that the DBRC majorant window covers
+// hundreds to thousands of points at the resonances.
+CrossSection make_resonant_xs() {
+  constexpr std::size_t NE = 200000;
+  constexpr double Emin = 1.E-11;
+  constexpr double Emax = 20.;
+  const double du = std::log(Emax / Emin) / static_cast<double>(NE - 1);
+
+  // Resonance energies (MeV), total widths (MeV), and peak heights (b)
+  const std::array<double, 6> Er{6.674E-6,  20.87E-6, 36.68E-6,
+                                 66.03E-6, 80.75E-6, 102.5E-6};
+  const std::array<double, 6> G{25.E-9, 33.E-9, 57.E-9, 48.E-9, 25.E-9, 95.E-9};
+  const std::array<double, 6> H{2.2E4, 3.E4, 3.E4, 1.5E4, 4.E3, 1.2E4};
+
+  std::vector<double> energy(NE, 0.);
+  std::vector<double> xs(NE, 0.);
+  for (std::size_t i = 0; i < NE; i++) {
+    energy[i] = Emin * std::exp(du * static_cast<double>(i));
+    if (i == NE - 1) energy[i] = Emax;
+
+    xs[i] = 9.;
+    for (std::size_t r = 0; r < Er.size(); r++) {
+      const double x = 2. * (energy[i] - Er[r]) / G[r];
+      xs[i] += H[r] / (1. + x * x);
+    }
+  }
+
+  auto egrid = std::make_shared<EnergyGrid>(energy);
+  return CrossSection(xs, egrid, 0);
+}
+
+const CrossSection& resonant_xs() {
+  static const CrossSection xs = make_resonant_xs();
+  return xs;
+}
+
+//==============================================================================
+// Reference implementation of DBRC, which finds the majorant with a linear
+// scan over all grid points in the relative energy window, and bisection
+// searches for the window end points. This was the original implementation
+// in ElasticDBRC, and is kept here to measure the cost of the majorant search.
+class LinearScanDBRC : public ElasticDopplerBroadener {
+ public:
+  LinearScanDBRC(const CrossSection& xs) : xs_(xs) {}
+
+  std::array<double, 3> sample_target_velocity(
+      const double& Ein, const double& kT, const double& awr,
+      const std::function<double()>& rng) const override final {
+    const static ElasticSVT svt;
+
+    const double vn = std::sqrt(Ein);
+    const double y = std::sqrt(awr * Ein / kT);
+    const double y_min = std::max(0., y - 4.);
+    const double Er_min = y_min * y_min * kT / awr;
+    const double y_max = y + 4.;
+    const double Er_max = y_max * y_max * kT / awr;
+    const double xs_max = this->max_xs_value(Er_min, Er_max);
+
+    while (true) {
+      const std::array<double, 3> vt =
+          svt.sample_target_velocity(Ein, kT, awr, rng);
+      const double dz = vn - vt[2];
+      const double Er = vt[0] * vt[0] + vt[1] * vt[1] + dz * dz;
+
+      if (Er < Er_min || Er > Er_max) continue;
+
+      const std::size_t i_Er = xs_.energy_grid().get_lower_index(Er);
+      if (rng() * xs_max < xs_(Er, i_Er)) return vt;
+    }
+  }
+
+  std::string algorithm() const override final { return "DBRC"; }
+
+ private:
+  CrossSection xs_;
+
+  double max_xs_value(const double& Emin, const double& Emax) const {
+    const std::size_t i_min = xs_.energy_grid().get_lower_index(Emin);
+    const std::size_t i_max = xs_.energy_grid().get_lower_index(Emax);
+    double xs_max = std::max(xs_(Emin), xs_(Emax));
+
+    for (std::size_t i = i_min + 1; i <= i_max; i++) {
+      if (xs_.xs()[i] > xs_max) xs_max = xs_.xs()[i];
+    }
+
+    return xs_max;
+  }
+};
+
+//==============================================================================
+// Benchmark arguments are the incident energy in meV, and the temperature
+// in Kelvin.
+void dbrc_args(benchmark::internal::Benchmark* b) {
+  b->Args({6600, 293});
+  b->Args({6600, 1200});
+  b->Args({36000, 1200});
+  b->Args({150000, 1200});
+}
+
+template <class Broadener>
+void BM_SampleTargetVelocity(benchmark::State& state) {
+  const Broadener broadener(resonant_xs());
+  const double Ein = static_cast<double>(state.range(0)) * 1.E-9;
+  const double kT = static_cast<double>(state.range(1)) * K_BOLTZMANN;
+  const std::function<double()> rng_func = rng;
+  rng_reset();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        broadener.sample_target_velocity(Ein, kT, AWR_U238, rng_func));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocity, LinearScanDBRC)->Apply(dbrc_args);
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocity, ElasticDBRC)->Apply(dbrc_args);
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocity, ElasticRVS)->Apply(dbrc_args);
+
+void BM_SampleTargetVelocitySVT(benchmark::State& state) {
+  const ElasticSVT svt;
+  const double Ein = static_cast<double>(state.range(0)) * 1.E-9;
+  const double kT = static_cast<double>(state.range(1)) * K_BOLTZMANN;
+  const std::function<double()> rng_func = rng;
+  rng_reset();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        svt.sample_target_velocity(Ein, kT, AWR_U238, rng_func));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SampleTargetVelocitySVT)->Apply(dbrc_args);
+
+//==============================================================================
+// Batched sampling of target velocities. The batch is a queue of 4096
+// neutrons, all at the same incident energy. The scalar loop is the reference
+// implementation from ElasticDopplerBroadener.
+constexpr std::size_t BATCH_SIZE = 4096;
+
+template <class Broadener>
+void BM_SampleTargetVelocitiesScalar(benchmark::State& state) {
+  const Broadener broadener(resonant_xs());
+  const double kT = static_cast<double>(state.range(1)) * K_BOLTZMANN;
+  const std::vector<double> Ein(BATCH_SIZE,
+                                static_cast<double>(state.range(0)) * 1.E-9);
+  std::vector<std::array<double, 3>> vt(BATCH_SIZE);
+  const std::function<double()> rng_func = rng;
+  rng_reset();
+
+  for (auto _ : state) {
+    broadener.ElasticDopplerBroadener::sample_target_velocities(
+        Ein, kT, AWR_U238, rng_func, vt);
+    benchmark::DoNotOptimize(vt.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+template <class Broadener>
+void BM_SampleTargetVelocitiesBatch(benchmark::State& state) {
+  const Broadener broadener(resonant_xs());
+  const double kT = static_cast<double>(state.range(1)) * K_BOLTZMANN;
+  const std::vector<double> Ein(BATCH_SIZE,
+                                static_cast<double>(state.range(0)) * 1.E-9);
+  std::vector<std::array<double, 3>> vt(BATCH_SIZE);
+  const std::function<double()> rng_func = rng;
+  rng_reset();
+
+  for (auto _ : state) {
+    broadener.sample_target_velocities(Ein, kT, AWR_U238, rng_func, vt);
+    benchmark::DoNotOptimize(vt.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+// ElasticSVT has no cross section, so it gets a small wrapper with the same
+// constructor as the other broadeners.
+struct SVT : public ElasticSVT {
+  SVT(const CrossSection&) : ElasticSVT() {}
+};
+
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocitiesScalar, SVT)->Apply(dbrc_args);
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocitiesBatch, SVT)->Apply(dbrc_args);
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocitiesScalar, ElasticDBRC)
+    ->Apply(dbrc_args);
+BENCHMARK_TEMPLATE(BM_SampleTargetVelocitiesBatch, ElasticDBRC)
+    ->Apply(dbrc_args);
+
+}  // namespace
+}  // namespace pndl
@@ -0,0 +1,170 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/energy_grid.hpp>
+#include <PapillonNDL/fission.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../tests/common/fissile_ace.hpp"
+
+namespace pndl {
+namespace {
+
+using namespace synthetic;
+
+//==============================================================================
+// The synthetic fissile nuclide of fissile_ace.hpp, with an energy grid of
+// the size of a typical actinide evaluation.
+constexpr std::size_t NES = 10000;
+constexpr std::size_t NX = 4096;
+
+struct FissionData {
+  std::shared_ptr<EnergyGrid> grid;
+  std::shared_ptr<Fission> fission;
+};
+
+const FissionData& fission_data() {
+  static const FissionData data = [] {
+    const ACE ace = fissile_ace(NES);
+    auto grid = std::make_shared<EnergyGrid>(ace);
+    auto fission = std::make_shared<Fission>(ace, grid);
+    fission->map_energy_grid(*grid);
+    return FissionData{grid, fission};
+  }();
+  return data;
+}
+
+// Incident energies which are uniform in lethargy
+std::vector<double> energies() {
+  RNGStream stream(19);
+  std::vector<double> E(NX, 0.);
+  for (auto& e : E) e = 1.E-11 * std::pow(2.E12, stream());
+  return E;
+}
+
+// Selects the delayed family by evaluating the probability of each family,
+// and scanning their partial sums for the first which exceeds xi times the
+// sum of all of them.
+std::size_t select_family_direct(const Fission& fission, double E_in,
+                                 double xi) {
+  const std::size_t NG = fission.n_delayed_families();
+  double P = 0.;
+  for (std::size_t g = 0; g < NG; g++)
+    P += fission.delayed_family(g).probability()(E_in);
+
+  const double xi_P = xi * P;
+  double sum = 0.;
+  std::size_t g = 0;
+  for (; g + 1 < NG; g++) {
+    sum += fission.delayed_family(g).probability()(E_in);
+    if (xi_P < sum) break;
+  }
+  return g;
+}
+
+//==============================================================================
+// Each iteration selects the delayed family for a random incident energy.
+void BM_SelectDelayedFamilyDirect(benchmark::State& state) {
+  const Fission& fission = *fission_data().fission;
+  const std::vector<double> E = energies();
+  RNGStream rng(19);
+  std::size_t j = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(select_family_direct(fission, E[j], rng()));
+    j = (j + 1) % NX;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SelectDelayedFamily(benchmark::State& state) {
+  const Fission& fission = *fission_data().fission;
+  const std::vector<double> E = energies();
+  RNGStream rng(19);
+  std::size_t j = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(fission.select_delayed_family(E[j], rng()));
+    j = (j + 1) % NX;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SelectDelayedFamilyDirect);
+BENCHMARK(BM_SelectDelayedFamily);
+
+//==============================================================================
+// Each iteration samples the neutrons of a number of fission events, given by
+// the benchmark argument, at a single incident energy. The reference samples
+// each neutron separately through the generic interfaces, evaluating nu from
+// the original functions and searching the incident energy grids of all of
+// the spectra.
+void BM_FissionNeutronsReference(benchmark::State& state) {
+  const Fission& fission = *fission_data().fission;
+  const std::vector<double> E = energies();
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  std::vector<FissionNeutron> neutrons;
+  RNGStream rng(19);
+  std::size_t j = 0;
+  int64_t count = 0;
+
+  for (auto _ : state) {
+    const double E_in = E[j];
+    neutrons.clear();
+    for (std::size_t e = 0; e < n; e++) {
+      const double nu_t = fission.nu_total()(E_in);
+      const std::size_t N = static_cast<std::size_t>(nu_t + rng());
+      for (std::size_t k = 0; k < N; k++) {
+        FissionNeutron neutron{0., 0., 0};
+        if (rng() * nu_t < fission.nu_delayed()(E_in)) {
+          const std::size_t g = select_family_direct(fission, E_in, rng());
+          neutron.cosine_angle = 2. * rng() - 1.;
+          neutron.energy = fission.delayed_family(g).sample_energy(E_in, rng);
+          neutron.family = static_cast<uint32_t>(g + 1);
+        } else {
+          const AngleEnergyPacket out =
+              fission.prompt_spectrum().sample_angle_energy(E_in, rng);
+          neutron.cosine_angle = out.cosine_angle;
+          neutron.energy = out.energy;
+        }
+        neutrons.push_back(neutron);
+      }
+    }
+    benchmark::DoNotOptimize(neutrons.data());
+    count += static_cast<int64_t>(neutrons.size());
+    j = (j + 1) % NX;
+  }
+
+  state.SetItemsProcessed(count);
+}
+
+void BM_SampleFissionNeutrons(benchmark::State& state) {
+  const FissionData& data = fission_data();
+  const std::vector<double> E = energies();
+  std::vector<std::size_t> indices(NX, 0);
+  for (std::size_t j = 0; j < NX; j++)
+    indices[j] = data.grid->get_lower_index(E[j]);
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  std::vector<FissionNeutron> neutrons;
+  RNGStream rng(19);
+  std::size_t j = 0;
+  int64_t count = 0;
+
+  for (auto _ : state) {
+    neutrons.clear();
+    count += static_cast<int64_t>(data.fission->sample_fission_neutrons(
+        E[j], indices[j], n, rng, neutrons));
+    benchmark::DoNotOptimize(neutrons.data());
+    j = (j + 1) % NX;
+  }
+
+  state.SetItemsProcessed(count);
+}
+
+BENCHMARK(BM_FissionNeutronsReference)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK(BM_SampleFissionNeutrons)->Arg(1)->Arg(8)->Arg(64);
+
+}  // namespace
+}  // namespace pndl
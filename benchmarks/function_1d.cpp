@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
+#include <PapillonNDL/linearize.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/tabulated_1d.hpp>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../tests/common/linearize_reference.hpp"
+
+namespace pndl {
+namespace {
+
+//==============================================================================
+// All functions are tabulated on a logarithmic grid from 1.E-11 to 20 MeV,
+// with a number of points given by the benchmark argument. Each benchmark
+// evaluates the function at a pre-generated list of energies, which are
+// uniform in lethargy, so that only the cost of the evaluation is measured.
+constexpr std::size_t NX = 4096;
+
+std::vector<double> grid(std::size_t N) {
+  std::vector<double> x(N, 0.);
+  for (std::size_t i = 0; i < N; i++) {
+    const double f = static_cast<double>(i) / static_cast<double>(N - 1);
+    x[i] = 1.E-11 * std::pow(2.E12, f);
+  }
+  return x;
+}
+
+std::vector<double> values(const std::vector<double>& x) {
+  std::vector<double> y(x.size(), 0.);
+  for (std::size_t i = 0; i < x.size(); i++)
+    y[i] = 2.4 + 0.1 * std::log(x[i] + 1.);
+  return y;
+}
+
+// A single LinLin region
+Tabulated1D linlin(const benchmark::State& state) {
+  const std::vector<double> x = grid(static_cast<std::size_t>(state.range(0)));
+  return Tabulated1D(Interpolation::LinLin, x, values(x));
+}
+
+// Three regions, as are found in some yields and nu-bar tables
+Tabulated1D regions(const benchmark::State& state) {
+  const std::vector<double> x = grid(static_cast<std::size_t>(state.range(0)));
+  const uint32_t N = static_cast<uint32_t>(x.size());
+  return Tabulated1D(
+      {N / 3, 2 * N / 3, N},
+      {Interpolation::LinLin, Interpolation::LogLog, Interpolation::LinLin},
+      x, values(x));
+}
+
+std::vector<double> energies() {
+  RNGStream stream(19);
+  std::vector<double> E(NX, 0.);
+  for (auto& e : E) e = 1.E-11 * std::pow(2.E12, stream());
+  return E;
+}
+
+void args(benchmark::internal::Benchmark* b) {
+  for (const int64_t N : {8, 64, 512, 4096}) b->Arg(N);
+}
+
+template <class Function>
+void evaluate(benchmark::State& state, const Function& function) {
+  const std::vector<double> E = energies();
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(function(E[i]));
+    i = (i + 1) % NX;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Tabulated1DLinLin(benchmark::State& state) {
+  evaluate(state, linlin(state));
+}
+
+void BM_CompiledTabulated1DLinLin(benchmark::State& state) {
+  evaluate(state, CompiledTabulated1D(linlin(state)));
+}
+
+void BM_Tabulated1DRegions(benchmark::State& state) {
+  evaluate(state, regions(state));
+}
+
+void BM_CompiledTabulated1DRegions(benchmark::State& state) {
+  evaluate(state, CompiledTabulated1D(regions(state)));
+}
+
+BENCHMARK(BM_Tabulated1DLinLin)->Apply(args);
+BENCHMARK(BM_CompiledTabulated1DLinLin)->Apply(args);
+BENCHMARK(BM_Tabulated1DRegions)->Apply(args);
+BENCHMARK(BM_CompiledTabulated1DRegions)->Apply(args);
+
+//==============================================================================
+// Linearization of a Maxwellian spectrum to a tolerance of 10^-8, which gives
+// over 10^5 points. The initial grid has a number of points given by the
+// benchmark argument, as when a tabulated function is linearized. The
+// reference is the previous implementation, which inserts each mid-point in
+// place, and so must move all of the following initial points.
+using synthetic::maxwellian;
+
+Tabulated1D linearize_insert(std::vector<double> x, std::vector<double> y,
+                             const std::function<double(double)>& f,
+                             double tolerance) {
+  synthetic::linearize_reference(x, y, f, tolerance);
+  return Tabulated1D(Interpolation::LinLin, x, y);
+}
+
+template <class Linearize>
+void linearize_maxwellian(benchmark::State& state, Linearize linearize_fn) {
+  const std::vector<double> x = grid(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> y(x.size(), 0.);
+  for (std::size_t i = 0; i < x.size(); i++) y[i] = maxwellian(x[i]);
+
+  std::size_t points = 0;
+  for (auto _ : state) {
+    const Tabulated1D lin = linearize_fn(x, y, maxwellian, 1.E-8);
+    points = lin.x().size();
+    benchmark::DoNotOptimize(points);
+  }
+  state.counters["points"] = static_cast<double>(points);
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points));
+}
+
+void BM_Linearize(benchmark::State& state) {
+  linearize_maxwellian(state, [](const std::vector<double>& x,
+                                 const std::vector<double>& y, auto f,
+                                 double tolerance) {
+    return linearize(x, y, f, tolerance);
+  });
+}
+
+void BM_LinearizeInsert(benchmark::State& state) {
+  linearize_maxwellian(state, linearize_insert);
+}
+
+BENCHMARK(BM_Linearize)
+    ->Arg(2)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LinearizeInsert)
+    ->Arg(2)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace pndl
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/interpolation.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+//==============================================================================
+// Each kernel is applied to a batch of random intervals, with the size of the
+// batch given by the benchmark argument. The scalar benchmarks call the
+// scalar method in a loop, through an Interpolator, as is done by the
+// interpolation regions of Tabulated1D. The batch benchmarks dispatch once
+// for the entire batch.
+struct Batch {
+  std::vector<double> x, x1, y1, x2, y2, y, x_low, x_hi, out;
+};
+
+Batch random_batch(const benchmark::State& state) {
+  const std::size_t N = static_cast<std::size_t>(state.range(0));
+  Batch b;
+  RNGStream rng(7);
+  for (std::size_t i = 0; i < N; i++) {
+    const double x1 = 0.1 + 10. * rng();
+    const double x2 = x1 * (1.001 + 3. * rng());
+    const double y1 = 0.1 + 5. * rng();
+    const double y2 = 0.1 + 5. * rng();
+    const double f = rng();
+    b.x1.push_back(x1);
+    b.x2.push_back(x2);
+    b.y1.push_back(y1);
+    b.y2.push_back(y2);
+    b.x.push_back(x1 + f * (x2 - x1));
+    b.y.push_back(y1 + f * (y2 - y1));
+    b.x_low.push_back(x1 + 0.5 * f * (x2 - x1));
+    b.x_hi.push_back(x2 - 0.25 * f * (x2 - x1));
+  }
+  b.out.resize(N, 0.);
+  return b;
+}
+
+template <Interpolation RULE>
+void BM_InterpolateScalar(benchmark::State& state) {
+  Batch b = random_batch(state);
+  const Interpolator interp(RULE);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < b.out.size(); i++)
+      b.out[i] = interp.interpolate(b.x[i], b.x1[i], b.y1[i], b.x2[i], b.y2[i]);
+    benchmark::DoNotOptimize(b.out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Interpolation RULE>
+void BM_InterpolateBatch(benchmark::State& state) {
+  Batch b = random_batch(state);
+  const Interpolator interp(RULE);
+  for (auto _ : state) {
+    interp.interpolate(b.x, b.x1, b.y1, b.x2, b.y2, b.out);
+    benchmark::DoNotOptimize(b.out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Interpolation RULE>
+void BM_InvertScalar(benchmark::State& state) {
+  Batch b = random_batch(state);
+  const Interpolator interp(RULE);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < b.out.size(); i++)
+      b.out[i] = interp.invert(b.y[i], b.x1[i], b.y1[i], b.x2[i], b.y2[i]);
+    benchmark::DoNotOptimize(b.out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Interpolation RULE>
+void BM_InvertBatch(benchmark::State& state) {
+  Batch b = random_batch(state);
+  const Interpolator interp(RULE);
+  for (auto _ : state) {
+    interp.invert(b.y, b.x1, b.y1, b.x2, b.y2, b.out);
+    benchmark::DoNotOptimize(b.out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Interpolation RULE>
+void BM_IntegrateScalar(benchmark::State& state) {
+  Batch b = random_batch(state);
+  const Interpolator interp(RULE);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < b.out.size(); i++)
+      b.out[i] = interp.integrate(b.x_low[i], b.x_hi[i], b.x1[i], b.y1[i],
+                                  b.x2[i], b.y2[i]);
+    benchmark::DoNotOptimize(b.out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <Interpolation RULE>
+void BM_IntegrateBatch(benchmark::State& state) {
+  Batch b = random_batch(state);
+  const Interpolator interp(RULE);
+  for (auto _ : state) {
+    interp.integrate(b.x_low, b.x_hi, b.x1, b.y1, b.x2, b.y2, b.out);
+    benchmark::DoNotOptimize(b.out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define PNDL_INTERPOLATION_BENCHMARKS(RULE)                             \
+  BENCHMARK_TEMPLATE(BM_InterpolateScalar, Interpolation::RULE)->Arg(1024); \
+  BENCHMARK_TEMPLATE(BM_InterpolateBatch, Interpolation::RULE)->Arg(1024);  \
+  BENCHMARK_TEMPLATE(BM_InvertScalar, Interpolation::RULE)->Arg(1024);      \
+  BENCHMARK_TEMPLATE(BM_InvertBatch, Interpolation::RULE)->Arg(1024);       \
+  BENCHMARK_TEMPLATE(BM_IntegrateScalar, Interpolation::RULE)->Arg(1024);   \
+  BENCHMARK_TEMPLATE(BM_IntegrateBatch, Interpolation::RULE)->Arg(1024);
+
+PNDL_INTERPOLATION_BENCHMARKS(Histogram)
+PNDL_INTERPOLATION_BENCHMARKS(LinLin)
+PNDL_INTERPOLATION_BENCHMARKS(LinLog)
+PNDL_INTERPOLATION_BENCHMARKS(LogLin)
+PNDL_INTERPOLATION_BENCHMARKS(LogLog)
+
+}  // namespace
+}  // namespace pndl
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/rng.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <cstdint>
+#include <functional>
+#include <random>
+
+namespace pndl {
+namespace {
+
+// The generator which was originally used by rng
+using LCG = std::linear_congruential_engine<uint64_t, 2806196910506780709ULL, 1,
+                                            0x8000000000000000>;
+
+constexpr std::size_t NDRAWS = 1024;
+
+//==============================================================================
+// Generation throughput. The multi-threaded benchmarks give each thread its
+// own stream, split from a common stream.
+void BM_LCGReference(benchmark::State& state) {
+  LCG lcg;
+  std::uniform_real_distribution<double> unit_dist;
+
+  for (auto _ : state) {
+    double sum = 0.;
+    for (std::size_t i = 0; i < NDRAWS; i++) sum += unit_dist(lcg);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * NDRAWS);
+}
+BENCHMARK(BM_LCGReference);
+
+void BM_RNGStream(benchmark::State& state) {
+  RNGStream stream =
+      RNGStream().split(static_cast<std::uint64_t>(state.thread_index()));
+
+  for (auto _ : state) {
+    double sum = 0.;
+    for (std::size_t i = 0; i < NDRAWS; i++) sum += stream();
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * NDRAWS);
+}
+BENCHMARK(BM_RNGStream)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_ThreadLocalRNG(benchmark::State& state) {
+  rng_reset();
+
+  for (auto _ : state) {
+    double sum = 0.;
+    for (std::size_t i = 0; i < NDRAWS; i++) sum += rng();
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * NDRAWS);
+}
+BENCHMARK(BM_ThreadLocalRNG)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_StdFunctionRNG(benchmark::State& state) {
+  rng_reset();
+  const std::function<double()> rng_func = rng;
+
+  for (auto _ : state) {
+    double sum = 0.;
+    for (std::size_t i = 0; i < NDRAWS; i++) sum += rng_func();
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * NDRAWS);
+}
+BENCHMARK(BM_StdFunctionRNG)->ThreadRange(1, 8)->UseRealTime();
+
+//==============================================================================
+// Skipping ahead in the sequence
+void BM_LCGDiscard(benchmark::State& state) {
+  LCG lcg;
+  const auto n = static_cast<unsigned long long>(state.range(0));
+
+  for (auto _ : state) {
+    lcg.discard(n);
+    benchmark::DoNotOptimize(lcg);
+  }
+}
+BENCHMARK(BM_LCGDiscard)->RangeMultiplier(100)->Range(1, 1000000);
+
+void BM_RNGStreamAdvance(benchmark::State& state) {
+  RNGStream stream;
+  const auto n = static_cast<std::uint64_t>(state.range(0));
+
+  for (auto _ : state) {
+    stream.advance(n);
+    benchmark::DoNotOptimize(stream);
+  }
+}
+BENCHMARK(BM_RNGStreamAdvance)->RangeMultiplier(100)->Range(1, 1000000);
+
+}  // namespace
+}  // namespace pndl
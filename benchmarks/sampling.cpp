@@ -0,0 +1,525 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/angle_distribution.hpp>
+#include <PapillonNDL/angle_table.hpp>
+#include <PapillonNDL/cm_distribution.hpp>
+#include <PapillonNDL/compiled_angle_energy.hpp>
+#include <PapillonNDL/elastic_svt.hpp>
+#include <PapillonNDL/equiprobable_angle_bins.hpp>
+#include <PapillonNDL/evaporation.hpp>
+#include <PapillonNDL/frame.hpp>
+#include <PapillonNDL/isotropic.hpp>
+#include <PapillonNDL/legendre.hpp>
+#include <PapillonNDL/level_inelastic_scatter.hpp>
+#include <PapillonNDL/maxwellian.hpp>
+#include <PapillonNDL/multiple_distribution.hpp>
+#include <PapillonNDL/nbody.hpp>
+#include <PapillonNDL/pctable.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/tabular_energy.hpp>
+#include <PapillonNDL/tabulated_1d.hpp>
+#include <PapillonNDL/uncorrelated.hpp>
+#include <PapillonNDL/watt.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+//==============================================================================
+// Each law is sampled through a pointer to its base class, as it would be in
+// a transport code. The std::function benchmarks wrap an RNGStream in a
+// std::function, so the only difference between the two benchmarks of a law
+// is how the random numbers are passed to the sampling method.
+
+// Incident energy at which all energy laws are sampled, in MeV
+constexpr double E_IN = 2.;
+
+std::shared_ptr<Tabulated1D> constant_function(double value) {
+  return std::make_shared<Tabulated1D>(Interpolation::LinLin,
+                                       std::vector<double>{1.E-11, 20.},
+                                       std::vector<double>{value, value});
+}
+
+// Tabulated Maxwellian spectrum, with a temperature of 1.3 MeV
+PCTable maxwellian_table() {
+  constexpr std::size_t NE = 200;
+  constexpr double T = 1.3;
+  std::vector<double> energy(NE, 0.);
+  std::vector<double> pdf(NE, 0.);
+  std::vector<double> cdf(NE, 0.);
+  for (std::size_t i = 0; i < NE; i++) {
+    energy[i] = 15. * static_cast<double>(i) / static_cast<double>(NE - 1);
+    pdf[i] = std::sqrt(energy[i]) * std::exp(-energy[i] / T);
+    if (i > 0)
+      cdf[i] = cdf[i - 1] +
+               0.5 * (pdf[i] + pdf[i - 1]) * (energy[i] - energy[i - 1]);
+  }
+  for (std::size_t i = 0; i < NE; i++) {
+    pdf[i] /= cdf.back();
+    cdf[i] /= cdf.back();
+  }
+  return PCTable(energy, pdf, cdf, Interpolation::LinLin);
+}
+
+std::shared_ptr<AngleLaw> legendre() {
+  return std::make_shared<Legendre>(std::vector<double>{0.4, 0.15, 0.05});
+}
+
+std::shared_ptr<AngleLaw> angle_table() {
+  return std::make_shared<AngleTable>(
+      Legendre(std::vector<double>{0.4, 0.15, 0.05}));
+}
+
+std::shared_ptr<AngleLaw> equiprobable_angle_bins() {
+  std::vector<double> bounds(33, 0.);
+  for (std::size_t i = 0; i < bounds.size(); i++) {
+    const double x = static_cast<double>(i) / 32.;
+    bounds[i] = 2. * x * x - 1.;
+  }
+  return std::make_shared<EquiprobableAngleBins>(bounds);
+}
+
+std::shared_ptr<EnergyLaw> watt() {
+  return std::make_shared<Watt>(constant_function(0.988),
+                                constant_function(2.249), -20.);
+}
+
+std::shared_ptr<EnergyLaw> maxwellian() {
+  return std::make_shared<Maxwellian>(constant_function(1.3), -20.);
+}
+
+std::shared_ptr<EnergyLaw> evaporation() {
+  return std::make_shared<Evaporation>(constant_function(1.3), -20.);
+}
+
+std::shared_ptr<EnergyLaw> tabular_energy() {
+  const PCTable table = maxwellian_table();
+  return std::make_shared<TabularEnergy>(std::vector<double>{1.E-11, 20.},
+                                         std::vector<PCTable>{table, table});
+}
+
+std::shared_ptr<AngleEnergy> nbody() {
+  return std::make_shared<NBody>(3, 2.9991, 1.9968, -2.2246);
+}
+
+std::shared_ptr<AngleEnergy> uncorrelated() {
+  AngleDistribution angle(std::vector<double>{1.E-11, 20.},
+                          {legendre(), legendre()});
+  return std::make_shared<Uncorrelated>(angle, watt());
+}
+
+//==============================================================================
+void BM_SampleMuFunction(benchmark::State& state,
+                         std::shared_ptr<AngleLaw> law) {
+  RNGStream stream;
+  const std::function<double()> rng = std::ref(stream);
+  for (auto _ : state) benchmark::DoNotOptimize(law->sample_mu(rng));
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SampleMuStream(benchmark::State& state,
+                       std::shared_ptr<AngleLaw> law) {
+  RNGStream stream;
+  for (auto _ : state) benchmark::DoNotOptimize(law->sample_mu(stream));
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SampleEnergyFunction(benchmark::State& state,
+                             std::shared_ptr<EnergyLaw> law) {
+  RNGStream stream;
+  const std::function<double()> rng = std::ref(stream);
+  for (auto _ : state) benchmark::DoNotOptimize(law->sample_energy(E_IN, rng));
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SampleEnergyStream(benchmark::State& state,
+                           std::shared_ptr<EnergyLaw> law) {
+  RNGStream stream;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(law->sample_energy(E_IN, stream));
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SampleAngleEnergyFunction(benchmark::State& state,
+                                  std::shared_ptr<AngleEnergy> law) {
+  RNGStream stream;
+  const std::function<double()> rng = std::ref(stream);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(law->sample_angle_energy(E_IN, rng));
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SampleAngleEnergyStream(benchmark::State& state,
+                                std::shared_ptr<AngleEnergy> law) {
+  RNGStream stream;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(law->sample_angle_energy(E_IN, stream));
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_SampleMuFunction, Isotropic,
+                  std::make_shared<Isotropic>());
+BENCHMARK_CAPTURE(BM_SampleMuStream, Isotropic, std::make_shared<Isotropic>());
+BENCHMARK_CAPTURE(BM_SampleMuFunction, Legendre, legendre());
+BENCHMARK_CAPTURE(BM_SampleMuStream, Legendre, legendre());
+BENCHMARK_CAPTURE(BM_SampleMuFunction, AngleTable, angle_table());
+BENCHMARK_CAPTURE(BM_SampleMuStream, AngleTable, angle_table());
+BENCHMARK_CAPTURE(BM_SampleMuFunction, EquiprobableAngleBins,
+                  equiprobable_angle_bins());
+BENCHMARK_CAPTURE(BM_SampleMuStream, EquiprobableAngleBins,
+                  equiprobable_angle_bins());
+
+BENCHMARK_CAPTURE(BM_SampleEnergyFunction, Watt, watt());
+BENCHMARK_CAPTURE(BM_SampleEnergyStream, Watt, watt());
+BENCHMARK_CAPTURE(BM_SampleEnergyFunction, Maxwellian, maxwellian());
+BENCHMARK_CAPTURE(BM_SampleEnergyStream, Maxwellian, maxwellian());
+BENCHMARK_CAPTURE(BM_SampleEnergyFunction, Evaporation, evaporation());
+BENCHMARK_CAPTURE(BM_SampleEnergyStream, Evaporation, evaporation());
+BENCHMARK_CAPTURE(BM_SampleEnergyFunction, TabularEnergy, tabular_energy());
+BENCHMARK_CAPTURE(BM_SampleEnergyStream, TabularEnergy, tabular_energy());
+
+BENCHMARK_CAPTURE(BM_SampleAngleEnergyFunction, NBody, nbody());
+BENCHMARK_CAPTURE(BM_SampleAngleEnergyStream, NBody, nbody());
+BENCHMARK_CAPTURE(BM_SampleAngleEnergyFunction, Uncorrelated, uncorrelated());
+BENCHMARK_CAPTURE(BM_SampleAngleEnergyStream, Uncorrelated, uncorrelated());
+
+//==============================================================================
+// Sampling of complete secondary distributions, as they are built by
+// ReactionBase, with virtual dispatch and with a CompiledAngleEnergy. The
+// level inelastic distribution is an Uncorrelated distribution in the center
+// of mass frame. The continuum distribution is a MultipleDistribution of an
+// Uncorrelated distribution and an NBody distribution, in the center of mass
+// frame.
+std::shared_ptr<AngleEnergy> level_inelastic() {
+  AngleDistribution angle(
+      std::vector<double>{1.E-11, 5., 20.},
+      {std::make_shared<Isotropic>(), legendre(), angle_table()});
+  auto uncorr = std::make_shared<Uncorrelated>(
+      angle, std::make_shared<LevelInelasticScatter>(-0.0449, 236.0058));
+  return std::make_shared<CMDistribution>(236.0058, -0.0449, uncorr);
+}
+
+std::shared_ptr<AngleEnergy> continuum_inelastic() {
+  auto prob_1 = std::make_shared<Tabulated1D>(Interpolation::LinLin,
+                                              std::vector<double>{1.E-11, 20.},
+                                              std::vector<double>{0.8, 0.3});
+  auto prob_2 = std::make_shared<Tabulated1D>(Interpolation::LinLin,
+                                              std::vector<double>{1.E-11, 20.},
+                                              std::vector<double>{0.2, 0.7});
+  auto mult = std::make_shared<MultipleDistribution>(
+      std::vector<std::shared_ptr<AngleEnergy>>{uncorrelated(), nbody()},
+      std::vector<std::shared_ptr<Tabulated1D>>{prob_1, prob_2});
+  return std::make_shared<CMDistribution>(1.9968, -2.2246, mult);
+}
+
+// Incident energy for the complete distributions, in MeV
+constexpr double E_COLLISION = 8.;
+
+void BM_SampleCollisionVirtual(benchmark::State& state,
+                               std::shared_ptr<AngleEnergy> dist) {
+  RNGStream stream;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(dist->sample_angle_energy(E_COLLISION, stream));
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SampleCollisionCompiled(benchmark::State& state,
+                                std::shared_ptr<AngleEnergy> dist) {
+  const CompiledAngleEnergy compiled(*dist);
+  RNGStream stream;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        compiled.sample_angle_energy(E_COLLISION, stream));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_SampleCollisionVirtual, LevelInelastic,
+                  level_inelastic());
+BENCHMARK_CAPTURE(BM_SampleCollisionCompiled, LevelInelastic,
+                  level_inelastic());
+BENCHMARK_CAPTURE(BM_SampleCollisionVirtual, ContinuumInelastic,
+                  continuum_inelastic());
+BENCHMARK_CAPTURE(BM_SampleCollisionCompiled, ContinuumInelastic,
+                  continuum_inelastic());
+
+//==============================================================================
+// Transformation of a bank of inelastic secondaries from the center of mass
+// frame to the lab frame. The bank is sampled once from the continuum
+// inelastic distribution in the center of mass frame, at incident energies
+// between 1 and 20 MeV. The reference is the original transformation, which
+// recomputed all terms depending on A for every secondary.
+constexpr std::size_t BANK_SIZE = 1024;
+constexpr double INELASTIC_AWR = 1.9968;
+
+struct SecondaryBank {
+  std::vector<double> E_in;
+  std::vector<AngleEnergyPacket> cm;
+};
+
+SecondaryBank inelastic_bank() {
+  const auto dist = std::dynamic_pointer_cast<CMDistribution>(
+      continuum_inelastic());
+  SecondaryBank bank;
+  RNGStream stream(3);
+  for (std::size_t i = 0; i < BANK_SIZE; i++) {
+    const double E = 1. + 19. * stream();
+    bank.E_in.push_back(E);
+    bank.cm.push_back(dist->distribution().sample_angle_energy(E, stream));
+  }
+  return bank;
+}
+
+void BM_CMToLabReference(benchmark::State& state) {
+  const SecondaryBank bank = inelastic_bank();
+  std::vector<AngleEnergyPacket> out = bank.cm;
+  const double A = INELASTIC_AWR;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < BANK_SIZE; i++) {
+      const double Ein = bank.E_in[i];
+      const double mu = bank.cm[i].cosine_angle;
+      const double Eout = bank.cm[i].energy;
+      const double Eout_lab =
+          Eout + (Ein + 2. * mu * (A + 1.) * std::sqrt(Ein * Eout)) /
+                     std::pow(A + 1., 2.);
+      out[i].cosine_angle = mu * std::sqrt(Eout / Eout_lab) +
+                            (1. / (A + 1.)) * std::sqrt(Ein / Eout_lab);
+      out[i].energy = Eout_lab;
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(BANK_SIZE));
+}
+
+void BM_CMToLabBatch(benchmark::State& state) {
+  const SecondaryBank bank = inelastic_bank();
+  std::vector<AngleEnergyPacket> out = bank.cm;
+  const KinematicConstants k(INELASTIC_AWR);
+  for (auto _ : state) {
+    std::copy(bank.cm.begin(), bank.cm.end(), out.begin());
+    CMToLab::transform(bank.E_in, k, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(BANK_SIZE));
+}
+
+BENCHMARK(BM_CMToLabReference);
+BENCHMARK(BM_CMToLabBatch);
+
+//==============================================================================
+// Selection of a distribution from a MultipleDistribution with state.range(0)
+// laws, whose probabilities are tabulated on different incident energy grids
+// of 30 points. The reference evaluates every probability function, as
+// MultipleDistribution originally did.
+std::shared_ptr<MultipleDistribution> multiple_distribution(std::size_t N) {
+  std::vector<std::shared_ptr<AngleEnergy>> dists(N, nbody());
+  std::vector<std::shared_ptr<Tabulated1D>> probs;
+  for (std::size_t d = 0; d < N; d++) {
+    std::vector<double> x, y;
+    for (std::size_t i = 0; i < 30; i++) {
+      const double f = (static_cast<double>(i) + 0.1 * static_cast<double>(d)) /
+                       29.;
+      x.push_back(1.E-11 + 20. * std::min(f, 1.));
+      y.push_back((1. + 0.5 * std::sin(5. * f + static_cast<double>(d))) /
+                  static_cast<double>(N));
+    }
+    probs.push_back(
+        std::make_shared<Tabulated1D>(Interpolation::LinLin, x, y));
+  }
+  return std::make_shared<MultipleDistribution>(dists, probs);
+}
+
+void BM_SelectDistributionReference(benchmark::State& state) {
+  const auto mult =
+      multiple_distribution(static_cast<std::size_t>(state.range(0)));
+  RNGStream stream;
+  for (auto _ : state) {
+    const double E_in = 20. * stream();
+    const double xi = stream();
+    std::size_t d = mult->size() - 1;
+    double sum = 0.;
+    for (std::size_t i = 0; i + 1 < mult->size(); i++) {
+      sum += mult->probability(i)(E_in);
+      if (xi < sum) {
+        d = i;
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(d);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SelectDistributionTable(benchmark::State& state) {
+  const auto mult =
+      multiple_distribution(static_cast<std::size_t>(state.range(0)));
+  RNGStream stream;
+  for (auto _ : state) {
+    const double E_in = 20. * stream();
+    benchmark::DoNotOptimize(mult->select_distribution(E_in, stream()));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SelectDistributionReference)->Arg(2)->Arg(4)->Arg(8);
+BENCHMARK(BM_SelectDistributionTable)->Arg(2)->Arg(4)->Arg(8);
+
+//==============================================================================
+// Target velocity sampling with SVT, for U238 at 6.6 eV and 1200 K.
+constexpr double SVT_EIN = 6.6E-6;
+constexpr double SVT_KT = 1200. * 8.617333262E-11;
+constexpr double SVT_AWR = 236.0058;
+
+void BM_SampleTargetVelocityFunction(benchmark::State& state) {
+  const ElasticSVT svt;
+  RNGStream stream;
+  const std::function<double()> rng = std::ref(stream);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        svt.sample_target_velocity(SVT_EIN, SVT_KT, SVT_AWR, rng));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SampleTargetVelocityFunction);
+
+void BM_SampleTargetVelocityStream(benchmark::State& state) {
+  const ElasticSVT svt;
+  RNGStream stream;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        svt.sample_target_velocity(SVT_EIN, SVT_KT, SVT_AWR, stream));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SampleTargetVelocityStream);
+
+//==============================================================================
+// Sampling of high order Legendre distributions. The reference is the
+// original implementation of Legendre::sample_mu, which used rejection
+// sampling, evaluating each Legendre polynomial of the PDF independently for
+// every trial. The benchmark argument is the order of the series, which has
+// the moments of a Henyey-Greenstein distribution with g = 0.5.
+std::vector<double> legendre_moments(std::size_t L) {
+  std::vector<double> a(L, 0.);
+  for (std::size_t l = 0; l < L; l++) a[l] = std::pow(0.5, l + 1);
+  return a;
+}
+
+class RejectionLegendre {
+ public:
+  RejectionLegendre(const std::vector<double>& a) : a_(a), pdf_max_(0.) {
+    a_.insert(a_.begin(), 1.);
+    for (std::size_t l = 0; l < a_.size(); l++) {
+      a_[l] *= (2. * static_cast<double>(l) + 1.) / 2.;
+    }
+
+    for (std::size_t i = 0; i <= 2000; i++) {
+      const double mu = -1. + 0.001 * static_cast<double>(i);
+      pdf_max_ = std::max(pdf_max_, pdf(mu));
+    }
+    pdf_max_ *= 1.001;
+  }
+
+  double sample_mu(RNGStream& rng) const {
+    while (true) {
+      const double mu = 2. * rng() - 1.;
+      if (rng() * pdf_max_ < pdf(mu)) return mu;
+    }
+  }
+
+  double pdf(double mu) const {
+    double pdf = 0.;
+    for (unsigned l = 0; l < a_.size(); l++) {
+      pdf += a_[l] * std::legendre(l, mu);
+    }
+    return pdf;
+  }
+
+ private:
+  std::vector<double> a_;
+  double pdf_max_;
+};
+
+template <class Law>
+void BM_SampleLegendre(benchmark::State& state) {
+  const Law law(legendre_moments(static_cast<std::size_t>(state.range(0))));
+  RNGStream stream;
+  for (auto _ : state) benchmark::DoNotOptimize(law.sample_mu(stream));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_SampleLegendre, RejectionLegendre)
+    ->Arg(5)
+    ->Arg(10)
+    ->Arg(30);
+BENCHMARK_TEMPLATE(BM_SampleLegendre, Legendre)->Arg(5)->Arg(10)->Arg(30);
+
+template <class Law>
+void BM_LegendrePDF(benchmark::State& state) {
+  const Law law(legendre_moments(static_cast<std::size_t>(state.range(0))));
+  double mu = -1.;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(law.pdf(mu));
+    mu += 0.001;
+    if (mu > 1.) mu = -1.;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_LegendrePDF, RejectionLegendre)
+    ->Arg(5)
+    ->Arg(10)
+    ->Arg(30);
+BENCHMARK_TEMPLATE(BM_LegendrePDF, Legendre)->Arg(5)->Arg(10)->Arg(30);
+
+//==============================================================================
+// Sampling of the analytic spectra, far from the restriction energy, and
+// near it, where only the first 0.5 MeV of the spectrum may be sampled. Each
+// law is sampled with its default rejection sampler, and with the shared
+// tabulated spectrum enabled through set_tabulated.
+constexpr double E_FAR = 2.;
+constexpr double E_THRESHOLD = -19.5;
+
+template <class Law>
+std::shared_ptr<EnergyLaw> tabulated(std::shared_ptr<EnergyLaw> law) {
+  auto copy = std::make_shared<Law>(static_cast<const Law&>(*law));
+  copy->set_tabulated(true);
+  return copy;
+}
+
+void BM_Spectrum(benchmark::State& state, std::shared_ptr<EnergyLaw> law,
+                 double E_in) {
+  RNGStream stream;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(law->sample_energy(E_in, stream));
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_Spectrum, Maxwellian, maxwellian(), E_FAR);
+BENCHMARK_CAPTURE(BM_Spectrum, MaxwellianTabulated,
+                  tabulated<Maxwellian>(maxwellian()), E_FAR);
+BENCHMARK_CAPTURE(BM_Spectrum, MaxwellianThreshold, maxwellian(),
+                  E_THRESHOLD);
+BENCHMARK_CAPTURE(BM_Spectrum, MaxwellianThresholdTabulated,
+                  tabulated<Maxwellian>(maxwellian()), E_THRESHOLD);
+BENCHMARK_CAPTURE(BM_Spectrum, Evaporation, evaporation(), E_FAR);
+BENCHMARK_CAPTURE(BM_Spectrum, EvaporationTabulated,
+                  tabulated<Evaporation>(evaporation()), E_FAR);
+BENCHMARK_CAPTURE(BM_Spectrum, EvaporationThreshold, evaporation(),
+                  E_THRESHOLD);
+BENCHMARK_CAPTURE(BM_Spectrum, EvaporationThresholdTabulated,
+                  tabulated<Evaporation>(evaporation()), E_THRESHOLD);
+BENCHMARK_CAPTURE(BM_Spectrum, Watt, watt(), E_FAR);
+BENCHMARK_CAPTURE(BM_Spectrum, WattTabulated, tabulated<Watt>(watt()), E_FAR);
+BENCHMARK_CAPTURE(BM_Spectrum, WattThreshold, watt(), E_THRESHOLD);
+BENCHMARK_CAPTURE(BM_Spectrum, WattThresholdTabulated, tabulated<Watt>(watt()),
+                  E_THRESHOLD);
+
+}  // namespace
+}  // namespace pndl
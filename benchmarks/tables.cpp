@@ -0,0 +1,296 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/continuous_energy_discrete_cosines.hpp>
+#include <PapillonNDL/energy_angle_table.hpp>
+#include <PapillonNDL/guide_table.hpp>
+#include <PapillonNDL/kalbach.hpp>
+#include <PapillonNDL/kalbach_table.hpp>
+#include <PapillonNDL/pctable.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+//==============================================================================
+// All tables hold the same tabulated evaporation spectrum, with a number of
+// outgoing energy points given by the benchmark argument. Each benchmark
+// samples the table with a pre-generated list of random numbers, so that only
+// the cost of inverting the CDF is measured.
+constexpr std::size_t NXI = 4096;
+
+struct Spectrum {
+  std::vector<double> energy;
+  std::vector<double> pdf;
+  std::vector<double> cdf;
+};
+
+Spectrum evaporation_spectrum(std::size_t NE) {
+  constexpr double T = 0.8;
+  Spectrum s{std::vector<double>(NE, 0.), std::vector<double>(NE, 0.),
+             std::vector<double>(NE, 0.)};
+  for (std::size_t i = 0; i < NE; i++) {
+    s.energy[i] = 15. * static_cast<double>(i) / static_cast<double>(NE - 1);
+    s.pdf[i] = s.energy[i] * std::exp(-s.energy[i] / T);
+    if (i > 0)
+      s.cdf[i] = s.cdf[i - 1] + 0.5 * (s.pdf[i] + s.pdf[i - 1]) *
+                                    (s.energy[i] - s.energy[i - 1]);
+  }
+  const double norm = s.cdf.back();
+  for (std::size_t i = 0; i < NE; i++) {
+    s.pdf[i] /= norm;
+    s.cdf[i] /= norm;
+  }
+  return s;
+}
+
+Spectrum spectrum(const benchmark::State& state) {
+  return evaporation_spectrum(static_cast<std::size_t>(state.range(0)));
+}
+
+std::vector<double> random_numbers() {
+  RNGStream stream(19);
+  std::vector<double> xi(NXI, 0.);
+  for (auto& x : xi) x = stream();
+  return xi;
+}
+
+void table_args(benchmark::internal::Benchmark* b) {
+  b->Arg(32);
+  b->Arg(256);
+  b->Arg(2048);
+}
+
+//==============================================================================
+// Reference inversion of a LinLin CDF, which searches the entire CDF with
+// std::lower_bound. This was the original implementation in all of the
+// tables, and is kept here to measure the cost of the search.
+double reference_sample(const Spectrum& s, double xi) {
+  std::size_t l = static_cast<std::size_t>(
+      std::lower_bound(s.cdf.begin(), s.cdf.end(), xi) - s.cdf.begin());
+  if (xi == s.cdf[l]) return s.energy[l];
+  l--;
+
+  if (s.pdf[l] == s.pdf[l + 1])
+    return s.energy[l] + ((xi - s.cdf[l]) / s.pdf[l]);
+
+  const double m =
+      (s.pdf[l + 1] - s.pdf[l]) / (s.energy[l + 1] - s.energy[l]);
+  const double arg = s.pdf[l] * s.pdf[l] + 2. * m * (xi - s.cdf[l]);
+  return s.energy[l] + (1. / m) * (std::sqrt(std::max(arg, 0.)) - s.pdf[l]);
+}
+
+void BM_ReferenceSample(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const std::vector<double> xi = random_numbers();
+  std::size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(reference_sample(s, xi[i]));
+    i = (i + 1) % NXI;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReferenceSample)->Apply(table_args);
+
+void BM_GuideTableLowerBound(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const GuideTable guide(s.cdf);
+  const std::vector<double> xi = random_numbers();
+  std::size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(guide.lower_bound(s.cdf, xi[i]));
+    i = (i + 1) % NXI;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GuideTableLowerBound)->Apply(table_args);
+
+//==============================================================================
+// Sampling of each table type, which all use a GuideTable
+void BM_PCTableSampleValue(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const PCTable table(s.energy, s.pdf, s.cdf, Interpolation::LinLin);
+  const std::vector<double> xi = random_numbers();
+  std::size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.sample_value(xi[i]));
+    i = (i + 1) % NXI;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PCTableSampleValue)->Apply(table_args);
+
+void BM_KalbachTableSampleEnergy(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const std::vector<double> R(s.energy.size(), 0.2);
+  const std::vector<double> A(s.energy.size(), 1.5);
+  const KalbachTable table(s.energy, s.pdf, s.cdf, R, A, Interpolation::LinLin);
+  const std::vector<double> xi = random_numbers();
+  std::size_t i = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.sample_energy(xi[i]));
+    i = (i + 1) % NXI;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KalbachTableSampleEnergy)->Apply(table_args);
+
+void BM_CEDCTableSampleEnergy(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const ContinuousEnergyDiscreteCosines::CEDCTable table{
+      s.energy, s.pdf, s.cdf,
+      std::vector<std::vector<double>>(s.energy.size(), {-0.5, 0., 0.5}),
+      GuideTable(s.cdf)};
+  const std::vector<double> xi = random_numbers();
+  std::size_t i = 0;
+  std::size_t j = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.sample_energy(xi[i], j));
+    i = (i + 1) % NXI;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CEDCTableSampleEnergy)->Apply(table_args);
+
+// The EnergyAngleTable also samples a cosine from a PCTable for each
+// outgoing energy point, so this includes two guided searches per sample.
+void BM_EnergyAngleTableSample(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const Spectrum mu = evaporation_spectrum(64);
+  std::vector<double> mu_values(mu.energy.size(), 0.);
+  std::vector<double> mu_pdf(mu.pdf.size(), 0.);
+  for (std::size_t k = 0; k < mu_values.size(); k++) {
+    mu_values[k] = 2. * mu.energy[k] / mu.energy.back() - 1.;
+    mu_pdf[k] = 0.5 * mu.energy.back() * mu.pdf[k];
+  }
+  const PCTable angle(mu_values, mu_pdf, mu.cdf, Interpolation::LinLin);
+  const EnergyAngleTable table(s.energy, s.pdf, s.cdf,
+                               std::vector<PCTable>(s.energy.size(), angle),
+                               Interpolation::LinLin);
+  RNGStream rng(19);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.sample_angle_energy(rng));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EnergyAngleTableSample)->Apply(table_args);
+
+//==============================================================================
+// Reference KalbachTable, with a separate vector for each tabulated quantity.
+// This was the original layout, where R and A were found with a search of the
+// outgoing energy grid after sampling the outgoing energy.
+class SeparateKalbachTable {
+ public:
+  SeparateKalbachTable(const Spectrum& s, const std::vector<double>& R,
+                       const std::vector<double>& A)
+      : energy_(s.energy),
+        pdf_(s.pdf),
+        cdf_(s.cdf),
+        R_(R),
+        A_(A),
+        guide_(s.cdf) {}
+
+  KalbachTable::Sample sample(double xi) const {
+    std::size_t l = guide_.lower_bound(cdf_, xi);
+    double E = energy_[l];
+    if (xi != cdf_[l]) {
+      l--;
+      const double m =
+          (pdf_[l + 1] - pdf_[l]) / (energy_[l + 1] - energy_[l]);
+      const double arg = pdf_[l] * pdf_[l] + 2. * m * (xi - cdf_[l]);
+      E = energy_[l] + (1. / m) * (std::sqrt(std::max(arg, 0.)) - pdf_[l]);
+    }
+    return {E, evaluate(E, R_), evaluate(E, A_)};
+  }
+
+ private:
+  std::vector<double> energy_;
+  std::vector<double> pdf_;
+  std::vector<double> cdf_;
+  std::vector<double> R_;
+  std::vector<double> A_;
+  GuideTable guide_;
+
+  double evaluate(double E, const std::vector<double>& y) const {
+    if (E <= energy_.front()) return y.front();
+    if (E >= energy_.back()) return y.back();
+    const std::size_t l = static_cast<std::size_t>(
+        std::lower_bound(energy_.begin(), energy_.end(), E) - energy_.begin() -
+        1);
+    return LinLin::interpolate(E, energy_[l], y[l], energy_[l + 1], y[l + 1]);
+  }
+};
+
+// Each Kalbach distribution has NTABLES incident energies, all with the same
+// table but with R and A varying with the table, and each sample uses a
+// random table, as is the case when sampling neutrons of many energies.
+constexpr std::size_t NTABLES = 200;
+
+std::vector<double> kalbach_R(const Spectrum& s, std::size_t j) {
+  std::vector<double> R(s.energy.size(), 0.);
+  for (std::size_t i = 0; i < R.size(); i++)
+    R[i] = 0.1 + 0.8 * s.cdf[i] * static_cast<double>(j + 1) / NTABLES;
+  return R;
+}
+
+std::vector<double> kalbach_A(const Spectrum& s) {
+  std::vector<double> A(s.energy.size(), 0.);
+  for (std::size_t i = 0; i < A.size(); i++) A[i] = 0.5 + 0.2 * s.energy[i];
+  return A;
+}
+
+void BM_KalbachSampleSeparate(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const std::vector<double> A = kalbach_A(s);
+  std::vector<SeparateKalbachTable> tables;
+  for (std::size_t j = 0; j < NTABLES; j++)
+    tables.emplace_back(s, kalbach_R(s, j), A);
+  RNGStream rng(19);
+
+  for (auto _ : state) {
+    const std::size_t j = static_cast<std::size_t>(rng() * NTABLES);
+    benchmark::DoNotOptimize(tables[j].sample(rng()));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KalbachSampleSeparate)->Apply(table_args);
+
+void BM_KalbachSampleArena(benchmark::State& state) {
+  const Spectrum s = spectrum(state);
+  const std::vector<double> A = kalbach_A(s);
+  std::vector<double> incoming_energy;
+  std::vector<KalbachTable> tables;
+  for (std::size_t j = 0; j < NTABLES; j++) {
+    incoming_energy.push_back(static_cast<double>(j + 1));
+    tables.emplace_back(s.energy, s.pdf, s.cdf, kalbach_R(s, j), A,
+                        Interpolation::LinLin);
+  }
+  const Kalbach kalbach(incoming_energy, tables);
+  RNGStream rng(19);
+
+  for (auto _ : state) {
+    const std::size_t j = static_cast<std::size_t>(rng() * NTABLES);
+    benchmark::DoNotOptimize(kalbach.table(j).sample(rng()));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KalbachSampleArena)->Apply(table_args);
+
+}  // namespace
+}  // namespace pndl
@@ -0,0 +1,184 @@
+#include <benchmark/benchmark.h>
+
+#include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/continuous_energy_discrete_cosines.hpp>
+#include <PapillonNDL/discrete_cosines_energies.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/st_coherent_elastic.hpp>
+#include <PapillonNDL/st_incoherent_elastic_ace.hpp>
+#include <PapillonNDL/st_thermal_scattering_law.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../tests/common/tsl_ace.hpp"
+
+namespace pndl {
+namespace {
+
+using namespace synthetic;
+
+//==============================================================================
+// The synthetic thermal scattering laws of tsl_ace.hpp, with the sizes of a
+// typical light water evaluation. The coherent file has the Bragg edges of
+// a typical graphite evaluation.
+constexpr std::size_t Ne = 116;
+constexpr SyntheticTSL DISCRETE{Ne, 16, 20, 2000};
+constexpr SyntheticTSL CONTINUOUS{Ne, 80, 20, 2000};
+
+const ACE& continuous_ace() {
+  static const ACE ace = CONTINUOUS.ace(true, false);
+  return ace;
+}
+
+const ACE& discrete_ace() {
+  static const ACE ace = DISCRETE.ace(false, false);
+  return ace;
+}
+
+const ACE& coherent_ace() {
+  static const ACE ace = CONTINUOUS.ace(true, true);
+  return ace;
+}
+
+//==============================================================================
+// Each sample is for a random incident energy within the tabulated grid, so
+// that the data of all incident energies is used, as in a transport code.
+template <class Law>
+void sample_thermal(benchmark::State& state, const Law& law) {
+  RNGStream rng(19);
+  const double E_min = CONTINUOUS.incident_energy(0);
+  const double E_max = CONTINUOUS.incident_energy(Ne - 1);
+
+  for (auto _ : state) {
+    const double E_in = E_min + (E_max - E_min) * rng();
+    benchmark::DoNotOptimize(law.sample_angle_energy(E_in, rng));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_IncoherentElastic(benchmark::State& state) {
+  const STIncoherentElasticACE law(continuous_ace());
+  sample_thermal(state, law);
+}
+BENCHMARK(BM_IncoherentElastic);
+
+void BM_DiscreteCosinesEnergies(benchmark::State& state) {
+  const DiscreteCosinesEnergies law(discrete_ace());
+  sample_thermal(state, law);
+}
+BENCHMARK(BM_DiscreteCosinesEnergies);
+
+void BM_ContinuousEnergyDiscreteCosines(benchmark::State& state) {
+  const ContinuousEnergyDiscreteCosines law(continuous_ace(),
+                                            state.range(0) == 1);
+  sample_thermal(state, law);
+}
+BENCHMARK(BM_ContinuousEnergyDiscreteCosines)->Arg(0)->Arg(1);
+
+//==============================================================================
+// Each iteration evaluates the total cross section of the law at a random
+// incident energy, and selects the reaction to sample, for the incoherent
+// (argument 0) and coherent (argument 1) elastic files. The reference
+// evaluates each reaction cross section separately.
+const ACE& tsl_ace(const benchmark::State& state) {
+  return state.range(0) == 1 ? coherent_ace() : continuous_ace();
+}
+
+void BM_TSLSelectReference(benchmark::State& state) {
+  const STThermalScatteringLaw law(tsl_ace(state));
+  RNGStream rng(19);
+  const double E_max = CONTINUOUS.incident_energy(Ne - 1);
+
+  for (auto _ : state) {
+    const double E_in = 1.E-11 + (E_max - 1.E-11) * rng();
+    const double ii = law.incoherent_inelastic().xs(E_in);
+    const double ie = law.incoherent_elastic().xs(E_in);
+    const double ce = law.coherent_elastic().xs(E_in);
+    const double x = rng() * (ii + ie + ce);
+    const STTSLReaction* reaction = &law.coherent_elastic();
+    if (x < ii)
+      reaction = &law.incoherent_inelastic();
+    else if (x < ii + ie)
+      reaction = &law.incoherent_elastic();
+    benchmark::DoNotOptimize(reaction);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TSLSelectReference)->Arg(0)->Arg(1);
+
+void BM_TSLEvaluateAndSelect(benchmark::State& state) {
+  const STThermalScatteringLaw law(tsl_ace(state));
+  RNGStream rng(19);
+  const double E_max = CONTINUOUS.incident_energy(Ne - 1);
+
+  for (auto _ : state) {
+    const double E_in = 1.E-11 + (E_max - 1.E-11) * rng();
+    benchmark::DoNotOptimize(law.evaluate_and_select(E_in, rng()));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TSLEvaluateAndSelect)->Arg(0)->Arg(1);
+
+//==============================================================================
+// Each iteration evaluates the coherent elastic cross section at a random
+// incident energy, and samples the scattering cosine, as is done when the
+// reaction has been selected. The reference is the previous implementation,
+// which searches all of the Bragg edges for both the cross section and the
+// sampling, and then searches the structure factor sums with a bisection.
+double coherent_xs_reference(const STCoherentElastic& law, double E) {
+  const auto& edges = law.bragg_edges();
+  if (E <= edges.front()) return 0.;
+  const std::size_t l = static_cast<std::size_t>(
+      std::lower_bound(edges.begin(), edges.end(), E) - edges.begin() - 1);
+  return law.structure_factor_sum()[l] / E;
+}
+
+double coherent_mu_reference(const STCoherentElastic& law, double E_in,
+                             RNGStream& rng) {
+  const auto& edges = law.bragg_edges();
+  const auto& S = law.structure_factor_sum();
+  if (E_in <= edges.front()) return 1.;
+  const auto it = std::lower_bound(edges.begin(), edges.end(), E_in);
+  const std::ptrdiff_t l = (it - edges.begin()) - 1;
+  const double P = rng() * S[static_cast<std::size_t>(l)];
+  const auto Sit = std::lower_bound(S.begin(), S.begin() + l, P);
+  return 1. - 2. * edges[static_cast<std::size_t>(Sit - S.begin())] / E_in;
+}
+
+void BM_CoherentElasticReference(benchmark::State& state) {
+  const STCoherentElastic law(coherent_ace());
+  RNGStream rng(19);
+  const double E_max = CONTINUOUS.incident_energy(Ne - 1);
+
+  for (auto _ : state) {
+    const double E_in = 1.E-11 + (E_max - 1.E-11) * rng();
+    benchmark::DoNotOptimize(coherent_xs_reference(law, E_in));
+    benchmark::DoNotOptimize(coherent_mu_reference(law, E_in, rng));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CoherentElasticReference);
+
+void BM_CoherentElastic(benchmark::State& state) {
+  const STCoherentElastic law(coherent_ace());
+  RNGStream rng(19);
+  const double E_max = CONTINUOUS.incident_energy(Ne - 1);
+
+  for (auto _ : state) {
+    const double E_in = 1.E-11 + (E_max - 1.E-11) * rng();
+    const std::size_t n = law.bragg_index(E_in);
+    benchmark::DoNotOptimize(law.xs(E_in, n));
+    benchmark::DoNotOptimize(law.sample_angle_energy(E_in, n, rng));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CoherentElastic);
+
+}  // namespace
+}  // namespace pndl
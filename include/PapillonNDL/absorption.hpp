@@ -52,6 +52,14 @@ class Absorption : public AngleEnergy {
     return {1., 0.};
   }
 
+  AngleEnergyPacket sample_angle_energy(
+      double /*E_in*/, RNGStream& /*rng*/) const override final {
+    std::string mssg =
+        "Distribution for MT " + std::to_string(mt_) + " is absorption.";
+    throw PNDLException(mssg);
+    return {1., 0.};
+  }
+
   std::optional<double> angle_pdf(double /*E_in*/,
                                   double /*mu*/) const override final {
     return std::nullopt;
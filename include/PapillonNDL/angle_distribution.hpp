@@ -30,6 +30,7 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_law.hpp>
+#include <PapillonNDL/energy_grid_map.hpp>
 #include <functional>
 #include <memory>
 
@@ -64,6 +65,49 @@ class AngleDistribution {
    */
   double sample_angle(double E_in, const std::function<double()>& rng) const;
 
+  /**
+   * @brief Samples a scattering cosine for the given energy, drawing the
+   *        random numbers directly from an RNGStream.
+   * @param E_in Incident energy before scatter, in MeV.
+   * @param rng Random number stream.
+   */
+  double sample_angle(double E_in, RNGStream& rng) const;
+
+  /**
+   * @brief Samples a scattering cosine for the given energy, with the
+   *        interval of the incident energy in the EnergyGrid of the nuclide
+   *        already provided. No search is performed if the grid has been
+   *        mapped with map_energy_grid.
+   * @param E_in Incident energy before scatter, in MeV.
+   * @param grid EnergyGrid in which E_in has been located.
+   * @param i Index of the interval of the grid which contains E_in.
+   * @param rng Random number generation function.
+   */
+  double sample_angle(double E_in, const EnergyGrid& grid, std::size_t i,
+                      const std::function<double()>& rng) const;
+
+  /**
+   * @brief Samples a scattering cosine for the given energy, with the
+   *        interval of the incident energy in the EnergyGrid of the nuclide
+   *        already provided, drawing the random numbers directly from an
+   *        RNGStream.
+   * @param E_in Incident energy before scatter, in MeV.
+   * @param grid EnergyGrid in which E_in has been located.
+   * @param i Index of the interval of the grid which contains E_in.
+   * @param rng Random number stream.
+   */
+  double sample_angle(double E_in, const EnergyGrid& grid, std::size_t i,
+                      RNGStream& rng) const;
+
+  /**
+   * @brief Precomputes the map from the intervals of an EnergyGrid to the
+   *        intervals of the incident energy grid of the distribution.
+   * @param grid EnergyGrid of the nuclide.
+   */
+  void map_energy_grid(const EnergyGrid& grid) {
+    grid_map_.add(grid, energy_grid_);
+  }
+
   /**
    * @brief Evaluates the PDF for having a scattering cosine of mu at incoming
    *        energy E_in.
@@ -99,6 +143,12 @@ class AngleDistribution {
  private:
   std::vector<double> energy_grid_;
   std::vector<std::shared_ptr<AngleLaw>> laws_;
+  EnergyGridMap grid_map_;
+
+  // Samples the angle, where indx is the index of the first incident energy
+  // which is not less than E_in.
+  template <class RNG>
+  double sample_angle_impl(double E_in, std::size_t indx, RNG& rng) const;
 };
 
 }  // namespace pndl
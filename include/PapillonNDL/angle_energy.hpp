@@ -28,12 +28,16 @@
  * @author Hunter Belanger
  */
 
+#include <PapillonNDL/rng_stream.hpp>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
 
 namespace pndl {
 
+class EnergyGrid;
+
 /**
  * @brief A struct to hold a sampled angle and energy.
  */
@@ -59,6 +63,56 @@ class AngleEnergy : public std::enable_shared_from_this<AngleEnergy> {
   virtual AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const = 0;
 
+  /**
+   * @brief Samples an angle and energy from the distribution, drawing the
+   *        random numbers directly from an RNGStream. Random numbers are
+   *        then generated inline, without an indirect call for every draw.
+   *        The default implementation forwards to the std::function
+   *        overload, so derived classes which do not override this method
+   *        remain valid.
+   * @param E_in Incident energy in MeV.
+   * @param rng Random number stream.
+   * @return Sampled cosine of the scattering angle and energy in an
+   *         AngleEnergyPacket.
+   */
+  virtual AngleEnergyPacket sample_angle_energy(double E_in,
+                                                RNGStream& rng) const {
+    return this->sample_angle_energy(E_in,
+                                     std::function<double()>(std::ref(rng)));
+  }
+
+  /**
+   * @brief Samples an angle and energy from the distribution, with the
+   *        interval of the incident energy in the EnergyGrid of the nuclide
+   *        already provided. If the grid has been mapped with
+   *        map_energy_grid, the distribution finds its own incident energy
+   *        interval without a search. The default implementation ignores the
+   *        grid index, and forwards to the RNGStream overload.
+   * @param E_in Incident energy in MeV.
+   * @param grid EnergyGrid in which E_in has been located.
+   * @param i Index of the interval of the grid which contains E_in, as
+   *          returned by EnergyGrid::get_lower_index.
+   * @param rng Random number stream.
+   * @return Sampled cosine of the scattering angle and energy in an
+   *         AngleEnergyPacket.
+   */
+  virtual AngleEnergyPacket sample_angle_energy(double E_in,
+                                                const EnergyGrid& /*grid*/,
+                                                std::size_t /*i*/,
+                                                RNGStream& rng) const {
+    return this->sample_angle_energy(E_in, rng);
+  }
+
+  /**
+   * @brief Precomputes the map from the intervals of an EnergyGrid to the
+   *        incident energy intervals of the distribution, which is used when
+   *        sampling with an EnergyGrid index. The map requires one integer
+   *        per point of the grid, for each tabulated incident energy grid in
+   *        the distribution. The default implementation does nothing.
+   * @param grid EnergyGrid of the nuclide.
+   */
+  virtual void map_energy_grid(const EnergyGrid& /*grid*/) {}
+
   /**
    * @brief Evaluates the marginal PDF for having a scattering cosine of mu at
    *        incoming energy E_in. Returns an std::optional<double>, as it may
@@ -28,6 +28,7 @@
  * @author Hunter Belanger
  */
 
+#include <PapillonNDL/rng_stream.hpp>
 #include <functional>
 #include <memory>
 
@@ -47,6 +48,19 @@ class AngleLaw : public std::enable_shared_from_this<AngleLaw> {
    */
   virtual double sample_mu(const std::function<double()>& rng) const = 0;
 
+  /**
+   * @brief Samples a scattering cosine from the distribution, drawing the
+   *        random numbers directly from an RNGStream. Random numbers are
+   *        then generated inline, without an indirect call for every draw.
+   *        The default implementation forwards to the std::function
+   *        overload, so derived classes which do not override this method
+   *        remain valid.
+   * @param rng Random number stream.
+   */
+  virtual double sample_mu(RNGStream& rng) const {
+    return this->sample_mu(std::function<double()>(std::ref(rng)));
+  }
+
   /**
    * @brief Returns the PDF for the desired scattering cosine.
    * @param mu Scatter cosnine at which to evaluate the PDF.
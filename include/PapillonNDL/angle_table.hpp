@@ -31,6 +31,7 @@
 #include <PapillonNDL/angle_law.hpp>
 #include <PapillonNDL/legendre.hpp>
 #include <PapillonNDL/pctable.hpp>
+#include <cmath>
 #include <functional>
 
 namespace pndl {
@@ -69,7 +70,13 @@ class AngleTable : public AngleLaw {
   AngleTable(const PCTable& table);
   ~AngleTable() = default;
 
-  double sample_mu(const std::function<double()>& rng) const override final;
+  double sample_mu(const std::function<double()>& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
+
+  double sample_mu(RNGStream& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
 
   double pdf(double mu) const override final { return distribution_.pdf(mu); }
 
@@ -101,6 +108,13 @@ class AngleTable : public AngleLaw {
 
  private:
   PCTable distribution_;
+
+  template <class RNG>
+  double sample_mu_impl(RNG& rng) const {
+    double mu = distribution_.sample_value(rng());
+    if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+    return mu;
+  }
 };
 
 }  // namespace pndl
@@ -49,11 +49,22 @@ class CMDistribution : public AngleEnergy {
    *
    */
   CMDistribution(double A, double Q, std::shared_ptr<AngleEnergy> distribution)
-      : awr_(A), q_(Q), distribution_(distribution) {}
+      : awr_(A), q_(Q), kinematics_(A), distribution_(distribution) {}
 
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
+  AngleEnergyPacket sample_angle_energy(double E_in, const EnergyGrid& grid,
+                                        std::size_t i,
+                                        RNGStream& rng) const override final;
+
+  void map_energy_grid(const EnergyGrid& grid) override final {
+    distribution_->map_energy_grid(grid);
+  }
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
@@ -73,9 +84,19 @@ class CMDistribution : public AngleEnergy {
    */
   double q() const { return q_; }
 
+  /**
+   * @brief Returns the kinematic constants used to transform sampled angles
+   *        and energies to the lab frame.
+   */
+  const KinematicConstants& kinematics() const { return kinematics_; }
+
  private:
   double awr_, q_;
+  KinematicConstants kinematics_;
   std::shared_ptr<AngleEnergy> distribution_;
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -0,0 +1,118 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_COMPILED_ANGLE_DISTRIBUTION_H
+#define PAPILLON_NDL_COMPILED_ANGLE_DISTRIBUTION_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/angle_distribution.hpp>
+#include <PapillonNDL/compiled_angle_law.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief A copy of an AngleDistribution, where the angle law at each
+ *        incident energy is stored by value as a CompiledAngleLaw.
+ */
+class CompiledAngleDistribution {
+ public:
+  /**
+   * @param angle AngleDistribution to copy.
+   */
+  CompiledAngleDistribution(const AngleDistribution& angle);
+
+  /**
+   * @brief Samples a scattering cosine for the given energy.
+   * @param E_in Incident energy before scatter, in MeV.
+   * @param rng Random number generator function.
+   */
+  double sample_angle(double E_in, const std::function<double()>& rng) const {
+    return this->sample_angle_impl(E_in, rng);
+  }
+
+  /**
+   * @brief Samples a scattering cosine for the given energy.
+   * @param E_in Incident energy before scatter, in MeV.
+   * @param rng Random number stream.
+   */
+  double sample_angle(double E_in, RNGStream& rng) const {
+    return this->sample_angle_impl(E_in, rng);
+  }
+
+  /**
+   * @brief Returns the number of energies/angular distributions stored.
+   */
+  std::size_t size() const { return energy_grid_.size(); }
+
+  /**
+   * @brief Returns true if all angle laws are stored by value.
+   */
+  bool compiled() const {
+    return std::all_of(laws_.begin(), laws_.end(),
+                       [](const auto& law) { return law.compiled(); });
+  }
+
+ private:
+  std::vector<double> energy_grid_;
+  std::vector<CompiledAngleLaw> laws_;
+
+  template <class RNG>
+  double sample_angle_impl(double E_in, RNG& rng) const {
+    auto E_it =
+        std::lower_bound(energy_grid_.begin(), energy_grid_.end(), E_in);
+    if (E_it == energy_grid_.begin())
+      return laws_.front().sample_mu(rng);
+    else if (E_it == energy_grid_.end())
+      return laws_.back().sample_mu(rng);
+    E_it--;
+
+    // Get index of low energy
+    std::size_t l =
+        static_cast<std::size_t>(std::distance(energy_grid_.begin(), E_it));
+    double f =
+        (E_in - energy_grid_[l]) / (energy_grid_[l + 1] - energy_grid_[l]);
+
+    double mu = 0;
+
+    if (rng() > f)
+      mu = laws_[l].sample_mu(rng);
+    else
+      mu = laws_[l + 1].sample_mu(rng);
+
+    if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+
+    return mu;
+  }
+};
+
+}  // namespace pndl
+
+#endif
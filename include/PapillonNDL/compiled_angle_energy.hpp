@@ -0,0 +1,162 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_COMPILED_ANGLE_ENERGY_H
+#define PAPILLON_NDL_COMPILED_ANGLE_ENERGY_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/compiled_angle_distribution.hpp>
+#include <PapillonNDL/compiled_energy_law.hpp>
+#include <PapillonNDL/frame.hpp>
+#include <PapillonNDL/kalbach.hpp>
+#include <PapillonNDL/multiple_distribution.hpp>
+#include <PapillonNDL/nbody.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/tabular_energy_angle.hpp>
+#include <functional>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief A copy of a secondary angle-energy distribution, where the
+ *        distribution is stored by value, as one of the closed set of
+ *        distributions which may be found in ACE files. Uncorrelated
+ *        distributions are stored with a CompiledAngleDistribution and a
+ *        CompiledEnergyLaw. A MultipleDistribution is flattened into a list
+ *        of compiled distributions with their probabilities, and a
+ *        CMDistribution is replaced by a flag indicating that the sampled
+ *        angle and energy must be transformed to the lab frame. Sampling is
+ *        dispatched with std::visit, so a whole collision may be sampled
+ *        without any virtual calls. Distributions which are not part of the
+ *        closed set are held by pointer, and sampled through the AngleEnergy
+ *        interface.
+ */
+class CompiledAngleEnergy {
+ public:
+  /**
+   * @param distribution Distribution to copy. Any distribution which is not
+   *                     one of the types known to CompiledAngleEnergy must be
+   *                     managed by an std::shared_ptr.
+   */
+  CompiledAngleEnergy(const AngleEnergy& distribution);
+
+  /**
+   * @brief Samples an angle and energy from the distribution.
+   * @param E_in Incident energy in MeV.
+   * @param rng Randum number generation function.
+   * @return Sampled cosine of the scattering angle and energy in an
+   *         AngleEnergyPacket.
+   */
+  AngleEnergyPacket sample_angle_energy(
+      double E_in, const std::function<double()>& rng) const {
+    return this->sample_angle_energy_impl(E_in, rng);
+  }
+
+  /**
+   * @brief Samples an angle and energy from the distribution.
+   * @param E_in Incident energy in MeV.
+   * @param rng Random number stream.
+   * @return Sampled cosine of the scattering angle and energy in an
+   *         AngleEnergyPacket.
+   */
+  AngleEnergyPacket sample_angle_energy(double E_in, RNGStream& rng) const {
+    return this->sample_angle_energy_impl(E_in, rng);
+  }
+
+  /**
+   * @brief Returns the number of distributions which may be sampled.
+   */
+  std::size_t size() const { return laws_.size(); }
+
+  /**
+   * @brief Returns true if the sampled angle and energy are transformed from
+   *        the center of mass frame to the lab frame.
+   */
+  bool center_of_mass() const { return cm_; }
+
+  /**
+   * @brief Returns true if all distributions are stored by value.
+   */
+  bool compiled() const;
+
+ private:
+  // An Uncorrelated distribution, with compiled angle and energy laws
+  struct UncorrelatedLaw {
+    CompiledAngleDistribution angle;
+    CompiledEnergyLaw energy;
+
+    template <class RNG>
+    AngleEnergyPacket sample_angle_energy(double E_in, RNG& rng) const {
+      double mu = angle.sample_angle(E_in, rng);
+      double E_out = energy.sample_energy(E_in, rng);
+      return {mu, E_out};
+    }
+  };
+
+  // Wrapper for distributions which are not part of the closed set
+  struct Virtual {
+    std::shared_ptr<const AngleEnergy> law;
+
+    template <class RNG>
+    AngleEnergyPacket sample_angle_energy(double E_in, RNG& rng) const {
+      return law->sample_angle_energy(E_in, rng);
+    }
+  };
+
+  using Law = std::variant<UncorrelatedLaw, Kalbach, TabularEnergyAngle,
+                           NBody, Virtual>;
+
+  std::vector<Law> laws_;
+  std::shared_ptr<const MultipleDistribution> multiple_;
+  KinematicConstants kinematics_;
+  bool cm_;
+
+  static Law compile(const AngleEnergy& distribution);
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const {
+    // Select the distribution with the table of the MultipleDistribution
+    const Law* law = &laws_.front();
+    if (multiple_) law = &laws_[multiple_->select_distribution(E_in, rng())];
+
+    auto doSample = [&E_in, &rng](const auto& l) {
+      return l.sample_angle_energy(E_in, rng);
+    };
+    AngleEnergyPacket out = std::visit(doSample, *law);
+
+    if (cm_) CMToLab::transform(E_in, kinematics_, out);
+
+    return out;
+  }
+};
+
+}  // namespace pndl
+
+#endif
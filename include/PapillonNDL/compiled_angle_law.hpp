@@ -0,0 +1,118 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_COMPILED_ANGLE_LAW_H
+#define PAPILLON_NDL_COMPILED_ANGLE_LAW_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/angle_law.hpp>
+#include <PapillonNDL/angle_table.hpp>
+#include <PapillonNDL/equiprobable_angle_bins.hpp>
+#include <PapillonNDL/isotropic.hpp>
+#include <PapillonNDL/legendre.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <functional>
+#include <memory>
+#include <variant>
+
+namespace pndl {
+
+/**
+ * @brief A copy of an AngleLaw which is stored by value, as one of the closed
+ *        set of angle laws which may be found in ACE files. Sampling is
+ *        dispatched with std::visit instead of a virtual call, so the
+ *        compiler may inline the sampling method of the law. Angle laws which
+ *        are not part of the closed set are held by pointer, and sampled
+ *        through the AngleLaw interface.
+ */
+class CompiledAngleLaw {
+ public:
+  /**
+   * @param law Angle law to copy. If the law is not one of the types known
+   *            to CompiledAngleLaw, it must be managed by an std::shared_ptr.
+   */
+  CompiledAngleLaw(const AngleLaw& law);
+
+  /**
+   * @brief Samples a scattering cosine from the distribution.
+   * @param rng Random number generator function.
+   */
+  double sample_mu(const std::function<double()>& rng) const {
+    return this->sample_mu_impl(rng);
+  }
+
+  /**
+   * @brief Samples a scattering cosine from the distribution.
+   * @param rng Random number stream.
+   */
+  double sample_mu(RNGStream& rng) const { return this->sample_mu_impl(rng); }
+
+  /**
+   * @brief Returns the PDF for the desired scattering cosine.
+   * @param mu Scatter cosnine at which to evaluate the PDF.
+   */
+  double pdf(double mu) const {
+    auto doPDF = [&mu](const auto& law) { return law.pdf(mu); };
+    return std::visit(doPDF, law_);
+  }
+
+  /**
+   * @brief Returns true if the law is stored by value, and false if it is
+   *        sampled through the AngleLaw interface.
+   */
+  bool compiled() const { return !std::holds_alternative<Virtual>(law_); }
+
+ private:
+  // Wrapper for angle laws which are not part of the closed set
+  struct Virtual {
+    std::shared_ptr<const AngleLaw> law;
+
+    template <class RNG>
+    double sample_mu(RNG& rng) const {
+      return law->sample_mu(rng);
+    }
+
+    double pdf(double mu) const { return law->pdf(mu); }
+  };
+
+  using Law =
+      std::variant<Isotropic, EquiprobableAngleBins, AngleTable, Legendre,
+                   Virtual>;
+
+  Law law_;
+
+  static Law compile(const AngleLaw& law);
+
+  template <class RNG>
+  double sample_mu_impl(RNG& rng) const {
+    auto doSample = [&rng](const auto& law) { return law.sample_mu(rng); };
+    return std::visit(doSample, law_);
+  }
+};
+
+}  // namespace pndl
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_COMPILED_ENERGY_LAW_H
+#define PAPILLON_NDL_COMPILED_ENERGY_LAW_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/discrete_photon.hpp>
+#include <PapillonNDL/energy_law.hpp>
+#include <PapillonNDL/equiprobable_energy_bins.hpp>
+#include <PapillonNDL/evaporation.hpp>
+#include <PapillonNDL/general_evaporation.hpp>
+#include <PapillonNDL/level_inelastic_scatter.hpp>
+#include <PapillonNDL/maxwellian.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/tabular_energy.hpp>
+#include <PapillonNDL/watt.hpp>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <variant>
+
+namespace pndl {
+
+/**
+ * @brief A copy of an EnergyLaw which is stored by value, as one of the
+ *        closed set of energy laws which may be found in ACE files. Sampling
+ *        is dispatched with std::visit instead of a virtual call, so the
+ *        compiler may inline the sampling method of the law. Energy laws
+ *        which are not part of the closed set are held by pointer, and
+ *        sampled through the EnergyLaw interface.
+ */
+class CompiledEnergyLaw {
+ public:
+  /**
+   * @param law Energy law to copy. If the law is not one of the types known
+   *            to CompiledEnergyLaw, it must be managed by an std::shared_ptr.
+   */
+  CompiledEnergyLaw(const EnergyLaw& law);
+
+  /**
+   * @brief Samples an energy (in MeV) from the distribution.
+   * @param E_in Incident energy in MeV.
+   * @param rng Random number generation function.
+   */
+  double sample_energy(double E_in, const std::function<double()>& rng) const {
+    return this->sample_energy_impl(E_in, rng);
+  }
+
+  /**
+   * @brief Samples an energy (in MeV) from the distribution.
+   * @param E_in Incident energy in MeV.
+   * @param rng Random number stream.
+   */
+  double sample_energy(double E_in, RNGStream& rng) const {
+    return this->sample_energy_impl(E_in, rng);
+  }
+
+  /**
+   * @brief Samples the PDF for the energy transfer from E_in to E_out.
+   * @param E_in Incoming energy.
+   * @param E_out Outgoing energy.
+   */
+  std::optional<double> pdf(double E_in, double E_out) const {
+    auto doPDF = [&E_in, &E_out](const auto& law) {
+      return law.pdf(E_in, E_out);
+    };
+    return std::visit(doPDF, law_);
+  }
+
+  /**
+   * @brief Returns true if the law is stored by value, and false if it is
+   *        sampled through the EnergyLaw interface.
+   */
+  bool compiled() const { return !std::holds_alternative<Virtual>(law_); }
+
+ private:
+  // Wrapper for energy laws which are not part of the closed set
+  struct Virtual {
+    std::shared_ptr<const EnergyLaw> law;
+
+    template <class RNG>
+    double sample_energy(double E_in, RNG& rng) const {
+      return law->sample_energy(E_in, rng);
+    }
+
+    std::optional<double> pdf(double E_in, double E_out) const {
+      return law->pdf(E_in, E_out);
+    }
+  };
+
+  using Law = std::variant<LevelInelasticScatter, DiscretePhoton,
+                           EquiprobableEnergyBins, TabularEnergy,
+                           GeneralEvaporation, Evaporation, Maxwellian, Watt,
+                           Virtual>;
+
+  Law law_;
+
+  static Law compile(const EnergyLaw& law);
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, RNG& rng) const {
+    auto doSample = [&E_in, &rng](const auto& law) {
+      return law.sample_energy(E_in, rng);
+    };
+    return std::visit(doSample, law_);
+  }
+};
+
+}  // namespace pndl
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_COMPILED_TABULATED_1D_H
+#define PAPILLON_NDL_COMPILED_TABULATED_1D_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/function_1d.hpp>
+#include <PapillonNDL/interpolation.hpp>
+#include <PapillonNDL/log_hash_table.hpp>
+#include <PapillonNDL/tabulated_1d.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief A copy of a Tabulated1D which is optimized for evaluation. All
+ *        interpolation regions are flattened into a single x/y grid, with
+ *        the interpolation rule stored for each interval, so no search over
+ *        the regions is needed, and the rule is applied with a switch
+ *        instead of an std::variant. Functions with a single linear region
+ *        use a separate path without any dispatch. Long tables with positive
+ *        x values also have a hash table on ln(x), which restricts the search
+ *        for the interval to a few points. The result of the evaluation is
+ *        identical to that of the Tabulated1D.
+ */
+class CompiledTabulated1D : public Function1D {
+ public:
+  /**
+   * @brief Minimum number of points for which the hash table is built.
+   */
+  static constexpr std::size_t HASH_MIN_SIZE = 64;
+
+  /**
+   * @param function Tabulated1D to copy.
+   */
+  CompiledTabulated1D(const Tabulated1D& function);
+
+  double operator()(double x) const override final {
+    if (linlin_) return this->evaluate_impl<true>(x);
+    return this->evaluate_impl<false>(x);
+  }
+
+  double integrate(double x_low, double x_hi) const override final;
+
+  /**
+   * @brief Returns the x grid, with all regions flattened.
+   */
+  const std::vector<double>& x() const { return x_; }
+
+  /**
+   * @brief Returns the y grid, with all regions flattened.
+   */
+  const std::vector<double>& y() const { return y_; }
+
+  /**
+   * @brief Returns the interpolation rule of the interval between points i
+   *        and i+1.
+   * @param i Index of the interval.
+   */
+  Interpolation interpolation(std::size_t i) const { return interp_[i]; }
+
+  /**
+   * @brief Returns true if the function has a single linearly interpolated
+   *        region, and is evaluated without any dispatch.
+   */
+  bool linlin() const { return linlin_; }
+
+  /**
+   * @brief Returns true if the hash table was built.
+   */
+  bool hashed() const { return hash_.size() > 0; }
+
+  /**
+   * @brief Returns the lowest x value in the grid.
+   */
+  double min_x() const { return x_.front(); }
+
+  /**
+   * @brief Returns the highest x value in the grid.
+   */
+  double max_x() const { return x_.back(); }
+
+ private:
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<Interpolation> interp_;
+  // Nonzero for points which are the last point of an interpolation region
+  // of the Tabulated1D, where the tabulated value is returned.
+  std::vector<uint8_t> region_end_;
+  bool linlin_;
+
+  // Hash table on ln(x), which is only built for long grids.
+  LogHashTable hash_;
+
+  // Returns the index of the first x which is not less than x, for
+  // min_x() < x < max_x().
+  std::size_t upper_index(double x) const { return hash_.lower_bound(x_, x); }
+
+  template <bool LINLIN>
+  double evaluate_impl(double x) const {
+    if (x <= x_.front())
+      return y_.front();
+    else if (x >= x_.back())
+      return y_.back();
+
+    const std::size_t hi = this->upper_index(x);
+    const std::size_t low = hi - 1;
+    const double x1 = x_[low];
+    const double x2 = x_[hi];
+    const double y1 = y_[low];
+    const double y2 = y_[hi];
+
+    if constexpr (LINLIN) {
+      return LinLin::interpolate(x, x1, y1, x2, y2);
+    } else {
+      if (x == x2 && region_end_[hi]) return y2;
+
+      switch (interp_[low]) {
+        case Interpolation::Histogram:
+          return Histogram::interpolate(x, x1, y1, x2, y2);
+        case Interpolation::LinLin:
+          return LinLin::interpolate(x, x1, y1, x2, y2);
+        case Interpolation::LinLog:
+          return LinLog::interpolate(x, x1, y1, x2, y2);
+        case Interpolation::LogLin:
+          return LogLin::interpolate(x, x1, y1, x2, y2);
+        case Interpolation::LogLog:
+          return LogLog::interpolate(x, x1, y1, x2, y2);
+      }
+      return y1;
+    }
+  }
+};
+
+}  // namespace pndl
+
+#endif
@@ -30,6 +30,8 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/guide_table.hpp>
+#include <PapillonNDL/jagged_array.hpp>
 
 namespace pndl {
 
@@ -57,8 +59,9 @@ class ContinuousEnergyDiscreteCosines : public AngleEnergy {
     std::vector<double> energy; /**< Outgoing energy points */
     std::vector<double> pdf;    /**< PDF for the outgoing energy */
     std::vector<double> cdf;    /**< CDF for the outgoing energy */
-    std::vector<std::vector<double>>
+    JaggedArray<double>
         cosines; /**< Discrete scattering cosines for each outgoing energy */
+    GuideTable guide; /**< Guide table for sampling the outgoing energy */
 
     /**
      * @brief Samples and outgoing energy from the distributions while
@@ -74,6 +77,9 @@ class ContinuousEnergyDiscreteCosines : public AngleEnergy {
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
@@ -115,10 +121,14 @@ class ContinuousEnergyDiscreteCosines : public AngleEnergy {
   uint32_t Nmu;
   bool unit_based_interpolation_;
 
-  AngleEnergyPacket sample_with_unit_based_interpolation(
-      double E_in, const std::function<double()>& rng) const;
-  AngleEnergyPacket sample_without_unit_based_interpolation(
-      double E_in, const std::function<double()>& rng) const;
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const;
+  template <class RNG>
+  AngleEnergyPacket sample_with_unit_based_interpolation(double E_in,
+                                                         RNG& rng) const;
+  template <class RNG>
+  AngleEnergyPacket sample_without_unit_based_interpolation(double E_in,
+                                                            RNG& rng) const;
 };
 
 }  // namespace pndl
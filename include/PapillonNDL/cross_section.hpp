@@ -31,6 +31,8 @@
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/energy_grid.hpp>
 #include <memory>
+#include <memory_resource>
+#include <span>
 
 namespace pndl {
 
@@ -58,25 +60,38 @@ class CrossSection {
    * @param is_heating Flat to indicate that heating numbers are stored, and not
    *                   cross sections. This allows the storred values to be
    *                   negative without error.
+   * @param memory Memory resource from which the cross section values are
+   *               allocated. The resource is kept alive for as long as the
+   *               values are in use. If nullptr, the global heap is used.
+   *               Default value is nullptr.
    */
   CrossSection(const ACE& ace, std::size_t i,
                std::shared_ptr<EnergyGrid> E_grid, bool get_index = true,
-               bool is_heating = false);
+               bool is_heating = false,
+               std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param xs Vector containing the cross section values.
    * @param E_grid Pointer to EnergyGrid to use for the cross section.
    * @param index Starting index in the energy grid.
+   * @param memory Memory resource from which the cross section values are
+   *               allocated. If nullptr, the global heap is used. Default
+   *               value is nullptr.
    */
   CrossSection(const std::vector<double>& xs,
-               std::shared_ptr<EnergyGrid> E_grid, std::size_t index);
+               std::shared_ptr<EnergyGrid> E_grid, std::size_t index,
+               std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param xs Value for the cross section at all points in the provided
    *           energy grid.
    * @param E_grid Pointer to EnergyGrid to use for the cross section.
+   * @param memory Memory resource from which the cross section value is
+   *               allocated. If nullptr, the global heap is used. Default
+   *               value is nullptr.
    */
-  CrossSection(double xs, std::shared_ptr<EnergyGrid> E_grid);
+  CrossSection(double xs, std::shared_ptr<EnergyGrid> E_grid,
+               std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   ~CrossSection() = default;
 
@@ -222,6 +237,20 @@ class CrossSection {
     return this->operator()(E, i, El, Eh);
   }
 
+  /**
+   * @brief Evaluates the cross section at a batch of energies, with the
+   *        grid points already provided. The points are gathered in blocks
+   *        and interpolated with InterpolationBatch<LinLin>, giving the same
+   *        values as the scalar evaluation. A PNDLException is thrown if
+   *        the spans do not all have the same size.
+   * @param E Energies at which to evaluate the cross section.
+   * @param i Indices of the points for interpolation in the frame of the
+   *          energy grid, one for each energy.
+   * @param xs Evaluated cross sections.
+   */
+  void evaluate(std::span<const double> E, std::span<const std::size_t> i,
+                std::span<double> xs) const;
+
   /**
    * @brief Returns index in the energy grid at which the cross section
    *        values begin.
@@ -245,9 +274,9 @@ class CrossSection {
   double energy(std::size_t i) const { return (*energy_grid_)[index_ + i]; }
 
   /**
-   * @brief Returns the cross section values as a vector of floats.
+   * @brief Returns a view of the cross section values.
    */
-  const std::vector<double>& xs() const { return *values_; }
+  std::span<const double> xs() const { return *values_; }
 
   /**
    * @breif Returns a reference to the EnergyGrid object associated with the
@@ -263,7 +292,7 @@ class CrossSection {
 
  private:
   std::shared_ptr<EnergyGrid> energy_grid_;
-  std::shared_ptr<std::vector<double>> values_;
+  std::shared_ptr<std::pmr::vector<double>> values_;
   std::size_t index_;
   bool single_value_;
 };
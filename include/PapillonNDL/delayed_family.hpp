@@ -68,10 +68,43 @@ class DelayedFamily {
    * @param E Incident energy.
    * @param rng Random number generation function.
    */
-  double sample_energy(double E, std::function<double()> rng) const {
+  double sample_energy(double E, const std::function<double()>& rng) const {
     return energy_->sample_energy(E, rng);
   }
 
+  /**
+   * @brief Samples and energy from the delayed family distribution, drawing
+   *        the random numbers directly from an RNGStream.
+   * @param E Incident energy.
+   * @param rng Random number stream.
+   */
+  double sample_energy(double E, RNGStream& rng) const {
+    return energy_->sample_energy(E, rng);
+  }
+
+  /**
+   * @brief Samples and energy from the delayed family distribution, with the
+   *        interval of the incident energy in the EnergyGrid of the nuclide
+   *        already provided.
+   * @param E Incident energy.
+   * @param grid EnergyGrid in which E has been located.
+   * @param i Index of the interval of the grid which contains E.
+   * @param rng Random number stream.
+   */
+  double sample_energy(double E, const EnergyGrid& grid, std::size_t i,
+                       RNGStream& rng) const {
+    return energy_->sample_energy(E, grid, i, rng);
+  }
+
+  /**
+   * @brief Precomputes the map from the intervals of an EnergyGrid to the
+   *        incident energy intervals of the family's energy distribution.
+   * @param grid EnergyGrid of the nuclide.
+   */
+  void map_energy_grid(const EnergyGrid& grid) {
+    energy_->map_energy_grid(grid);
+  }
+
   /**
    * @brief Returns the EnergyLaw for the family.
    */
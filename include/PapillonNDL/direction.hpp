@@ -0,0 +1,135 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_DIRECTION_H
+#define PAPILLON_NDL_DIRECTION_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/rng_stream.hpp>
+#include <cstddef>
+#include <span>
+
+namespace pndl {
+
+/**
+ * @brief A unit vector for the direction of flight of a particle, with
+ *        methods to rotate the direction by a scattering angle, as is needed
+ *        after every sample of an angle-energy distribution. Batches of
+ *        directions are stored as separate x, y, and z arrays. The rotation
+ *        has no branches, so that the batched methods may be vectorized.
+ *        Directions which are nearly parallel to the z axis are rotated
+ *        about the y axis instead.
+ */
+struct Direction {
+  double x; /**< x component of the direction */
+  double y; /**< y component of the direction */
+  double z; /**< z component of the direction */
+
+  /**
+   * @brief Returns the direction rotated by a scattering angle.
+   * @param mu Cosine of the scattering angle.
+   * @param phi Azimuthal angle of the scattering, in radians.
+   */
+  Direction rotate(double mu, double phi) const {
+    Direction out = *this;
+    Direction::rotate(out.x, out.y, out.z, mu, phi);
+    return out;
+  }
+
+  /**
+   * @brief Returns the direction rotated by a scattering angle, with an
+   *        azimuthal angle which is sampled uniformly over [0, 2pi).
+   * @param mu Cosine of the scattering angle.
+   * @param rng Random number stream, from which one number is drawn.
+   */
+  Direction rotate(double mu, RNGStream& rng) const;
+
+  /**
+   * @brief Rotates a direction by a scattering angle.
+   * @param x x component of the direction, which is rotated upon return.
+   * @param y y component of the direction, which is rotated upon return.
+   * @param z z component of the direction, which is rotated upon return.
+   * @param mu Cosine of the scattering angle.
+   * @param phi Azimuthal angle of the scattering, in radians.
+   */
+  static void rotate(double& x, double& y, double& z, double mu, double phi);
+
+  /**
+   * @brief Rotates a batch of directions by scattering angles. The result for
+   *        each direction is identical to that of the single rotation.
+   * @param x x components of the directions, which are rotated upon return.
+   * @param y y components of the directions, which are rotated upon return.
+   *          Must have the same length as x.
+   * @param z z components of the directions, which are rotated upon return.
+   *          Must have the same length as x.
+   * @param mu Cosines of the scattering angles. Must have the same length as
+   *           x.
+   * @param phi Azimuthal angles of the scatterings, in radians. Must have the
+   *            same length as x.
+   */
+  static void rotate(std::span<double> x, std::span<double> y,
+                     std::span<double> z, std::span<const double> mu,
+                     std::span<const double> phi);
+
+  /**
+   * @brief Rotates a batch of directions by scattering angles, with azimuthal
+   *        angles which are sampled uniformly over [0, 2pi). One random number
+   *        is drawn for each direction, in order, so the result is identical
+   *        to rotating each direction with its own call.
+   * @param x x components of the directions, which are rotated upon return.
+   * @param y y components of the directions, which are rotated upon return.
+   *          Must have the same length as x.
+   * @param z z components of the directions, which are rotated upon return.
+   *          Must have the same length as x.
+   * @param mu Cosines of the scattering angles. Must have the same length as
+   *           x.
+   * @param rng Random number stream.
+   */
+  static void rotate(std::span<double> x, std::span<double> y,
+                     std::span<double> z, std::span<const double> mu,
+                     RNGStream& rng);
+
+ private:
+  // Batches are processed in blocks. The random numbers and the sine and
+  // cosine of the azimuthal angles are computed for the whole block first,
+  // so the loop which carries out the rotations only has arithmetic and
+  // square roots, and may be vectorized.
+  static constexpr std::size_t BLOCK = 64;
+
+  // Rotates a direction, given the cosine and sine of the azimuthal angle. If
+  // the direction is nearly parallel to the z axis, the rotation is carried
+  // out about the y axis instead. This is done by exchanging the roles of
+  // the y and z components, and not by branching.
+  static void rotate_cs(double& x, double& y, double& z, double mu, double c,
+                        double s);
+
+  static void rotate_block(double* x, double* y, double* z, const double* mu,
+                           const double* c, const double* s, std::size_t n);
+};
+
+}  // namespace pndl
+
+#endif
@@ -30,6 +30,8 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/jagged_array.hpp>
+#include <span>
 
 namespace pndl {
 
@@ -45,17 +47,20 @@ class DiscreteCosinesEnergies : public AngleEnergy {
   DiscreteCosinesEnergies(const ACE& ace);
 
   /**
-   * @brief Struct to contain a discrete outgoing energy, with its
+   * @brief Struct to contain a discrete outgoing energy, with a view of its
    *        associated discrete cosines.
    */
   struct DiscreteEnergy {
-    double energy;               /**< Discrete outgoing energy */
-    std::vector<double> cosines; /**< Discrete cosines */
+    double energy;                   /**< Discrete outgoing energy */
+    std::span<const double> cosines; /**< Discrete cosines */
   };
 
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
@@ -74,17 +79,39 @@ class DiscreteCosinesEnergies : public AngleEnergy {
   }
 
   /**
-   * @brief Returns the vector of outgoing energies for all incoming energies.
+   * @brief Returns the number of discrete outgoing energies for each
+   *        incoming energy.
    */
-  const std::vector<std::vector<DiscreteEnergy>>& outgoing_energies() const {
-    return outgoing_energies_;
+  std::size_t num_outgoing_energies() const { return Noe; }
+
+  /**
+   * @brief Returns the discrete outgoing energies for the ith incoming
+   *        energy.
+   * @param i Index to the incoming energy grid.
+   */
+  std::span<const double> outgoing_energies(std::size_t i) const {
+    return outgoing_energies_[i];
+  }
+
+  /**
+   * @brief Returns the jth discrete outgoing energy for the ith incoming
+   *        energy, with its discrete cosines.
+   * @param i Index to the incoming energy grid.
+   * @param j Index of the outgoing energy.
+   */
+  DiscreteEnergy outgoing_energy(std::size_t i, std::size_t j) const {
+    return {outgoing_energies_[i][j], cosines_[i * Noe + j]};
   }
 
  private:
   std::vector<double> incoming_energy_;
-  std::vector<std::vector<DiscreteEnergy>> outgoing_energies_;
+  JaggedArray<double> outgoing_energies_;  // One row per incoming energy
+  JaggedArray<double> cosines_;  // One row per incoming and outgoing energy
   uint32_t Noe, Nmu;
   bool skewed_;
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
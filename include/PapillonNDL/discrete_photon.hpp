@@ -99,6 +99,11 @@ class DiscretePhoton : public EnergyLaw {
     return Eg + (A / (A + 1.)) * E_in;
   }
 
+  double sample_energy(double E_in, RNGStream& /*rng*/) const override final {
+    if ((lp == 0) || (lp == 1)) return Eg;
+    return Eg + (A / (A + 1.)) * E_in;
+  }
+
   std::optional<double> pdf(double /*E_in*/,
                             double /*E_out*/) const override final {
     return std::nullopt;
@@ -70,6 +70,17 @@ class Elastic : public AngleEnergy {
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
+  AngleEnergyPacket sample_angle_energy(double E_in, const EnergyGrid& grid,
+                                        std::size_t i,
+                                        RNGStream& rng) const override final;
+
+  void map_energy_grid(const EnergyGrid& grid) override final {
+    angle_.map_energy_grid(grid);
+  }
+
   std::optional<double> angle_pdf(double /*E_in*/,
                                   double /*mu*/) const override final {
     return std::nullopt;
@@ -161,6 +172,12 @@ class Elastic : public AngleEnergy {
   bool use_tar_;
   double tar_threshold_;
   std::shared_ptr<ElasticDopplerBroadener> broadener_;
+
+ private:
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in,
+                                             const EnergyGrid* grid,
+                                             std::size_t i, RNG& rng) const;
 };
 
 }  // namespace pndl
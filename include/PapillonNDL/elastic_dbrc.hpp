@@ -32,6 +32,7 @@
 #include <PapillonNDL/elastic_doppler_broadener.hpp>
 #include <functional>
 #include <optional>
+#include <vector>
 
 namespace pndl {
 
@@ -47,12 +48,25 @@ class ElasticDBRC : public ElasticDopplerBroadener {
   /**
    * @param xs The 0 Kelvin elastic scattering cross section for the nuclide.
    */
-  ElasticDBRC(const CrossSection& xs) : xs_(xs) {}
+  ElasticDBRC(const CrossSection& xs);
 
   std::array<double, 3> sample_target_velocity(
       const double& Ein, const double& kT, const double& awr,
       const std::function<double()>& rng) const override final;
 
+  std::array<double, 3> sample_target_velocity(
+      const double& Ein, const double& kT, const double& awr,
+      RNGStream& rng) const override final;
+
+  void sample_target_velocities(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      const std::function<double()>& rng,
+      std::span<std::array<double, 3>> vt) const override final;
+
+  void sample_target_velocities(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      RNGStream& rng, std::span<std::array<double, 3>> vt) const override final;
+
   std::string algorithm() const override final;
 
   /**
@@ -61,10 +75,34 @@ class ElasticDBRC : public ElasticDopplerBroadener {
    */
   const CrossSection& elastic_0K_xs() const { return xs_; }
 
+  /**
+   * @brief Returns the maximum of the 0 Kelvin elastic scattering cross
+   *        section over an energy range, which is the majorant used in the
+   *        rejection sampling. This is the larger of the cross section at
+   *        the ends of the range and at all grid points within it.
+   * @param Emin Lower bound of the energy range in MeV.
+   * @param Emax Upper bound of the energy range in MeV.
+   */
+  double max_xs_value(const double& Emin, const double& Emax) const;
+
  private:
   CrossSection xs_;
 
-  double max_xs_value(const double& Emin, const double& Emax) const;
+  // Sparse table for range maximum queries over the cross section values
+  // at the points of the energy grid. Level k holds the maximum of the
+  // 2^k values starting at each grid point, so that the maximum over any
+  // range of grid points is found from only two lookups.
+  std::vector<std::vector<double>> max_table_;
+
+  void build_max_table();
+
+  template <class RNG>
+  std::array<double, 3> sample_target_velocity_impl(
+      const double& Ein, const double& kT, const double& awr, RNG& rng) const;
+  template <class RNG>
+  void sample_target_velocities_impl(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      RNG& rng, std::span<std::array<double, 3>> vt) const;
 };
 
 }  // namespace pndl
@@ -28,9 +28,12 @@
  * @author Hunter Belanger
  */
 
+#include <PapillonNDL/pndl_exception.hpp>
+#include <PapillonNDL/rng_stream.hpp>
 #include <array>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace pndl {
@@ -56,6 +59,72 @@ class ElasticDopplerBroadener
       const double& Ein, const double& kT, const double& awr,
       const std::function<double()>& rng) const = 0;
 
+  /**
+   * @brief Samples the velocity of a target nuclide, drawing the random
+   *        numbers directly from an RNGStream. Random numbers are then
+   *        generated inline, without an indirect call for every draw. The
+   *        default implementation forwards to the std::function overload.
+   * @param Ein Incident energy of the neutron in MeV.
+   * @param kT Temperature of the "free-gas" in MeV.
+   * @param awr Atomic weight ratio of the nuclide.
+   * @param rng Random number stream.
+   */
+  virtual std::array<double, 3> sample_target_velocity(const double& Ein,
+                                                       const double& kT,
+                                                       const double& awr,
+                                                       RNGStream& rng) const {
+    return this->sample_target_velocity(
+        Ein, kT, awr, std::function<double()>(std::ref(rng)));
+  }
+
+  /**
+   * @brief Samples the velocities of target nuclides for a batch of incident
+   *        neutrons, which all scatter off of the same nuclide at the same
+   *        temperature. The default implementation calls
+   *        sample_target_velocity for each neutron, and is the scalar
+   *        reference for the batched implementations.
+   * @param Ein Incident energies of the neutrons in MeV.
+   * @param kT Temperature of the "free-gas" in MeV.
+   * @param awr Atomic weight ratio of the nuclide.
+   * @param rng Random number generator function.
+   * @param vt Span in which the sampled target velocities are written. Must
+   *           be the same size as Ein.
+   */
+  virtual void sample_target_velocities(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      const std::function<double()>& rng,
+      std::span<std::array<double, 3>> vt) const {
+    if (Ein.size() != vt.size()) {
+      std::string mssg = "Ein and vt must have the same size. Ein.size() = " +
+                         std::to_string(Ein.size()) +
+                         ", vt.size() = " + std::to_string(vt.size()) + ".";
+      throw PNDLException(mssg);
+    }
+
+    for (std::size_t i = 0; i < Ein.size(); i++) {
+      vt[i] = this->sample_target_velocity(Ein[i], kT, awr, rng);
+    }
+  }
+
+  /**
+   * @brief Samples the velocities of target nuclides for a batch of incident
+   *        neutrons, drawing the random numbers directly from an RNGStream.
+   *        The default implementation forwards to the std::function
+   *        overload.
+   * @param Ein Incident energies of the neutrons in MeV.
+   * @param kT Temperature of the "free-gas" in MeV.
+   * @param awr Atomic weight ratio of the nuclide.
+   * @param rng Random number stream.
+   * @param vt Span in which the sampled target velocities are written. Must
+   *           be the same size as Ein.
+   */
+  virtual void sample_target_velocities(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      RNGStream& rng, std::span<std::array<double, 3>> vt) const {
+    this->sample_target_velocities(
+        Ein, kT, awr, std::function<double()>(std::ref(rng)), vt);
+  }
+
   /**
    * @brief Returns a string with the abbreviation of the elastic kernel
    *        broadening method.
@@ -0,0 +1,98 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_ELASTIC_RVS_H
+#define PAPILLON_NDL_ELASTIC_RVS_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/cross_section.hpp>
+#include <PapillonNDL/elastic_doppler_broadener.hpp>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief This class uses the Relative Velocity Sampling (RVS) algorithm.
+ *        Like DBRC, it provides an exact treatment for the elastic scattering
+ *        of neutrons off of nuclides which exhibit strong resonance behavior
+ *        at low energies. Instead of sampling a target velocity with SVT and
+ *        rejecting on the ratio of the 0 Kelvin cross section to its maximum,
+ *        the relative energy is sampled directly by inverting a tabulated CDF
+ *        of \f$\sqrt{E_r}\sigma(E_r)\f$, which is built once from the 0 Kelvin
+ *        cross section. The only remaining rejection is on the Maxwellian
+ *        factor of the free-gas kernel, which does not depend on the cross
+ *        section, so the efficiency does not collapse near large resonances.
+ *        The cosine between the incident and relative velocities is then
+ *        sampled directly, from which the target velocity is obtained.
+ */
+class ElasticRVS : public ElasticDopplerBroadener {
+ public:
+  /**
+   * @param xs The 0 Kelvin elastic scattering cross section for the nuclide.
+   */
+  ElasticRVS(const CrossSection& xs);
+
+  std::array<double, 3> sample_target_velocity(
+      const double& Ein, const double& kT, const double& awr,
+      const std::function<double()>& rng) const override final;
+
+  std::array<double, 3> sample_target_velocity(
+      const double& Ein, const double& kT, const double& awr,
+      RNGStream& rng) const override final;
+
+  std::string algorithm() const override final;
+
+  /**
+   * @brief Returns the 0 Kelvin elastic scattering cross section for the
+   *        nuclide.
+   */
+  const CrossSection& elastic_0K_xs() const { return xs_; }
+
+  /**
+   * @brief Returns the cumulative integral of \f$\sqrt{E_r}\sigma(E_r)\f$,
+   *        tabulated at each point of the energy grid of the 0 Kelvin cross
+   *        section.
+   */
+  const std::vector<double>& cdf() const { return cdf_; }
+
+ private:
+  CrossSection xs_;
+  std::vector<double> pdf_;
+  std::vector<double> cdf_;
+
+  double cdf_value(double Er, std::size_t i) const;
+  double invert_cdf(double c, std::size_t i_min, std::size_t i_max) const;
+
+  template <class RNG>
+  std::array<double, 3> sample_target_velocity_impl(
+      const double& Ein, const double& kT, const double& awr, RNG& rng) const;
+};
+
+}  // namespace pndl
+
+#endif
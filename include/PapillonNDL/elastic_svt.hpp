@@ -66,7 +66,29 @@ class ElasticSVT : public ElasticDopplerBroadener {
       const double& Ein, const double& kT, const double& awr,
       const std::function<double()>& rng) const override final;
 
+  std::array<double, 3> sample_target_velocity(
+      const double& Ein, const double& kT, const double& awr,
+      RNGStream& rng) const override final;
+
+  void sample_target_velocities(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      const std::function<double()>& rng,
+      std::span<std::array<double, 3>> vt) const override final;
+
+  void sample_target_velocities(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      RNGStream& rng, std::span<std::array<double, 3>> vt) const override final;
+
   std::string algorithm() const override final;
+
+ private:
+  template <class RNG>
+  std::array<double, 3> sample_target_velocity_impl(
+      const double& Ein, const double& kT, const double& awr, RNG& rng) const;
+  template <class RNG>
+  void sample_target_velocities_impl(
+      std::span<const double> Ein, const double& kT, const double& awr,
+      RNG& rng, std::span<std::array<double, 3>> vt) const;
 };
 
 }  // namespace pndl
@@ -30,17 +30,42 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/guide_table.hpp>
 #include <PapillonNDL/pctable.hpp>
 #include <functional>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <vector>
 
 namespace pndl {
 
 /**
  * @brief Contains the product Angle-Energy distribution for a single
- *        incident energy.
+ *        incident energy. The outgoing energy, PDF, and CDF of each point are
+ *        stored together, and may be shared with other tables, which allows
+ *        all of the tables of a TabularEnergyAngle distribution to be stored
+ *        in a single arena.
  */
 class EnergyAngleTable {
  public:
+  /**
+   * @brief Tabulated values of the outgoing energy distribution for a single
+   *        outgoing energy point.
+   */
+  struct Point {
+    double energy;
+    double pdf;
+    double cdf;
+  };
+
+  /**
+   * @brief Read-only view of a single tabulated quantity, for all of the
+   *        outgoing energy points.
+   */
+  using Column =
+      std::ranges::transform_view<std::span<const Point>, double Point::*>;
+
   /**
    * @param ace ACE file to take data from.
    * @param i Starting index of distribution in the XSS array.
@@ -72,35 +97,20 @@ class EnergyAngleTable {
                    const std::vector<PCTable>& angle_tables);
   ~EnergyAngleTable() = default;
 
+  /**
+   * @brief Moves the outgoing energy points of all tables into a single
+   *        arena, which is then shared by all of the tables.
+   * @param tables Tables to pack into a common arena.
+   */
+  static void pack(std::vector<EnergyAngleTable>& tables);
+
   AngleEnergyPacket sample_angle_energy(
       const std::function<double()>& rng) const {
-    double E_out, mu;
-    double xi = rng();
-    auto cdf_it = std::lower_bound(cdf_.begin(), cdf_.end(), xi);
-    std::size_t l =
-        static_cast<std::size_t>(std::distance(cdf_.begin(), cdf_it) - 1);
-
-    // Must account for case where pdf_[l] = pdf_[l+1], which means  that
-    // the slope is zero, and m=0. This results in nan for the linear alg.
-    // To avoid this, must use histogram for that segment.
-    if (interp_ == Interpolation::Histogram || pdf_[l] == pdf_[l + 1]) {
-      E_out = histogram_interp_energy(xi, l);
-      mu = angles_[l].sample_value(rng());
-      if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
-      return {mu, E_out};
-    }
-
-    E_out = linear_interp_energy(xi, l);
-
-    double f = (xi - cdf_[l]) / (cdf_[l + 1] - cdf_[l]);
-    if (f < 0.5)
-      mu = angles_[l].sample_value(rng());
-    else
-      mu = angles_[l + 1].sample_value(rng());
-
-    if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+    return this->sample_angle_energy_impl(rng);
+  }
 
-    return {mu, E_out};
+  AngleEnergyPacket sample_angle_energy(RNGStream& rng) const {
+    return this->sample_angle_energy_impl(rng);
   }
 
   /**
@@ -110,13 +120,15 @@ class EnergyAngleTable {
   double angle_pdf(double mu) const {
     double pdf_out = 0.;
 
-    for (std::size_t i = 0; i < pdf_.size() - 1; i++) {
+    for (std::size_t i = 0; i < size_ - 1; i++) {
+      const Point& p = points_[i];
+      const Point& p1 = points_[i + 1];
       if (interp_ == Interpolation::Histogram) {
-        pdf_out += angles_[i].pdf(mu) * pdf_[i] * (energy_[i + 1] - energy_[i]);
+        pdf_out += angles_[i].pdf(mu) * p.pdf * (p1.energy - p.energy);
       } else {
-        pdf_out += 0.5 * (energy_[i + 1] - energy_[i]) *
-                   (angles_[i].pdf(mu) * pdf_[i] +
-                    angles_[i + 1].pdf(mu) * pdf_[i + 1]);
+        pdf_out += 0.5 * (p1.energy - p.energy) *
+                   (angles_[i].pdf(mu) * p.pdf +
+                    angles_[i + 1].pdf(mu) * p1.pdf);
       }
     }
 
@@ -130,26 +142,28 @@ class EnergyAngleTable {
    * @param E_out Exit energy.
    */
   double pdf(double mu, double E_out) const {
-    auto E_it = std::lower_bound(energy_.begin(), energy_.end(), E_out);
-    if (E_it == energy_.end()) {
+    const Column E = energy();
+    auto E_it = std::lower_bound(E.begin(), E.end(), E_out);
+    if (E_it == E.end()) {
       return 0.;
-    } else if (E_it == energy_.begin() && E_out < energy_.front()) {
+    } else if (E_it == E.begin() && E_out < E.front()) {
       return 0.;
     }
-    std::size_t l =
-        static_cast<std::size_t>(std::distance(energy_.begin(), E_it));
+    std::size_t l = static_cast<std::size_t>(std::distance(E.begin(), E_it));
     if (E_out != *E_it) l--;
 
     if (interp_ == Interpolation::Histogram) {
       double mu_pdf = angles_[l].pdf(mu);
-      double E_pdf = pdf_[l];
+      double E_pdf = points_[l].pdf;
       return mu_pdf * E_pdf;
     } else {
-      double f = (E_out - energy_[l]) / (energy_[l + 1] - energy_[l]);
+      const Point& p = points_[l];
+      const Point& p1 = points_[l + 1];
+      double f = (E_out - p.energy) / (p1.energy - p.energy);
       double out_pdf = 0;
 
-      out_pdf += f * angles_[l + 1].pdf(mu) * pdf_[l + 1];
-      out_pdf += (1. - f) * angles_[l].pdf(mu) * pdf_[l];
+      out_pdf += f * angles_[l + 1].pdf(mu) * p1.pdf;
+      out_pdf += (1. - f) * angles_[l].pdf(mu) * p.pdf;
 
       return out_pdf;
     }
@@ -158,12 +172,12 @@ class EnergyAngleTable {
   /**
    * @brief Returns the lowest possible outgoing energy in MeV.
    */
-  double min_energy() const { return energy_.front(); }
+  double min_energy() const { return points_[0].energy; }
 
   /**
    *  @brief Returns the highest possible outgoing energy in MeV.
    */
-  double max_energy() const { return energy_.back(); }
+  double max_energy() const { return points_[size_ - 1].energy; }
 
   /**
    * @brief Returns the method of interpolation used for the energy
@@ -172,21 +186,26 @@ class EnergyAngleTable {
   Interpolation interpolation() const { return interp_; }
 
   /**
-   * @brief Returns a vector of the outgoing energy points.
+   * @brief Returns all of the tabulated outgoing energy points.
+   */
+  std::span<const Point> points() const { return {points_, size_}; }
+
+  /**
+   * @brief Returns a view of the outgoing energy points.
    */
-  const std::vector<double>& energy() const { return energy_; }
+  Column energy() const { return Column(points(), &Point::energy); }
 
   /**
-   * @brief Returns a vector for the PDF points corresponding to the
+   * @brief Returns a view of the PDF points corresponding to the
    *        outgoing energy grid.
    */
-  const std::vector<double>& pdf() const { return pdf_; }
+  Column pdf() const { return Column(points(), &Point::pdf); }
 
   /**
-   * @brief Returns a vector for the CDF points corresponding to the
+   * @brief Returns a view of the CDF points corresponding to the
    *        outgoing energy grid.
    */
-  const std::vector<double>& cdf() const { return cdf_; }
+  Column cdf() const { return Column(points(), &Point::cdf); }
 
   /**
    * @brief Returns the ith AngleTable which contains the angular
@@ -198,24 +217,63 @@ class EnergyAngleTable {
   /**
    * @brief Returns the number of outgoing energy points / AngleTables.
    */
-  std::size_t size() const { return energy_.size(); }
+  std::size_t size() const { return size_; }
 
  private:
-  std::vector<double> energy_;
-  std::vector<double> pdf_;
-  std::vector<double> cdf_;
+  std::shared_ptr<const std::vector<Point>> arena_;
+  const Point* points_;
+  std::size_t size_;
   std::vector<PCTable> angles_;
   Interpolation interp_;
+  GuideTable guide_;
+
+  void set_points(const std::vector<double>& energy,
+                  const std::vector<double>& pdf,
+                  const std::vector<double>& cdf);
 
   double histogram_interp_energy(double xi, std::size_t l) const {
-    return energy_[l] + ((xi - cdf_[l]) / pdf_[l]);
+    const Point& p = points_[l];
+    return p.energy + ((xi - p.cdf) / p.pdf);
   }
 
   double linear_interp_energy(double xi, std::size_t l) const {
-    const double m = (pdf_[l + 1] - pdf_[l]) / (energy_[l + 1] - energy_[l]);
-    const double arg = pdf_[l] * pdf_[l] + 2. * m * (xi - cdf_[l]);
+    const Point& p = points_[l];
+    const Point& p1 = points_[l + 1];
+    const double m = (p1.pdf - p.pdf) / (p1.energy - p.energy);
+    const double arg = p.pdf * p.pdf + 2. * m * (xi - p.cdf);
+
+    return p.energy + (1. / m) * (std::sqrt(std::max(arg, 0.)) - p.pdf);
+  }
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(RNG& rng) const {
+    double E_out, mu;
+    double xi = rng();
+    std::size_t l = guide_.lower_bound(cdf(), xi) - 1;
+    const Point& p = points_[l];
+    const Point& p1 = points_[l + 1];
+
+    // Must account for case where pdf[l] = pdf[l+1], which means  that
+    // the slope is zero, and m=0. This results in nan for the linear alg.
+    // To avoid this, must use histogram for that segment.
+    if (interp_ == Interpolation::Histogram || p.pdf == p1.pdf) {
+      E_out = histogram_interp_energy(xi, l);
+      mu = angles_[l].sample_value(rng());
+      if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+      return {mu, E_out};
+    }
+
+    E_out = linear_interp_energy(xi, l);
+
+    double f = (xi - p.cdf) / (p1.cdf - p.cdf);
+    if (f < 0.5)
+      mu = angles_[l].sample_value(rng());
+    else
+      mu = angles_[l + 1].sample_value(rng());
 
-    return energy_[l] + (1. / m) * (std::sqrt(std::max(arg, 0.)) - pdf_[l]);
+    if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+
+    return {mu, E_out};
   }
 };
 
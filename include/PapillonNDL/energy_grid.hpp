@@ -32,6 +32,8 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <vector>
 
 namespace pndl {
@@ -52,16 +54,26 @@ class EnergyGrid : public std::enable_shared_from_this<EnergyGrid> {
    * @param NBINS Number of bins to hash the energy grid into. The
    *              default value is 8192, which is the number of bins
    *              used by MCNP.
+   * @param memory Memory resource from which the grid and hash bins are
+   *               allocated. The resource is kept alive by the EnergyGrid.
+   *               If nullptr, the global heap is used. Default value is
+   *               nullptr.
    */
-  EnergyGrid(const ACE& ace, uint32_t NBINS = 8192);
+  EnergyGrid(const ACE& ace, uint32_t NBINS = 8192,
+             std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param energy Vector of all points in energy grid (sorted).
    * @param NBINS Number of bins to hash the energy grid into. The
    *              default value is 8192, which is the number of bins
    *              used by MCNP.
+   * @param memory Memory resource from which the grid and hash bins are
+   *               allocated. The resource is kept alive by the EnergyGrid.
+   *               If nullptr, the global heap is used. Default value is
+   *               nullptr.
    */
-  EnergyGrid(const std::vector<double>& energy, uint32_t NBINS = 8192);
+  EnergyGrid(const std::vector<double>& energy, uint32_t NBINS = 8192,
+             std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   ~EnergyGrid() = default;
 
@@ -77,9 +89,9 @@ class EnergyGrid : public std::enable_shared_from_this<EnergyGrid> {
   std::size_t size() const { return energy_values_.size(); }
 
   /**
-   * @brief Returns a reference to the energy grid.
+   * @brief Returns a view of the energy grid.
    */
-  const std::vector<double>& grid() const { return energy_values_; }
+  std::span<const double> grid() const { return energy_values_; }
 
   /**
    * @brief Returns the lowest energy in the grid.
@@ -136,8 +148,9 @@ class EnergyGrid : public std::enable_shared_from_this<EnergyGrid> {
   void hash_energy_grid(uint32_t NBINS);
 
  private:
-  std::vector<double> energy_values_;
-  std::vector<uint32_t> bin_pointers_;
+  std::shared_ptr<std::pmr::memory_resource> memory_;
+  std::pmr::vector<double> energy_values_;
+  std::pmr::vector<uint32_t> bin_pointers_;
   double u_min, du;
   double urr_start_energy_;
 };
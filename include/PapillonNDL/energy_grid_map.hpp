@@ -0,0 +1,137 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_ENERGY_GRID_MAP_H
+#define PAPILLON_NDL_ENERGY_GRID_MAP_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/energy_grid.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief Maps the intervals of one or more EnergyGrid instances to the
+ *        intervals of the incident energy grid of a secondary distribution.
+ *        Once a nuclide has located an incident energy in its EnergyGrid,
+ *        the distribution may then find its own incident energy interval
+ *        without a search. Distributions are shared between temperatures, so
+ *        a separate map is kept for each EnergyGrid which is added.
+ */
+class EnergyGridMap {
+ public:
+  EnergyGridMap() = default;
+
+  /**
+   * @brief Adds a map for an EnergyGrid. Nothing is done if the grid has
+   *        already been mapped.
+   * @param grid EnergyGrid to map.
+   * @param energy Incident energy grid of the distribution.
+   */
+  void add(const EnergyGrid& grid, std::span<const double> energy);
+
+  /**
+   * @brief Returns true if the EnergyGrid has been mapped.
+   * @param grid EnergyGrid to check.
+   */
+  bool has(const EnergyGrid& grid) const {
+    return this->find(grid) != nullptr;
+  }
+
+  /**
+   * @brief Returns the number of EnergyGrid instances which are mapped.
+   */
+  std::size_t size() const { return maps_.size(); }
+
+  /**
+   * @brief Returns the index of the first point of the incident energy grid
+   *        which is not less than E, found with a binary search.
+   * @param energy Incident energy grid of the distribution.
+   * @param E Incident energy.
+   */
+  static std::size_t lower_bound(std::span<const double> energy, double E) {
+    return static_cast<std::size_t>(
+        std::lower_bound(energy.begin(), energy.end(), E) - energy.begin());
+  }
+
+  /**
+   * @brief Returns the index of the first point of the incident energy grid
+   *        which is not less than E, which is identical to the result of
+   *        std::lower_bound. If the EnergyGrid is mapped, the index is found
+   *        from the interval of the EnergyGrid, and otherwise with a search.
+   * @param energy Incident energy grid of the distribution.
+   * @param E Incident energy.
+   * @param grid EnergyGrid in which E has been located.
+   * @param i Index of the interval of the EnergyGrid which contains E, as
+   *          returned by EnergyGrid::get_lower_index.
+   */
+  std::size_t lower_bound(std::span<const double> energy, double E,
+                          const EnergyGrid& grid, std::size_t i) const {
+    const Map* map = this->find(grid);
+    if (map == nullptr) return lower_bound(energy, E);
+
+    std::size_t l = 0;
+    if (i >= map->begin + map->indices.size()) {
+      l = energy.size();
+    } else if (i >= map->begin) {
+      l = map->indices[i - map->begin];
+    }
+
+    // Incident energies of the distribution may lie within the interval of
+    // the EnergyGrid. Both directions are checked, so that the result is
+    // exact even if i is not the interval which contains E.
+    while (l < energy.size() && energy[l] < E) l++;
+    while (l > 0 && energy[l - 1] >= E) l--;
+    return l;
+  }
+
+ private:
+  // For each interval i of the EnergyGrid, with begin <= i < begin + size,
+  // the index of the first incident energy greater than grid[i]. Intervals
+  // below begin map to zero, and those past the end to the number of
+  // incident energies.
+  struct Map {
+    const EnergyGrid* grid;
+    std::size_t begin;
+    std::vector<uint32_t> indices;
+  };
+
+  std::vector<Map> maps_;
+
+  const Map* find(const EnergyGrid& grid) const {
+    for (const auto& map : maps_) {
+      if (map.grid == &grid) return &map;
+    }
+    return nullptr;
+  }
+};
+
+}  // namespace pndl
+
+#endif
@@ -28,12 +28,16 @@
  * @author Hunter Belanger
  */
 
+#include <PapillonNDL/rng_stream.hpp>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
 
 namespace pndl {
 
+class EnergyGrid;
+
 /**
  * @brief Interface to represent uncorrelated energy distributions.
  */
@@ -49,6 +53,43 @@ class EnergyLaw : public std::enable_shared_from_this<EnergyLaw> {
   virtual double sample_energy(double E_in,
                                const std::function<double()>& rng) const = 0;
 
+  /**
+   * @brief Samples an energy (in MeV) from the distribution, drawing the
+   *        random numbers directly from an RNGStream. Random numbers are
+   *        then generated inline, without an indirect call for every draw.
+   *        The default implementation forwards to the std::function
+   *        overload, so derived classes which do not override this method
+   *        remain valid.
+   * @param E_in Incident energy in MeV.
+   * @param rng Random number stream.
+   */
+  virtual double sample_energy(double E_in, RNGStream& rng) const {
+    return this->sample_energy(E_in, std::function<double()>(std::ref(rng)));
+  }
+
+  /**
+   * @brief Samples an energy (in MeV) from the distribution, with the
+   *        interval of the incident energy in the EnergyGrid of the nuclide
+   *        already provided. The default implementation ignores the grid
+   *        index, and forwards to the RNGStream overload.
+   * @param E_in Incident energy in MeV.
+   * @param grid EnergyGrid in which E_in has been located.
+   * @param i Index of the interval of the grid which contains E_in.
+   * @param rng Random number stream.
+   */
+  virtual double sample_energy(double E_in, const EnergyGrid& /*grid*/,
+                               std::size_t /*i*/, RNGStream& rng) const {
+    return this->sample_energy(E_in, rng);
+  }
+
+  /**
+   * @brief Precomputes the map from the intervals of an EnergyGrid to the
+   *        incident energy intervals of the distribution. The default
+   *        implementation does nothing.
+   * @param grid EnergyGrid of the nuclide.
+   */
+  virtual void map_energy_grid(const EnergyGrid& /*grid*/) {}
+
   /**
    * @brief Samples the PDF for the energy transfer from E_in to E_out where
    *        E_in is provided in the lab frame, and E_out is provided in the
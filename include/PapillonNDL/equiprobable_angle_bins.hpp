@@ -30,6 +30,7 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_law.hpp>
+#include <cmath>
 
 namespace pndl {
 
@@ -50,7 +51,13 @@ class EquiprobableAngleBins : public AngleLaw {
   EquiprobableAngleBins(const std::vector<double>& bounds);
   ~EquiprobableAngleBins() = default;
 
-  double sample_mu(const std::function<double()>& rng) const override final;
+  double sample_mu(const std::function<double()>& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
+
+  double sample_mu(RNGStream& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
 
   double pdf(double mu) const override final;
 
@@ -70,6 +77,21 @@ class EquiprobableAngleBins : public AngleLaw {
   static constexpr size_t NBOUNDS = 33;
   static constexpr size_t NBINS = 32;
   static constexpr double P_BIN = 1. / 32.;
+
+  template <class RNG>
+  double sample_mu_impl(RNG& rng) const {
+    const double xi = rng();
+    std::size_t bin = static_cast<std::size_t>(
+        std::floor(static_cast<double>(NBOUNDS) * xi));
+    if (bin == NBOUNDS) bin--;
+    double C_b = static_cast<double>(bin) * P_BIN;
+    double mu_low = bounds_[bin];
+    double mu = ((xi - C_b) / P_BIN) + mu_low;
+
+    if (std::abs(mu) > 1.) mu = std::copysign(1, mu);
+
+    return mu;
+  }
 };
 
 }  // namespace pndl
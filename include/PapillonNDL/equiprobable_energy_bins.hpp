@@ -30,7 +30,11 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/energy_law.hpp>
+#include <PapillonNDL/energy_grid_map.hpp>
+#include <PapillonNDL/jagged_array.hpp>
+#include <cmath>
 #include <optional>
+#include <span>
 
 namespace pndl {
 
@@ -54,8 +58,26 @@ class EquiprobableEnergyBins : public EnergyLaw {
                          const std::vector<std::vector<double>>& bin_bounds);
   ~EquiprobableEnergyBins() = default;
 
-  double sample_energy(double E_in,
-                       const std::function<double()>& rng) const override final;
+  double sample_energy(double E_in, const std::function<double()>& rng)
+      const override final {
+    return this->sample_energy_impl(
+        E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+  }
+
+  double sample_energy(double E_in, RNGStream& rng) const override final {
+    return this->sample_energy_impl(
+        E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+  }
+
+  double sample_energy(double E_in, const EnergyGrid& grid, std::size_t i,
+                       RNGStream& rng) const override final {
+    return this->sample_energy_impl(
+        E_in, grid_map_.lower_bound(incoming_energy_, E_in, grid, i), rng);
+  }
+
+  void map_energy_grid(const EnergyGrid& grid) override final {
+    grid_map_.add(grid, incoming_energy_);
+  }
 
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
@@ -68,10 +90,10 @@ class EquiprobableEnergyBins : public EnergyLaw {
   }
 
   /**
-   * @brief Returns the ith set of bin boundaries as a vector.
+   * @brief Returns the ith set of bin boundaries as a span.
    * @param i Index for the incoming energy grid.
    */
-  const std::vector<double>& bin_bounds(std::size_t i) const {
+  std::span<const double> bin_bounds(std::size_t i) const {
     return bin_sets_[i];
   }
 
@@ -82,12 +104,39 @@ class EquiprobableEnergyBins : public EnergyLaw {
 
  private:
   std::vector<double> incoming_energy_;
-  std::vector<std::vector<double>> bin_sets_;
+  JaggedArray<double> bin_sets_;
+  EnergyGridMap grid_map_;
 
   double sample_bins(double xi1, double xi2,
-                     const std::vector<double>& bounds) const;
+                     std::span<const double> bounds) const {
+    // There is one less bin than the number of bounds
+    std::size_t bin = static_cast<std::size_t>(
+        std::floor(static_cast<double>(bounds.size() - 1) * xi1));
+    return (bounds[bin + 1] - bounds[bin]) * xi2 + bounds[bin];
+  }
+
+  double pdf_bins(double E_out, std::span<const double> bounds) const;
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, std::size_t indx, RNG& rng) const {
+    // Determine the index of the bounding tabulated incoming energies
+    if (indx == 0) {
+      return sample_bins(rng(), rng(), bin_sets_.front());
+    } else if (indx == incoming_energy_.size()) {
+      return sample_bins(rng(), rng(), bin_sets_.back());
+    }
 
-  double pdf_bins(double E_out, const std::vector<double>& bounds) const;
+    std::size_t l = indx - 1;
+
+    double f = (E_in - incoming_energy_[l]) /
+               (incoming_energy_[l + 1] - incoming_energy_[l]);
+
+    if (rng() > f) {
+      return sample_bins(rng(), rng(), bin_sets_[l]);
+    } else {
+      return sample_bins(rng(), rng(), bin_sets_[l + 1]);
+    }
+  }
 };
 
 }  // namespace pndl
@@ -29,6 +29,7 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/energy_law.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
 #include <memory>
@@ -57,6 +58,8 @@ class Evaporation : public EnergyLaw {
   double sample_energy(double E_in,
                        const std::function<double()>& rng) const override final;
 
+  double sample_energy(double E_in, RNGStream& rng) const override final;
+
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
   /**
@@ -70,9 +73,32 @@ class Evaporation : public EnergyLaw {
    */
   double U() const { return restriction_energy_; }
 
+  /**
+   * @brief Selects the sampling method. The analytic sampler, which rejects
+   *        energies above the restriction energy, is the default. When
+   *        tabulated, the reduced evaporation spectrum is instead sampled
+   *        from an inverse CDF tabulated once for all instances, restricted
+   *        without any rejection. The tabulated samples follow the same
+   *        distribution to within the interpolation error of the table, but
+   *        are not identical to the analytic samples.
+   * @param tabulated True to sample from the tabulated inverse CDF.
+   */
+  void set_tabulated(bool tabulated);
+
+  /**
+   * @brief Returns true if the spectrum is sampled from the tabulated
+   *        inverse CDF.
+   */
+  bool tabulated() const { return tabulated_; }
+
  private:
   std::shared_ptr<Tabulated1D> temperature_;
+  std::shared_ptr<CompiledTabulated1D> compiled_temperature_;
   double restriction_energy_;
+  bool tabulated_;
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -30,16 +30,34 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/cross_section.hpp>
 #include <PapillonNDL/delayed_family.hpp>
 #include <PapillonNDL/energy_grid.hpp>
 #include <PapillonNDL/function_1d.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
 #include <PapillonNDL/reaction.hpp>
+#include <PapillonNDL/rng_stream.hpp>
 #include <PapillonNDL/zaid.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <string>
 #include <vector>
 
 namespace pndl {
 
+/**
+ * @brief Holds the angle and energy of a neutron sampled from a fission
+ *        event, along with the family from which it was emitted.
+ */
+struct FissionNeutron {
+  double cosine_angle; /**< Sampled cosine of the angle in the lab frame */
+  double energy;       /**< Sampled outgoing energy in MeV */
+  uint32_t family; /**< Zero for a prompt neutron, or g for delayed family g,
+                        which is delayed_family(g - 1) */
+};
+
 /**
  * @brief This class contains all of the information for the nuclide which is
  * related to
@@ -49,16 +67,24 @@ class Fission {
   /**
    * @param ace ACE file from which to construct the data.
    * @param energy_grid Pointer to the EnergyGrid for the nuclide.
+   * @param memory Memory resource from which the fission cross sections are
+   *               allocated. If nullptr, the global heap is used. Default
+   *               value is nullptr.
    */
-  Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid);
+  Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
+          std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param ace ACE file from which to construct the data.
    * @param energy_grid Pointer to the EnergyGrid for the nuclide.
    * @param fission Fission object to take distributions from.
+   * @param memory Memory resource from which the fission cross sections are
+   *               allocated. If nullptr, the global heap is used. Default
+   *               value is nullptr.
    */
   Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
-          const Fission& fission);
+          const Fission& fission,
+          std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @brief Returns the function for total nu.
@@ -75,6 +101,44 @@ class Fission {
    */
   const Function1D& nu_delayed() const { return *nu_delayed_; }
 
+  /**
+   * @brief Evaluates total nu, with the grid point already provided. Nu is
+   *        tabulated on the EnergyGrid of the nuclide when the Fission
+   *        instance is constructed, and is linearly interpolated between the
+   *        grid points, just like the cross sections. Between grid points,
+   *        the result may therefore differ slightly from that of nu_total().
+   * @param E Incident energy in MeV.
+   * @param i Index of the interval of the EnergyGrid which contains E.
+   */
+  double nu_total(double E, std::size_t i) const {
+    return nu_total_grid_->evaluate(E, i);
+  }
+
+  /**
+   * @brief Evaluates prompt nu, with the grid point already provided. This
+   *        is the difference of the tabulated total and delayed nu.
+   * @param E Incident energy in MeV.
+   * @param i Index of the interval of the EnergyGrid which contains E.
+   */
+  double nu_prompt(double E, std::size_t i) const {
+    return nu_total_grid_->evaluate(E, i) - nu_delayed_grid_->evaluate(E, i);
+  }
+
+  /**
+   * @brief Evaluates delayed nu, with the grid point already provided, from
+   *        its tabulation on the EnergyGrid of the nuclide.
+   * @param E Incident energy in MeV.
+   * @param i Index of the interval of the EnergyGrid which contains E.
+   */
+  double nu_delayed(double E, std::size_t i) const {
+    return nu_delayed_grid_->evaluate(E, i);
+  }
+
+  /**
+   * @brief Returns total nu, as tabulated on the EnergyGrid of the nuclide.
+   */
+  const CrossSection& tabulated_nu_total() const { return *nu_total_grid_; }
+
   /**
    * @brief Returns the prompt spectrum for fission neutrons.
    */
@@ -93,6 +157,81 @@ class Fission {
     return delayed_families_[i];
   }
 
+  /**
+   * @brief Selects the delayed family from which a delayed neutron is
+   *        emitted, returning its index for delayed_family. The family
+   *        probabilities are normalized by their sum. When all of them are
+   *        linearly interpolated, their partial sums are tabulated at the
+   *        union of the incident energies of all families when the Fission
+   *        instance is constructed, and xi times the interpolated sum of all
+   *        families is compared to the interpolated partial sums. Otherwise,
+   *        the probability of every family is evaluated. A PNDLException is
+   *        thrown if there are no delayed families.
+   * @param E_in Incident energy in MeV.
+   * @param xi Random number in the interval [0, 1).
+   */
+  std::size_t select_delayed_family(double E_in, double xi) const {
+    const std::size_t NG = delayed_families_.size();
+
+    if (NG == 0) {
+      std::string mssg =
+          "Cannot select a delayed family, as the nuclide has none.";
+      throw PNDLException(mssg);
+    }
+
+    if (family_sums_.empty()) {
+      double P = 0.;
+      for (const auto& family : delayed_families_) {
+        P += std::max(family.probability()(E_in), 0.);
+      }
+
+      // If all probabilities are zero, the families are equally likely
+      double sum = 0.;
+      for (std::size_t g = 0; g + 1 < NG; g++) {
+        sum += std::max(delayed_families_[g].probability()(E_in), 0.);
+        const double cdf = P > 0. ? sum / P
+                                  : static_cast<double>(g + 1) /
+                                        static_cast<double>(NG);
+        if (xi < cdf) return g;
+      }
+      return NG - 1;
+    }
+
+    // The partial sums at E_in are L + (E_in - E_low) * (H - L) / dE, for
+    // the sums L and H at the bounds of the interval. Both sides of each
+    // comparison are multiplied by dE, which is positive.
+    std::size_t p = 0;
+    double dE = 1.;
+    double t = 0.;
+    if (E_in >= family_energy_.back()) {
+      p = family_energy_.size() - 1;
+    } else if (E_in > family_energy_.front()) {
+      p = static_cast<std::size_t>(std::upper_bound(family_energy_.begin(),
+                                                    family_energy_.end(),
+                                                    E_in) -
+                                   family_energy_.begin()) -
+          1;
+      dE = family_energy_[p + 1] - family_energy_[p];
+      t = E_in - family_energy_[p];
+    }
+
+    const double* low = family_sums_.data() + NG * p;
+    const double* hi = t > 0. ? low + NG : low;
+    const double P = low[NG - 1] * dE + (hi[NG - 1] - low[NG - 1]) * t;
+
+    // If all probabilities are zero, the families are equally likely
+    if (P <= 0.) {
+      const double NGd = static_cast<double>(NG);
+      return std::min(static_cast<std::size_t>(xi * NGd), NG - 1);
+    }
+
+    const double xi_P = xi * P;
+    for (std::size_t g = 0; g + 1 < NG; g++) {
+      if (xi_P < low[g] * dE + (hi[g] - low[g]) * t) return g;
+    }
+    return NG - 1;
+  }
+
   /**
    * @brief Returns a list of fission reactions present.
    */
@@ -119,6 +258,58 @@ class Fission {
       return false;
   }
 
+  /**
+   * @brief Precomputes the map from the intervals of an EnergyGrid to the
+   *        incident energy intervals of the neutron distributions of all
+   *        fission reactions.
+   * @param grid EnergyGrid of the nuclide.
+   */
+  void map_energy_grid(const EnergyGrid& grid) {
+    for (auto* mt : {&mt18_, &mt19_, &mt20_, &mt21_, &mt38_}) {
+      if (*mt) (*mt)->map_energy_grid(grid);
+    }
+    for (auto& family : delayed_families_) family.map_energy_grid(grid);
+  }
+
+  /**
+   * @brief Samples all of the neutrons emitted by a number of fission events
+   *        at the same incident energy. For each event, the number of
+   *        neutrons is sampled from total nu, and each neutron is then
+   *        determined to be prompt or delayed, from the ratio of delayed to
+   *        total nu. The delayed family is selected from the family
+   *        probabilities. Prompt neutrons are sampled from the prompt
+   *        spectrum, and delayed neutrons are emitted isotropically with an
+   *        energy from the spectrum of their family. Nu is evaluated once
+   *        for all of the events.
+   * @param E_in Incident energy in MeV.
+   * @param i Index of the interval of the EnergyGrid of the nuclide which
+   *          contains E_in, as returned by EnergyGrid::get_lower_index.
+   * @param n Number of fission events.
+   * @param rng Random number stream.
+   * @param neutrons Vector to which the sampled neutrons are appended.
+   * @return Number of neutrons which were appended.
+   */
+  std::size_t sample_fission_neutrons(
+      double E_in, std::size_t i, std::size_t n, RNGStream& rng,
+      std::vector<FissionNeutron>& neutrons) const;
+
+  /**
+   * @brief Samples all of the neutrons emitted by a number of fission events
+   *        at the same incident energy, locating the incident energy in the
+   *        EnergyGrid of the nuclide with a search.
+   * @param E_in Incident energy in MeV.
+   * @param n Number of fission events.
+   * @param rng Random number stream.
+   * @param neutrons Vector to which the sampled neutrons are appended.
+   * @return Number of neutrons which were appended.
+   */
+  std::size_t sample_fission_neutrons(
+      double E_in, std::size_t n, RNGStream& rng,
+      std::vector<FissionNeutron>& neutrons) const {
+    return this->sample_fission_neutrons(
+        E_in, energy_grid_->get_lower_index(E_in), n, rng, neutrons);
+  }
+
   /**
    * @brief Retrieves a given MT fission reaction. The only MT values which
    *        could possibly be present are 18, 19, 20, 21, and 38 (check with
@@ -148,9 +339,12 @@ class Fission {
 
  private:
   ZAID zaid_;
+  std::shared_ptr<EnergyGrid> energy_grid_;
   std::shared_ptr<Function1D> nu_total_;
   std::shared_ptr<Function1D> nu_prompt_;
   std::shared_ptr<Function1D> nu_delayed_;
+  std::shared_ptr<CrossSection> nu_total_grid_;
+  std::shared_ptr<CrossSection> nu_delayed_grid_;
   std::shared_ptr<STReaction> mt18_;
   std::shared_ptr<STReaction> mt19_;
   std::shared_ptr<STReaction> mt20_;
@@ -158,12 +352,23 @@ class Fission {
   std::shared_ptr<STReaction> mt38_;
   std::shared_ptr<const AngleEnergy> prompt_spectrum_;
   std::vector<DelayedFamily> delayed_families_;
+  // Union of the incident energies of the delayed family probabilities, and
+  // for each energy, the partial sums of the probabilities of the families.
+  // The last sum of each energy is the sum of all probabilities, which is
+  // not normalized. Both are empty if any probability is not linearly
+  // interpolated.
+  std::vector<double> family_energy_;
+  std::vector<double> family_sums_;
   std::vector<uint32_t> mt_list_;
 
   // Private helper methods
   std::shared_ptr<Function1D> read_nu(const ACE& ace, std::size_t i);
   std::shared_ptr<Function1D> read_polynomial_nu(const ACE& ace, std::size_t i);
   std::shared_ptr<Function1D> read_tabular_nu(const ACE& ace, std::size_t i);
+  void tabulate_delayed_families();
+  std::shared_ptr<CrossSection> tabulate_nu(
+      const Function1D& nu,
+      std::shared_ptr<std::pmr::memory_resource> memory) const;
 };
 
 }  // namespace pndl
@@ -29,9 +29,13 @@
  */
 
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
+#include <string>
 
 namespace pndl {
 
@@ -44,13 +48,34 @@ enum class Frame : uint32_t {
   CM = 2,  /**< Center of Mass frame */
 };
 
+/**
+ * @brief Constants of the frame transformations which depend only on the
+ *        atomic weight ratio of the target nuclide. They should be computed
+ *        once for each reaction, and not for every transformation.
+ */
+struct KinematicConstants {
+  /**
+   * @param A Atomic weight ratio of the target nuclide.
+   */
+  KinematicConstants(double A)
+      : awr(A),
+        awr_p1(A + 1.),
+        awr_p1_sqr((A + 1.) * (A + 1.)),
+        inv_awr_p1(1. / (A + 1.)) {}
+
+  double awr;        /**< Atomic weight ratio, A */
+  double awr_p1;     /**< A + 1 */
+  double awr_p1_sqr; /**< (A + 1)^2 */
+  double inv_awr_p1; /**< 1 / (A + 1) */
+};
+
 /**
  * @brief A struct contianing helper methods to convert scattering angle and
  *        energies provided in the center of mass frame, to the lab frame.
  */
 struct CMToLab {
   /**
-   * @brief Transfrom mu and Eout from the CM frame to the Lab frame.
+   * @brief Transform mu and Eout from the CM frame to the Lab frame.
    * @param Ein Incident energy of the particle.
    * @param A Atomic weight ratio of the target nuclide.
    * @param mu Scattering angle in the center of mass frame. The value
@@ -61,18 +86,34 @@ struct CMToLab {
    *             upon return.
    */
   static void transform(double Ein, double A, double& mu, double& Eout) {
-    double Eout_lab =
-        Eout + (Ein + 2. * mu * (A + 1.) * std::sqrt(Ein * Eout)) /
-                   std::pow(A + 1., 2.);
+    CMToLab::transform(Ein, KinematicConstants(A), mu, Eout);
+  }
+
+  /**
+   * @brief Transform mu and Eout from the CM frame to the Lab frame.
+   * @param Ein Incident energy of the particle.
+   * @param k Kinematic constants of the target nuclide.
+   * @param mu Scattering angle in the center of mass frame. The value
+   *           is changed to the scattering angle in the lab frame
+   *           upon return.
+   * @param Eout Scattering energy in the center of mass frame. The value
+   *             is changed to the scattering energy in the lab frame
+   *             upon return.
+   */
+  static void transform(double Ein, const KinematicConstants& k, double& mu,
+                        double& Eout) {
+    const double sqrt_Ein = std::sqrt(Ein);
+    const double sqrt_Eout = std::sqrt(Eout);
+    const double Eout_lab =
+        Eout + (Ein + 2. * mu * k.awr_p1 * sqrt_Ein * sqrt_Eout) / k.awr_p1_sqr;
 
-    mu = mu * std::sqrt(Eout / Eout_lab) +
-         (1. / (A + 1.)) * std::sqrt(Ein / Eout_lab);
+    mu = (mu * sqrt_Eout + k.inv_awr_p1 * sqrt_Ein) / std::sqrt(Eout_lab);
 
     Eout = Eout_lab;
   }
 
   /**
-   * @brief Transfrom an AngleEnergyPacket from the CM frame to the Lab frame.
+   * @brief Transform an AngleEnergyPacket from the CM frame to the Lab frame.
    * @param Ein Incident energy of the particle.
    * @param A Atomic weight ratio of the target nuclide.
    * @param ae AngleEnergyPacket which initially contains the scattering angle
@@ -83,6 +124,62 @@ struct CMToLab {
     CMToLab::transform(Ein, A, ae.cosine_angle, ae.energy);
   }
 
+  /**
+   * @brief Transform an AngleEnergyPacket from the CM frame to the Lab frame.
+   * @param Ein Incident energy of the particle.
+   * @param k Kinematic constants of the target nuclide.
+   * @param ae AngleEnergyPacket which initially contains the scattering angle
+   *           and energy in the CM frame, which is changed to the lab frame
+   *           upon return.
+   */
+  static void transform(double Ein, const KinematicConstants& k,
+                        AngleEnergyPacket& ae) {
+    CMToLab::transform(Ein, k, ae.cosine_angle, ae.energy);
+  }
+
+  /**
+   * @brief Transforms an array of AngleEnergyPackets from the CM frame to the
+   *        Lab frame, all with the same incident energy. The result for each
+   *        packet is identical to that of the single packet transformation.
+   * @param Ein Incident energy of the particles.
+   * @param k Kinematic constants of the target nuclide.
+   * @param ae AngleEnergyPackets which initially contain the scattering
+   *           angles and energies in the CM frame, which are changed to the
+   *           lab frame upon return.
+   */
+  static void transform(double Ein, const KinematicConstants& k,
+                        std::span<AngleEnergyPacket> ae) {
+    for (std::size_t i = 0; i < ae.size(); i++) {
+      CMToLab::transform(Ein, k, ae[i].cosine_angle, ae[i].energy);
+    }
+  }
+
+  /**
+   * @brief Transforms an array of AngleEnergyPackets from the CM frame to the
+   *        Lab frame. The result for each packet is identical to that of the
+   *        single packet transformation.
+   * @param Ein Incident energy of each particle. Must have the same length as
+   *            ae, otherwise a PNDLException is thrown.
+   * @param k Kinematic constants of the target nuclide.
+   * @param ae AngleEnergyPackets which initially contain the scattering
+   *           angles and energies in the CM frame, which are changed to the
+   *           lab frame upon return.
+   */
+  static void transform(std::span<const double> Ein,
+                        const KinematicConstants& k,
+                        std::span<AngleEnergyPacket> ae) {
+    if (Ein.size() != ae.size()) {
+      std::string mssg = "Ein and ae must have the same size. Ein.size() = " +
+                         std::to_string(Ein.size()) +
+                         ", ae.size() = " + std::to_string(ae.size()) + ".";
+      throw PNDLException(mssg);
+    }
+
+    for (std::size_t i = 0; i < ae.size(); i++) {
+      CMToLab::transform(Ein[i], k, ae[i].cosine_angle, ae[i].energy);
+    }
+  }
+
   /**
    * @brief Computes the Jacobian to transform the angular PDF from the center
    *        of mass frame, to the lab frame. This quantity is dmu_cm/dmu_lab.
@@ -93,11 +190,57 @@ struct CMToLab {
    * @param Eout Scattering energy in the lab frame.
    */
   static double angle_jacobian(double Ein, double A, double mu, double Eout) {
-    double C = Ein + 2. * (A + 1.) * std::sqrt(Ein * Eout) *
-                         (mu - (1. / (A + 1.)) * std::sqrt(Ein / Eout));
-    double Eout_cm = Eout - (C / ((A + 1.) * (A + 1.)));
+    return CMToLab::angle_jacobian(Ein, KinematicConstants(A), mu, Eout);
+  }
+
+  /**
+   * @brief Computes the Jacobian to transform the angular PDF from the center
+   *        of mass frame, to the lab frame. This quantity is dmu_cm/dmu_lab.
+   *        This formula comes from the public MCNP theory manual.
+   * @param Ein Incident energy in the lab frame.
+   * @param k Kinematic constants of the target nuclide.
+   * @param mu Cosine of the scattering angle in the lab frame.
+   * @param Eout Scattering energy in the lab frame.
+   */
+  static double angle_jacobian(double Ein, const KinematicConstants& k,
+                               double mu, double Eout) {
+    const double sqrt_Ein_Eout = std::sqrt(Ein / Eout);
+    double C = Ein + 2. * k.awr_p1 * std::sqrt(Ein * Eout) *
+                         (mu - k.inv_awr_p1 * sqrt_Ein_Eout);
+    double Eout_cm = Eout - (C / k.awr_p1_sqr);
     return std::sqrt(Eout / Eout_cm) /
-           (1. - (mu / (A + 1.)) * std::sqrt(Ein / Eout));
+           (1. - (mu * k.inv_awr_p1) * sqrt_Ein_Eout);
+  }
+
+  /**
+   * @brief Computes the Jacobians to transform the angular PDF from the
+   *        center of mass frame, to the lab frame, for an array of angles and
+   *        energies in the lab frame.
+   * @param Ein Incident energy of each particle in the lab frame.
+   * @param k Kinematic constants of the target nuclide.
+   * @param ae AngleEnergyPackets which contain the scattering angles and
+   *           energies in the lab frame.
+   * @param jac Array in which the Jacobians dmu_cm/dmu_lab are written. Must
+   *            have the same length as Ein and ae, or a PNDLException is
+   *            thrown.
+   */
+  static void angle_jacobian(std::span<const double> Ein,
+                             const KinematicConstants& k,
+                             std::span<const AngleEnergyPacket> ae,
+                             std::span<double> jac) {
+    if (Ein.size() != jac.size() || ae.size() != jac.size()) {
+      std::string mssg =
+          "Ein, ae, and jac must have the same size. Ein.size() = " +
+          std::to_string(Ein.size()) + ", ae.size() = " +
+          std::to_string(ae.size()) + ", jac.size() = " +
+          std::to_string(jac.size()) + ".";
+      throw PNDLException(mssg);
+    }
+
+    for (std::size_t i = 0; i < jac.size(); i++) {
+      jac[i] = CMToLab::angle_jacobian(Ein[i], k, ae[i].cosine_angle,
+                                       ae[i].energy);
+    }
   }
 
   /**
@@ -110,13 +253,8 @@ struct CMToLab {
    *           in the lab frame.
    */
   static double angle_jacobian(double Ein, double A, AngleEnergyPacket ae) {
-    double mu = ae.cosine_angle;
-    double Eout = ae.energy;
-    double C = Ein + 2. * (A + 1.) * std::sqrt(Ein * Eout) *
-                         (mu - (1. / (A + 1.)) * std::sqrt(Ein / Eout));
-    double Eout_cm = Eout - (C / ((A + 1.) * (A + 1.)));
-    return std::sqrt(Eout / Eout_cm) /
-           (1. - (mu / (A + 1.)) * std::sqrt(Ein / Eout));
+    return CMToLab::angle_jacobian(Ein, KinematicConstants(A), ae.cosine_angle,
+                                   ae.energy);
   }
 
   /**
@@ -151,6 +289,32 @@ struct CMToLab {
   static double jacobian(double Eout, double Eout_cm) {
     return std::sqrt(Eout / Eout_cm);
   }
+
+  /**
+   * @brief Computes the Jacobians to transform the joint PDF from the center
+   *        of mass frame, to the lab frame, for an array of energies.
+   * @param Eout Scattering energies in the lab frame.
+   * @param Eout_cm Scattering energies in the center of mass frame. Must have
+   *                the same length as Eout.
+   * @param jac Array in which the Jacobians are written. Must have the same
+   *            length as Eout. A PNDLException is thrown if any of the
+   *            lengths differ.
+   */
+  static void jacobian(std::span<const double> Eout,
+                       std::span<const double> Eout_cm, std::span<double> jac) {
+    if (Eout.size() != jac.size() || Eout_cm.size() != jac.size()) {
+      std::string mssg =
+          "Eout, Eout_cm, and jac must have the same size. Eout.size() = " +
+          std::to_string(Eout.size()) + ", Eout_cm.size() = " +
+          std::to_string(Eout_cm.size()) + ", jac.size() = " +
+          std::to_string(jac.size()) + ".";
+      throw PNDLException(mssg);
+    }
+
+    for (std::size_t i = 0; i < jac.size(); i++) {
+      jac[i] = CMToLab::jacobian(Eout[i], Eout_cm[i]);
+    }
+  }
 };
 
 /**
@@ -159,7 +323,7 @@ struct CMToLab {
  */
 struct LabToCM {
   /**
-   * @brief Transfrom mu and Eout from the Lab frame to the CM frame.
+   * @brief Transform mu and Eout from the Lab frame to the CM frame.
    * @param Ein Incident energy of the particle.
    * @param A Atomic weight ratio of the target nuclide.
    * @param mu Scattering angle in the lab frame. The value is changed to the
@@ -168,18 +332,31 @@ struct LabToCM {
    *             the scattering energy in the center of mass frame upon return.
    */
   static void transform(double Ein, double A, double& mu, double& Eout) {
-    double C = Ein + 2. * (A + 1.) * std::sqrt(Ein * Eout) *
-                         (mu - (1. / (A + 1.)) * std::sqrt(Ein / Eout));
-    double Eout_cm = Eout - (C / ((A + 1.) * (A + 1.)));
-    double mu_cm = std::sqrt(Eout / Eout_cm) *
-                   (mu - (1. / (A + 1.)) * std::sqrt(Ein / Eout));
+    LabToCM::transform(Ein, KinematicConstants(A), mu, Eout);
+  }
+
+  /**
+   * @brief Transform mu and Eout from the Lab frame to the CM frame.
+   * @param Ein Incident energy of the particle.
+   * @param k Kinematic constants of the target nuclide.
+   * @param mu Scattering angle in the lab frame. The value is changed to the
+   *           scattering angle in the center of mass frame upon return.
+   * @param Eout Scattering energy in the lab frame. The value is changed to
+   *             the scattering energy in the center of mass frame upon return.
+   */
+  static void transform(double Ein, const KinematicConstants& k, double& mu,
+                        double& Eout) {
+    const double mu_rel = mu - k.inv_awr_p1 * std::sqrt(Ein / Eout);
+    double C = Ein + 2. * k.awr_p1 * std::sqrt(Ein * Eout) * mu_rel;
+    double Eout_cm = Eout - (C / k.awr_p1_sqr);
+    double mu_cm = std::sqrt(Eout / Eout_cm) * mu_rel;
 
     mu = mu_cm;
     Eout = Eout_cm;
   }
 
   /**
-   * @brief Transfrom an AngleEnergyPacket from the Lab frame to the CM frame.
+   * @brief Transform an AngleEnergyPacket from the Lab frame to the CM frame.
    * @param Ein Incident energy of the particle.
    * @param A Atomic weight ratio of the target nuclide.
    * @param ae AngleEnergyPacket which initially contains the scattering angle
@@ -190,6 +367,32 @@ struct LabToCM {
     LabToCM::transform(Ein, A, ae.cosine_angle, ae.energy);
   }
 
+  /**
+   * @brief Transforms an array of AngleEnergyPackets from the Lab frame to the
+   *        CM frame. The result for each packet is identical to that of the
+   *        single packet transformation.
+   * @param Ein Incident energy of each particle. Must have the same length as
+   *            ae, otherwise a PNDLException is thrown.
+   * @param k Kinematic constants of the target nuclide.
+   * @param ae AngleEnergyPackets which initially contain the scattering
+   *           angles and energies in the Lab frame, which are changed to the
+   *           center of mass frame upon return.
+   */
+  static void transform(std::span<const double> Ein,
+                        const KinematicConstants& k,
+                        std::span<AngleEnergyPacket> ae) {
+    if (Ein.size() != ae.size()) {
+      std::string mssg = "Ein and ae must have the same size. Ein.size() = " +
+                         std::to_string(Ein.size()) +
+                         ", ae.size() = " + std::to_string(ae.size()) + ".";
+      throw PNDLException(mssg);
+    }
+
+    for (std::size_t i = 0; i < ae.size(); i++) {
+      LabToCM::transform(Ein[i], k, ae[i].cosine_angle, ae[i].energy);
+    }
+  }
+
   /**
    * @brief Calculates all possible values for the scattering angle in the
    *        center of mass frame, given a scattering angle in the lab frame.
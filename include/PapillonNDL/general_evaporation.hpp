@@ -29,8 +29,10 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/energy_law.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
+#include <cmath>
 #include <memory>
 #include <optional>
 
@@ -55,8 +57,14 @@ class GeneralEvaporation : public EnergyLaw {
                      const std::vector<double>& bounds);
   ~GeneralEvaporation() = default;
 
-  double sample_energy(double E_in,
-                       const std::function<double()>& rng) const override final;
+  double sample_energy(double E_in, const std::function<double()>& rng)
+      const override final {
+    return this->sample_energy_impl(E_in, rng);
+  }
+
+  double sample_energy(double E_in, RNGStream& rng) const override final {
+    return this->sample_energy_impl(E_in, rng);
+  }
 
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
@@ -73,7 +81,20 @@ class GeneralEvaporation : public EnergyLaw {
 
  private:
   std::shared_ptr<Tabulated1D> temperature_;
+  std::shared_ptr<CompiledTabulated1D> compiled_temperature_;
   std::vector<double> bin_bounds_;
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, RNG& rng) const {
+    double T = (*compiled_temperature_)(E_in);
+    double xi1 = rng();
+    std::size_t bin = static_cast<std::size_t>(
+        std::floor(static_cast<double>(bin_bounds_.size()) * xi1));
+    double xi2 = rng();
+    double Chi =
+        (bin_bounds_[bin + 1] - bin_bounds_[bin]) * xi2 + bin_bounds_[bin];
+    return Chi * T;
+  }
 };
 
 }  // namespace pndl
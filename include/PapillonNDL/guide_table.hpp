@@ -0,0 +1,114 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_GUIDE_TABLE_H
+#define PAPILLON_NDL_GUIDE_TABLE_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief Guide table (Chen-Asau cutpoint table) used to accelerate searches
+ *        in a CDF when sampling a tabulated distribution. The interval
+ *        [0,1] is divided into equal bins, and the CDF index of each bin
+ *        boundary is stored, so that the search for a random number is
+ *        restricted to the few points of the CDF which fall within its bin.
+ *        The table does not hold the CDF itself, which must be provided for
+ *        each search.
+ */
+class GuideTable {
+ public:
+  GuideTable() : guides_() {}
+
+  /**
+   * @param cdf Sorted CDF for which to build the guide table. The number of
+   *            bins is equal to the number of points in the CDF.
+   */
+  GuideTable(const std::vector<double>& cdf);
+
+  /**
+   * @brief Returns the index of the first element of the CDF which is not
+   *        less than xi. This is the same index which is obtained with
+   *        std::lower_bound over the entire CDF.
+   * @param cdf CDF which was used to construct the guide table. This may be
+   *            any random access range of doubles, such as a std::vector or
+   *            a view of one column of an interleaved table.
+   * @param xi Value to search for, normally on the interval [0,1).
+   */
+  template <class CDF>
+  std::size_t lower_bound(const CDF& cdf, double xi) const {
+    // A table which was not built for this CDF can't be used.
+    if (guides_.size() != cdf.size() + 1) return full_search(cdf, xi);
+
+    const std::size_t NBINS = guides_.size() - 1;
+    const double x = xi * static_cast<double>(NBINS);
+    std::size_t b = 0;
+    if (x >= static_cast<double>(NBINS))
+      b = NBINS - 1;
+    else if (x > 0.)
+      b = static_cast<std::size_t>(x);
+
+    const std::size_t low_indx = guides_[b];
+    const std::size_t hi_indx = guides_[b + 1];
+
+    // The bin might not bracket xi due to round off in computing the bin,
+    // or if xi is outside of [0,1]. In this case, fall back to a search of
+    // the entire CDF.
+    if ((low_indx > 0 && cdf[low_indx - 1] >= xi) ||
+        (hi_indx < cdf.size() && cdf[hi_indx] < xi))
+      return full_search(cdf, xi);
+
+    return static_cast<std::size_t>(
+        std::lower_bound(cdf.begin() + static_cast<std::ptrdiff_t>(low_indx),
+                         cdf.begin() + static_cast<std::ptrdiff_t>(hi_indx),
+                         xi) -
+        cdf.begin());
+  }
+
+  /**
+   * @brief Returns the number of bins in the guide table.
+   */
+  std::size_t size() const {
+    return guides_.empty() ? 0 : guides_.size() - 1;
+  }
+
+ private:
+  std::vector<uint32_t> guides_;
+
+  template <class CDF>
+  static std::size_t full_search(const CDF& cdf, double xi) {
+    return static_cast<std::size_t>(
+        std::lower_bound(cdf.begin(), cdf.end(), xi) - cdf.begin());
+  }
+};
+
+}  // namespace pndl
+
+#endif
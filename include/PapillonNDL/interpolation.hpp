@@ -31,8 +31,12 @@
 #include <PapillonNDL/pndl_exception.hpp>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
+#include <span>
+#include <string>
+#include <type_traits>
 #include <variant>
 
 namespace pndl {
@@ -302,6 +306,104 @@ struct LogLog {
   }
 };
 
+/**
+ * @brief Batch versions of the interpolate, invert, and integrate methods of
+ *        an interpolation rule (Histogram, LinLin, LinLog, LogLin, or
+ *        LogLog). Each method applies the scalar method of Rule to every
+ *        element of the spans, which must all have the same size as the
+ *        output span. The points (x1,y1) and (x2,y2) are gathered for each
+ *        element by the caller. A PNDLException is thrown if the sizes of
+ *        the spans differ. The loops have no dependencies between
+ *        elements, so they may be vectorized by the compiler, including the
+ *        calls to std::log and std::pow when a vector math library is
+ *        available.
+ */
+template <class Rule>
+struct InterpolationBatch {
+  /**
+   * @brief Interpolates y for each value of x.
+   * @param x Values at which to perform the interpolation.
+   * @param x1 x coordinates of the first known points.
+   * @param y1 y coordinates of the first known points.
+   * @param x2 x coordinates of the second known points.
+   * @param y2 y coordinates of the second known points.
+   * @param y Interpolated values.
+   */
+  static void interpolate_batch(std::span<const double> x,
+                                std::span<const double> x1,
+                                std::span<const double> y1,
+                                std::span<const double> x2,
+                                std::span<const double> y2,
+                                std::span<double> y) {
+    check_sizes(y.size(), x.size(), x1.size(), y1.size(), x2.size(),
+                y2.size());
+    for (std::size_t i = 0; i < y.size(); i++) {
+      y[i] = Rule::interpolate(x[i], x1[i], y1[i], x2[i], y2[i]);
+    }
+  }
+
+  /**
+   * @brief Reverse interpolates x for each value of y.
+   * @param y Values at which to perform the inversion.
+   * @param x1 x coordinates of the first known points.
+   * @param y1 y coordinates of the first known points.
+   * @param x2 x coordinates of the second known points.
+   * @param y2 y coordinates of the second known points.
+   * @param x Inverted values.
+   */
+  static void invert_batch(std::span<const double> y,
+                           std::span<const double> x1,
+                           std::span<const double> y1,
+                           std::span<const double> x2,
+                           std::span<const double> y2, std::span<double> x) {
+    check_sizes(x.size(), y.size(), x1.size(), y1.size(), x2.size(),
+                y2.size());
+    for (std::size_t i = 0; i < x.size(); i++) {
+      x[i] = Rule::invert(y[i], x1[i], y1[i], x2[i], y2[i]);
+    }
+  }
+
+  /**
+   * @brief Integrates each interval between x_low and x_hi.
+   * @param x_low Lower bounds of integration.
+   * @param x_hi Upper bounds of integration.
+   * @param x1 x coordinates of the first known points.
+   * @param y1 y coordinates of the first known points.
+   * @param x2 x coordinates of the second known points.
+   * @param y2 y coordinates of the second known points.
+   * @param integral Integrals over each interval.
+   */
+  static void integrate_batch(std::span<const double> x_low,
+                              std::span<const double> x_hi,
+                              std::span<const double> x1,
+                              std::span<const double> y1,
+                              std::span<const double> x2,
+                              std::span<const double> y2,
+                              std::span<double> integral) {
+    check_sizes(integral.size(), x_low.size(), x_hi.size(), x1.size(),
+                y1.size(), x2.size(), y2.size());
+    for (std::size_t i = 0; i < integral.size(); i++) {
+      integral[i] =
+          Rule::integrate(x_low[i], x_hi[i], x1[i], y1[i], x2[i], y2[i]);
+    }
+  }
+
+ private:
+  // Throws if any of the input spans has a size other than that of the
+  // output span.
+  template <class... Sizes>
+  static void check_sizes(std::size_t N, Sizes... sizes) {
+    if (((sizes != N) || ...)) {
+      std::string mssg = "All spans must have the same size as the output (";
+      mssg += std::to_string(N);
+      mssg += "). Input sizes are";
+      ((mssg.append(" ").append(std::to_string(sizes))), ...);
+      mssg += ".";
+      throw PNDLException(mssg);
+    }
+  }
+};
+
 /**
  * @brief A generic interface for any Interpolation rule.
  */
@@ -382,6 +484,69 @@ class Interpolator {
     return std::visit(doIntegrate, interpolator_);
   }
 
+  /**
+   * @brief Interpolates y for each value of x, with a single dispatch on the
+   *        interpolation rule for the entire batch.
+   * @param x Values at which to perform the interpolation.
+   * @param x1 x coordinates of the first known points.
+   * @param y1 y coordinates of the first known points.
+   * @param x2 x coordinates of the second known points.
+   * @param y2 y coordinates of the second known points.
+   * @param y Interpolated values.
+   */
+  void interpolate(std::span<const double> x, std::span<const double> x1,
+                   std::span<const double> y1, std::span<const double> x2,
+                   std::span<const double> y2, std::span<double> y) const {
+    auto doInterp = [&](const auto& interp) {
+      using Rule = std::decay_t<decltype(interp)>;
+      InterpolationBatch<Rule>::interpolate_batch(x, x1, y1, x2, y2, y);
+    };
+    std::visit(doInterp, interpolator_);
+  }
+
+  /**
+   * @brief Reverse interpolates x for each value of y, with a single
+   *        dispatch on the interpolation rule for the entire batch.
+   * @param y Values at which to perform the inversion.
+   * @param x1 x coordinates of the first known points.
+   * @param y1 y coordinates of the first known points.
+   * @param x2 x coordinates of the second known points.
+   * @param y2 y coordinates of the second known points.
+   * @param x Inverted values.
+   */
+  void invert(std::span<const double> y, std::span<const double> x1,
+              std::span<const double> y1, std::span<const double> x2,
+              std::span<const double> y2, std::span<double> x) const {
+    auto doInvert = [&](const auto& interp) {
+      using Rule = std::decay_t<decltype(interp)>;
+      InterpolationBatch<Rule>::invert_batch(y, x1, y1, x2, y2, x);
+    };
+    std::visit(doInvert, interpolator_);
+  }
+
+  /**
+   * @brief Integrates each interval between x_low and x_hi, with a single
+   *        dispatch on the interpolation rule for the entire batch.
+   * @param x_low Lower bounds of integration.
+   * @param x_hi Upper bounds of integration.
+   * @param x1 x coordinates of the first known points.
+   * @param y1 y coordinates of the first known points.
+   * @param x2 x coordinates of the second known points.
+   * @param y2 y coordinates of the second known points.
+   * @param integral Integrals over each interval.
+   */
+  void integrate(std::span<const double> x_low, std::span<const double> x_hi,
+                 std::span<const double> x1, std::span<const double> y1,
+                 std::span<const double> x2, std::span<const double> y2,
+                 std::span<double> integral) const {
+    auto doIntegrate = [&](const auto& interp) {
+      using Rule = std::decay_t<decltype(interp)>;
+      InterpolationBatch<Rule>::integrate_batch(x_low, x_hi, x1, y1, x2, y2,
+                                                integral);
+    };
+    std::visit(doIntegrate, interpolator_);
+  }
+
   /**
    * @brief Checks that the x-grid is valid for the given interpolation rule.
    * @param first Iterator to the first x value.
@@ -42,9 +42,23 @@ class Isotropic : public AngleLaw {
   Isotropic() {}
   ~Isotropic() = default;
 
-  double sample_mu(const std::function<double()>& rng) const override final;
+  double sample_mu(const std::function<double()>& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
+
+  double sample_mu(RNGStream& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
 
   double pdf(double mu) const override final;
+
+ private:
+  template <class RNG>
+  double sample_mu_impl(RNG& rng) const {
+    double mu = 2. * rng() - 1.;
+    if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+    return mu;
+  }
 };
 
 }  // namespace pndl
@@ -0,0 +1,136 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_JAGGED_ARRAY_H
+#define PAPILLON_NDL_JAGGED_ARRAY_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief Two dimensional array where each row may have a different length,
+ *        stored in compressed row form. The values of all rows are held in a
+ *        single contiguous vector, and each row is located by its offset into
+ *        that vector. Rows are returned as spans.
+ */
+template <class T>
+class JaggedArray {
+ public:
+  JaggedArray() : values_(), offsets_(1, 0) {}
+
+  /**
+   * @param rows Vector of all rows of the array.
+   */
+  JaggedArray(const std::vector<std::vector<T>>& rows)
+      : values_(), offsets_(1, 0) {
+    std::size_t NV = 0;
+    for (const auto& row : rows) NV += row.size();
+    values_.reserve(NV);
+    offsets_.reserve(rows.size() + 1);
+    for (const auto& row : rows) this->push_back(row);
+  }
+
+  /**
+   * @brief Appends a new row to the end of the array.
+   * @param row Values of the new row.
+   */
+  void push_back(std::span<const T> row) {
+    values_.insert(values_.end(), row.begin(), row.end());
+    offsets_.push_back(values_.size());
+  }
+
+  /**
+   * @brief Returns the ith row.
+   * @param i Index of the row.
+   */
+  std::span<const T> operator[](std::size_t i) const {
+    return {values_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]};
+  }
+
+  /**
+   * @brief Returns the ith row.
+   * @param i Index of the row.
+   */
+  std::span<T> operator[](std::size_t i) {
+    return {values_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]};
+  }
+
+  /**
+   * @brief Returns the first row.
+   */
+  std::span<const T> front() const { return (*this)[0]; }
+
+  /**
+   * @brief Returns the last row.
+   */
+  std::span<const T> back() const { return (*this)[size() - 1]; }
+
+  /**
+   * @brief Returns the number of rows.
+   */
+  std::size_t size() const { return offsets_.size() - 1; }
+
+  /**
+   * @brief Returns true if the array has no rows.
+   */
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns the values of all rows, stored one after the other.
+   */
+  const std::vector<T>& values() const { return values_; }
+
+  /**
+   * @brief Returns the offset of the start of each row in the values, with
+   *        a final entry which is the total number of values.
+   */
+  const std::vector<std::size_t>& offsets() const { return offsets_; }
+
+  /**
+   * @brief Returns a copy of the array as a vector of rows.
+   */
+  std::vector<std::vector<T>> rows() const {
+    std::vector<std::vector<T>> out;
+    out.reserve(size());
+    for (std::size_t i = 0; i < size(); i++) {
+      const std::span<const T> row = (*this)[i];
+      out.emplace_back(row.begin(), row.end());
+    }
+    return out;
+  }
+
+ private:
+  std::vector<T> values_;
+  std::vector<std::size_t> offsets_;
+};
+
+}  // namespace pndl
+
+#endif
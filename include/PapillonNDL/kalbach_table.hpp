@@ -29,18 +29,55 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/guide_table.hpp>
 #include <PapillonNDL/interpolation.hpp>
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <vector>
 
 namespace pndl {
 
 /**
  * @brief Contains the product Angle-Energy distribution for a single
- *        incident energy, using the Kalbach-Mann representation.
+ *        incident energy, using the Kalbach-Mann representation. The
+ *        outgoing energy, PDF, CDF, R, and A of each point are stored
+ *        together, so that sampling an outgoing energy only touches a single
+ *        block of memory. The points may be shared with other tables, which
+ *        allows all of the tables of a Kalbach distribution to be stored in
+ *        a single arena.
  */
 class KalbachTable {
  public:
+  /**
+   * @brief All tabulated values for a single outgoing energy point.
+   */
+  struct Point {
+    double energy;
+    double pdf;
+    double cdf;
+    double R;
+    double A;
+  };
+
+  /**
+   * @brief Read-only view of a single tabulated quantity, for all of the
+   *        outgoing energy points.
+   */
+  using Column =
+      std::ranges::transform_view<std::span<const Point>, double Point::*>;
+
+  /**
+   * @brief Outgoing energy, with the values of R and A at that energy.
+   */
+  struct Sample {
+    double energy;
+    double R;
+    double A;
+  };
+
   /**
    * @param ace ACE file to take data from.
    * @param i Starting index of distribution in the XSS array.
@@ -61,79 +98,71 @@ class KalbachTable {
                Interpolation interp);
   ~KalbachTable() = default;
 
+  /**
+   * @brief Moves the points of all tables into a single arena, which is
+   *        then shared by all of the tables.
+   * @param tables Tables to pack into a common arena.
+   */
+  static void pack(std::vector<KalbachTable>& tables);
+
   double sample_energy(double xi) const {
-    auto cdf_it = std::lower_bound(cdf_.begin(), cdf_.end(), xi);
-    std::size_t l =
-        static_cast<std::size_t>(std::distance(cdf_.begin(), cdf_it));
-    if (xi == *cdf_it) return energy_[l];
+    std::size_t l = guide_.lower_bound(cdf(), xi);
+    if (xi == points_[l].cdf) return points_[l].energy;
     l--;
 
-    // Must account for case where pdf_[l] = pdf_[l+1], which means  that
+    // Must account for case where pdf[l] = pdf[l+1], which means  that
     // the slope is zero, and m=0. This results in nan for the linear alg.
     // To avoid this, must use histogram for that segment.
-    if (interp_ == Interpolation::Histogram || pdf_[l] == pdf_[l + 1])
+    if (interp_ == Interpolation::Histogram ||
+        points_[l].pdf == points_[l + 1].pdf)
       return histogram_interp_energy(xi, l);
 
     return linear_interp_energy(xi, l);
   }
 
+  /**
+   * @brief Samples an outgoing energy, and evaluates R and A at that
+   *        energy, with a single search of the CDF.
+   * @param xi Random variable on the unit interval [0,1).
+   */
+  Sample sample(double xi) const {
+    std::size_t l = guide_.lower_bound(cdf(), xi);
+    const Point& p = points_[l];
+    if (xi == p.cdf) return {p.energy, p.R, p.A};
+    l--;
+
+    const Point& low = points_[l];
+    const Point& hi = points_[l + 1];
+    if (interp_ == Interpolation::Histogram)
+      return {histogram_interp_energy(xi, l), low.R, low.A};
+
+    const double E = low.pdf == hi.pdf ? histogram_interp_energy(xi, l)
+                                       : linear_interp_energy(xi, l);
+    return {E, LinLin::interpolate(E, low.energy, low.R, hi.energy, hi.R),
+            LinLin::interpolate(E, low.energy, low.A, hi.energy, hi.A)};
+  }
+
   /**
    * @brief Returns the lowest possible outgoing energy in MeV.
    */
-  double min_energy() const { return energy_.front(); }
+  double min_energy() const { return points_[0].energy; }
 
   /**
    *  @brief Returns the highest possible outgoing energy in MeV.
    */
-  double max_energy() const { return energy_.back(); }
+  double max_energy() const { return points_[size_ - 1].energy; }
 
   /**
    * @brief Evaluates R for a given outgoing energy.
    * @param E Outgoing energy in MeV.
    */
-  double R(double E) const {
-    if (E <= energy_.front())
-      return R_.front();
-    else if (E >= energy_.back())
-      return R_.back();
-    else {
-      auto E_it = std::lower_bound(energy_.begin(), energy_.end(), E);
-      std::size_t l =
-          static_cast<std::size_t>(std::distance(energy_.begin(), E_it) - 1);
-
-      if (interp_ == Interpolation::Histogram) {
-        return Histogram::interpolate(E, energy_[l], R_[l], energy_[l + 1],
-                                      R_[l + 1]);
-      } else {
-        return LinLin::interpolate(E, energy_[l], R_[l], energy_[l + 1],
-                                   R_[l + 1]);
-      }
-    }
-  }
+  double R(double E) const { return this->evaluate(E, &Point::R); }
 
   /**
    * @brief Evaluates A for a given outgoing energy.
    * @param E Outgoing energy in MeV.
    */
-  double A(double E) const {
-    if (E <= energy_.front())
-      return A_.front();
-    else if (E >= energy_.back())
-      return A_.back();
-    else {
-      auto E_it = std::lower_bound(energy_.begin(), energy_.end(), E);
-      std::size_t l =
-          static_cast<std::size_t>(std::distance(energy_.begin(), E_it) - 1);
-
-      if (interp_ == Interpolation::Histogram) {
-        return Histogram::interpolate(E, energy_[l], A_[l], energy_[l + 1],
-                                      A_[l + 1]);
-      } else {
-        return LinLin::interpolate(E, energy_[l], A_[l], energy_[l + 1],
-                                   A_[l + 1]);
-      }
-    }
-  }
+  double A(double E) const { return this->evaluate(E, &Point::A); }
 
   /**
    * @breif Evaluates the PDF of scattering with angle mu, and any exit energy.
@@ -147,13 +176,14 @@ class KalbachTable {
 
     double pdf_out = 0.;
 
-    for (std::size_t i = 0; i < pdf_.size() - 1; i++) {
+    for (std::size_t i = 0; i < size_ - 1; i++) {
+      const Point& p = points_[i];
+      const Point& p1 = points_[i + 1];
       if (interp_ == Interpolation::Histogram) {
-        pdf_out += mu_p(A_[i], R_[i]) * pdf_[i] * (energy_[i + 1] - energy_[i]);
+        pdf_out += mu_p(p.A, p.R) * p.pdf * (p1.energy - p.energy);
       } else {
-        pdf_out += 0.5 * (energy_[i + 1] - energy_[i]) *
-                   (mu_p(A_[i], R_[i]) * pdf_[i] +
-                    mu_p(A_[i + 1], R_[i + 1]) * pdf_[i + 1]);
+        pdf_out += 0.5 * (p1.energy - p.energy) *
+                   (mu_p(p.A, p.R) * p.pdf + mu_p(p1.A, p1.R) * p1.pdf);
       }
     }
 
@@ -172,59 +202,66 @@ class KalbachTable {
              (std::cosh(a * mu) + r * std::sinh(a * mu));
     };
 
-    auto E_it = std::lower_bound(energy_.begin(), energy_.end(), E_out);
-    if (E_it == energy_.end()) {
+    const Column E = energy();
+    auto E_it = std::lower_bound(E.begin(), E.end(), E_out);
+    if (E_it == E.end()) {
       return 0.;
-    } else if (E_it == energy_.begin() && E_out < energy_.front()) {
+    } else if (E_it == E.begin() && E_out < E.front()) {
       return 0.;
     }
-    std::size_t l =
-        static_cast<std::size_t>(std::distance(energy_.begin(), E_it));
+    std::size_t l = static_cast<std::size_t>(std::distance(E.begin(), E_it));
     if (E_out != *E_it) l--;
 
+    const Point& p = points_[l];
     if (interp_ == Interpolation::Histogram) {
-      double mu_pdf = mu_p(A_[l], R_[l]);
-      double E_pdf = pdf_[l];
+      double mu_pdf = mu_p(p.A, p.R);
+      double E_pdf = p.pdf;
       return mu_pdf * E_pdf;
     } else {
-      double f = (E_out - energy_[l]) / (energy_[l + 1] - energy_[l]);
+      const Point& p1 = points_[l + 1];
+      double f = (E_out - p.energy) / (p1.energy - p.energy);
       double out_pdf = 0;
 
-      out_pdf += f * mu_p(A_[l + 1], R_[l + 1]) * pdf_[l + 1];
-      out_pdf += (1. - f) * mu_p(A_[l], R_[l]) * pdf_[l];
+      out_pdf += f * mu_p(p1.A, p1.R) * p1.pdf;
+      out_pdf += (1. - f) * mu_p(p.A, p.R) * p.pdf;
 
       return out_pdf;
     }
   }
 
   /**
-   * @brief Returns a vector of the outgoing energy points.
+   * @brief Returns all of the tabulated points.
    */
-  const std::vector<double>& energy() const { return energy_; }
+  std::span<const Point> points() const { return {points_, size_}; }
 
   /**
-   * @brief Returns a vector for the PDF points corresponding to the
+   * @brief Returns a view of the outgoing energy points.
+   */
+  Column energy() const { return Column(points(), &Point::energy); }
+
+  /**
+   * @brief Returns a view of the PDF points corresponding to the
    *        outgoing energy grid.
    */
-  const std::vector<double>& pdf() const { return pdf_; }
+  Column pdf() const { return Column(points(), &Point::pdf); }
 
   /**
-   * @brief Returns a vector for the CDF points corresponding to the
+   * @brief Returns a view of the CDF points corresponding to the
    *        outgoing energy grid.
    */
-  const std::vector<double>& cdf() const { return cdf_; }
+  Column cdf() const { return Column(points(), &Point::cdf); }
 
   /**
-   * @brief Returns a vector for the values of R corresponding to
+   * @brief Returns a view of the values of R corresponding to
    *        the energy grid points.
    */
-  const std::vector<double>& R() const { return R_; }
+  Column R() const { return Column(points(), &Point::R); }
 
   /**
-   * @brief Returns a vector for the values of A corresponding to
+   * @brief Returns a view of the values of A corresponding to
    *        the energy grid points.
    */
-  const std::vector<double>& A() const { return A_; }
+  Column A() const { return Column(points(), &Point::A); }
 
   /**
    * @brief Returns the method of interpolation used for the energy
@@ -235,25 +272,53 @@ class KalbachTable {
   /**
    * @brief Returns the number of outgoing energy points / AngleTables.
    */
-  std::size_t size() const { return energy_.size(); }
+  std::size_t size() const { return size_; }
 
  private:
-  std::vector<double> energy_;
-  std::vector<double> pdf_;
-  std::vector<double> cdf_;
-  std::vector<double> R_;
-  std::vector<double> A_;
+  std::shared_ptr<const std::vector<Point>> arena_;
+  const Point* points_;
+  std::size_t size_;
   Interpolation interp_;
+  GuideTable guide_;
+
+  void set_points(const std::vector<double>& energy,
+                  const std::vector<double>& pdf,
+                  const std::vector<double>& cdf, const std::vector<double>& R,
+                  const std::vector<double>& A);
+
+  double evaluate(double E, double Point::*q) const {
+    if (E <= points_[0].energy)
+      return points_[0].*q;
+    else if (E >= points_[size_ - 1].energy)
+      return points_[size_ - 1].*q;
+    else {
+      const Column Es = energy();
+      auto E_it = std::lower_bound(Es.begin(), Es.end(), E);
+      std::size_t l =
+          static_cast<std::size_t>(std::distance(Es.begin(), E_it) - 1);
+      const Point& p = points_[l];
+      const Point& p1 = points_[l + 1];
+
+      if (interp_ == Interpolation::Histogram) {
+        return Histogram::interpolate(E, p.energy, p.*q, p1.energy, p1.*q);
+      } else {
+        return LinLin::interpolate(E, p.energy, p.*q, p1.energy, p1.*q);
+      }
+    }
+  }
 
   double histogram_interp_energy(double xi, std::size_t l) const {
-    return energy_[l] + ((xi - cdf_[l]) / pdf_[l]);
+    const Point& p = points_[l];
+    return p.energy + ((xi - p.cdf) / p.pdf);
   }
 
   double linear_interp_energy(double xi, std::size_t l) const {
-    const double m = (pdf_[l + 1] - pdf_[l]) / (energy_[l + 1] - energy_[l]);
-    const double arg = pdf_[l] * pdf_[l] + 2. * m * (xi - cdf_[l]);
+    const Point& p = points_[l];
+    const Point& p1 = points_[l + 1];
+    const double m = (p1.pdf - p.pdf) / (p1.energy - p.energy);
+    const double arg = p.pdf * p.pdf + 2. * m * (xi - p.cdf);
 
-    return energy_[l] + (1. / m) * (std::sqrt(std::max(arg, 0.)) - pdf_[l]);
+    return p.energy + (1. / m) * (std::sqrt(std::max(arg, 0.)) - p.pdf);
   }
 };
 
@@ -29,13 +29,17 @@
  */
 
 #include <PapillonNDL/angle_law.hpp>
+#include <PapillonNDL/pctable.hpp>
+#include <cmath>
 #include <vector>
 
 namespace pndl {
 
 /**
  * @brief Angular distribution represented by a series of Legendre
- *        polynomials.
+ *        polynomials. The PDF is evaluated exactly, while sampling is
+ *        performed by direct inversion of a linearized CDF, which is
+ *        constructed when the moments are set.
  */
 class Legendre : public AngleLaw {
  public:
@@ -53,7 +57,13 @@ class Legendre : public AngleLaw {
    */
   Legendre(const std::vector<double>& a);
 
-  double sample_mu(const std::function<double()>& rng) const override final;
+  double sample_mu(const std::function<double()>& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
+
+  double sample_mu(RNGStream& rng) const override final {
+    return this->sample_mu_impl(rng);
+  }
 
   double pdf(double mu) const override final;
 
@@ -72,13 +82,20 @@ class Legendre : public AngleLaw {
 
  private:
   std::vector<double> a_;
-  double pdf_max_;
+  PCTable distribution_;
 
-  // Computes the constants in Ci_, H_, and cdf_
-  void find_max();
+  // Linearizes the PDF, and constructs the tabulated CDF in distribution_
+  void linearize_distribution();
 
   // Checks that the distribution is positive over the intervale [-1,1].
   bool positive() const;
+
+  template <class RNG>
+  double sample_mu_impl(RNG& rng) const {
+    double mu = distribution_.sample_value(rng());
+    if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
+    return mu;
+  }
 };
 
 }  // namespace pndl
@@ -53,8 +53,14 @@ class LevelInelasticScatter : public EnergyLaw {
   LevelInelasticScatter(double Q, double AWR);
   ~LevelInelasticScatter() = default;
 
-  double sample_energy(double E_in,
-                       const std::function<double()>& rng) const override final;
+  double sample_energy(double E_in, const std::function<double()>& /*rng*/)
+      const override final {
+    return C2_ * (E_in - C1_);
+  }
+
+  double sample_energy(double E_in, RNGStream& /*rng*/) const override final {
+    return C2_ * (E_in - C1_);
+  }
 
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
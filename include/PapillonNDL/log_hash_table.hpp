@@ -0,0 +1,115 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_LOG_HASH_TABLE_H
+#define PAPILLON_NDL_LOG_HASH_TABLE_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief Hash table on the logarithm of a sorted grid of positive values,
+ *        such as an energy grid. The interval between the logarithms of the
+ *        first and last points is divided into as many equal bins as there
+ *        are points, and the index of the first point which is not less than
+ *        the lower bound of each bin is stored. A search for a value is then
+ *        restricted to the few points which fall within its bin. As with the
+ *        GuideTable, the grid itself is not held by the table, and must be
+ *        provided for each search.
+ */
+class LogHashTable {
+ public:
+  LogHashTable() : hash_(), u_min_(0.), du_(0.) {}
+
+  /**
+   * @param grid Sorted grid for which to build the hash table. If the first
+   *             point is not positive, or if all points are equal, no table
+   *             is built, and searches are performed over the entire grid.
+   */
+  LogHashTable(const std::vector<double>& grid);
+
+  /**
+   * @brief Returns the index of the first element of the grid which is not
+   *        less than x. This is the same index which is obtained with
+   *        std::lower_bound over the entire grid.
+   * @param grid Grid which was used to construct the hash table.
+   * @param x Value to search for.
+   */
+  template <class Grid>
+  std::size_t lower_bound(const Grid& grid, double x) const {
+    // A table which was not built for this grid can't be used.
+    if (hash_.size() != grid.size() + 1) return full_search(grid, x);
+
+    const std::size_t NBINS = hash_.size() - 1;
+    const double u = (std::log(x) - u_min_) / du_;
+    std::size_t b = 0;
+    if (u >= static_cast<double>(NBINS))
+      b = NBINS - 1;
+    else if (u > 0.)
+      b = static_cast<std::size_t>(u);
+
+    // Round off in the bin may give a range which doesn't bracket x, in
+    // which case the entire grid is searched.
+    const std::size_t low = hash_[b];
+    const std::size_t hi = hash_[b + 1];
+    if ((low > 0 && grid[low - 1] >= x) || (hi < grid.size() && grid[hi] < x))
+      return full_search(grid, x);
+
+    return static_cast<std::size_t>(
+        std::lower_bound(grid.begin() + static_cast<std::ptrdiff_t>(low),
+                         grid.begin() + static_cast<std::ptrdiff_t>(
+                                            std::min(hi + 1, grid.size())),
+                         x) -
+        grid.begin());
+  }
+
+  /**
+   * @brief Returns the number of bins in the hash table, which is zero if
+   *        the table was not built.
+   */
+  std::size_t size() const { return hash_.empty() ? 0 : hash_.size() - 1; }
+
+ private:
+  // Bin b starts at ln(x) = u_min_ + b*du_. The last element is the number
+  // of points in the grid.
+  std::vector<uint32_t> hash_;
+  double u_min_, du_;
+
+  template <class Grid>
+  static std::size_t full_search(const Grid& grid, double x) {
+    return static_cast<std::size_t>(
+        std::lower_bound(grid.begin(), grid.end(), x) - grid.begin());
+  }
+};
+
+}  // namespace pndl
+
+#endif
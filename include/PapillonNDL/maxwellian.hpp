@@ -29,6 +29,7 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/energy_law.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
 #include <memory>
@@ -57,6 +58,8 @@ class Maxwellian : public EnergyLaw {
   double sample_energy(double E_in,
                        const std::function<double()>& rng) const override final;
 
+  double sample_energy(double E_in, RNGStream& rng) const override final;
+
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
   /**
@@ -70,9 +73,33 @@ class Maxwellian : public EnergyLaw {
    */
   double U() const { return restriction_energy_; }
 
+  /**
+   * @brief Selects the sampling method. By default, the analytic rejection
+   *        sampler is used. Otherwise, the reduced Maxwellian spectrum is
+   *        sampled from a tabulated inverse CDF, which is built once and
+   *        shared by all instances. The restriction energy is then applied
+   *        without rejection, which is much faster near threshold. The table
+   *        is accurate to well below the statistical noise of a transport
+   *        calculation, but the samples are not identical to those of the
+   *        analytic sampler.
+   * @param tabulated True to sample from the tabulated inverse CDF.
+   */
+  void set_tabulated(bool tabulated);
+
+  /**
+   * @brief Returns true if the spectrum is sampled from the tabulated
+   *        inverse CDF.
+   */
+  bool tabulated() const { return tabulated_; }
+
  private:
   std::shared_ptr<Tabulated1D> temperature_;
+  std::shared_ptr<CompiledTabulated1D> compiled_temperature_;
   double restriction_energy_;
+  bool tabulated_;
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -0,0 +1,125 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_MEMORY_ARENA_H
+#define PAPILLON_NDL_MEMORY_ARENA_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief A monotonic memory resource, which places all allocations one after
+ *        another in a small number of large blocks. Deallocation is a no-op,
+ *        and all memory is released when the arena is destroyed. A
+ *        MemoryArena is not thread safe, and is intended to hold the data of
+ *        a single nuclide, which is allocated once while it is constructed.
+ */
+class MemoryArena : public std::pmr::memory_resource {
+ public:
+  /**
+   * @param initial_size Number of bytes in the first block of the arena.
+   *                     Subsequent blocks are each twice the size of the
+   *                     previous block. The default value is 64 KiB.
+   * @param huge_pages If true, blocks are allocated as multiples of
+   *                   HUGE_PAGE_SIZE, and the operating system is advised to
+   *                   back them with huge pages. This is only supported on
+   *                   Linux, and is ignored on other platforms. Default value
+   *                   is false.
+   */
+  MemoryArena(std::size_t initial_size = 65536, bool huge_pages = false);
+
+  MemoryArena(const MemoryArena&) = delete;
+  MemoryArena& operator=(const MemoryArena&) = delete;
+
+  ~MemoryArena();
+
+  /**
+   * @brief Returns the total number of bytes reserved by the arena from the
+   *        operating system.
+   */
+  std::size_t footprint() const { return footprint_; }
+
+  /**
+   * @brief Returns the number of bytes which have been allocated from the
+   *        arena, including alignment padding.
+   */
+  std::size_t bytes_allocated() const { return bytes_allocated_; }
+
+  /**
+   * @brief Returns the number of blocks reserved by the arena.
+   */
+  std::size_t num_blocks() const { return blocks_.size(); }
+
+  /**
+   * @brief Returns true if the blocks of the arena are backed by huge pages.
+   */
+  bool huge_pages() const { return huge_pages_; }
+
+  /**
+   * @brief Returns true if the address p lies within one of the blocks of the
+   *        arena.
+   * @param p Address to check.
+   */
+  bool contains(const void* p) const;
+
+  /**
+   * @brief Size of a huge page in bytes.
+   */
+  static constexpr std::size_t HUGE_PAGE_SIZE = 2097152;
+
+ private:
+  struct Block {
+    std::byte* data;
+    std::size_t size;
+  };
+
+  std::vector<Block> blocks_;
+  std::byte* current_;
+  std::size_t remaining_;
+  std::size_t next_block_size_;
+  std::size_t footprint_;
+  std::size_t bytes_allocated_;
+  bool huge_pages_;
+
+  void add_block(std::size_t min_size);
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override final;
+
+  void do_deallocate(void*, std::size_t, std::size_t) override final {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override final {
+    return this == &other;
+  }
+};
+
+}  // namespace pndl
+
+#endif
@@ -29,7 +29,10 @@
  */
 
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <vector>
 
 namespace pndl {
@@ -47,6 +50,19 @@ class MultipleDistribution : public AngleEnergy {
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
+  AngleEnergyPacket sample_angle_energy(double E_in, const EnergyGrid& grid,
+                                        std::size_t i,
+                                        RNGStream& rng) const override final;
+
+  void map_energy_grid(const EnergyGrid& grid) override final {
+    for (auto& distribution : distributions_) {
+      distribution->map_energy_grid(grid);
+    }
+  }
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
@@ -73,9 +89,57 @@ class MultipleDistribution : public AngleEnergy {
     return *probabilities_[i];
   }
 
+  /**
+   * @brief Selects the index of the distribution which is sampled at a given
+   *        incident energy. If all probabilities use histogram or linear
+   *        interpolation, the cumulative probabilities are interpolated from
+   *        a table built on the union of their incident energy grids, which
+   *        requires a single search. Otherwise, every probability function
+   *        is evaluated.
+   * @param E_in Incident energy in MeV.
+   * @param xi Random variable in the interval [0,1).
+   */
+  std::size_t select_distribution(double E_in, double xi) const {
+    const std::size_t N = distributions_.size() - 1;
+
+    if (cdf_.empty()) {
+      double sum = 0.;
+      for (std::size_t d = 0; d < N; d++) {
+        sum += compiled_probabilities_[d](E_in);
+        if (xi < sum) return d;
+      }
+      return N;
+    }
+
+    const std::size_t r = static_cast<std::size_t>(
+        std::upper_bound(cdf_energy_.begin(), cdf_energy_.end(), E_in) -
+        cdf_energy_.begin());
+    const double dE = r == 0 ? 0. : E_in - cdf_energy_[r - 1];
+    const double* row = cdf_.data() + 2 * N * r;
+    for (std::size_t d = 0; d < N; d++) {
+      if (xi < row[2 * d] + row[2 * d + 1] * dE) return d;
+    }
+    return N;
+  }
+
  private:
   std::vector<std::shared_ptr<AngleEnergy>> distributions_;
   std::vector<std::shared_ptr<Tabulated1D>> probabilities_;
+  // Copies of the probabilities which are used for evaluation
+  std::vector<CompiledTabulated1D> compiled_probabilities_;
+
+  // Union of the incident energies of all probability functions. Row r of
+  // cdf_ applies between cdf_energy_[r-1] and cdf_energy_[r], with the first
+  // and last rows applying below and above the grid. Each row contains the
+  // cumulative probability of the first N-1 distributions at the lower
+  // energy of the interval, followed by its slope.
+  std::vector<double> cdf_energy_;
+  std::vector<double> cdf_;
+
+  void build_cdf_table();
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -58,6 +58,9 @@ class NBody : public AngleEnergy {
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
@@ -83,13 +86,35 @@ class NBody : public AngleEnergy {
    */
   double Q() const { return Q_; }
 
+  /**
+   * @brief Selects how the Maxwellian terms of the phase space distribution
+   *        are sampled. They are sampled analytically by default. When
+   *        tabulated, they are sampled from a tabulated inverse CDF of the
+   *        reduced Maxwellian spectrum, which is shared by all instances and
+   *        requires a single random number per term. The samples are not
+   *        identical to those of the analytic sampler.
+   * @param tabulated True to sample from the tabulated inverse CDF.
+   */
+  void set_tabulated(bool tabulated);
+
+  /**
+   * @brief Returns true if the Maxwellian terms are sampled from the
+   *        tabulated inverse CDF.
+   */
+  bool tabulated() const { return tabulated_; }
+
  private:
   uint32_t n_;
   double Ap_;
   double A_;
   double Q_;
+  bool tabulated_;
+
+  template <class RNG>
+  double maxwellian_spectrum(RNG& rng) const;
 
-  double maxwellian_spectrum(const std::function<double()>& rng) const;
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -29,6 +29,7 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/guide_table.hpp>
 #include <PapillonNDL/interpolation.hpp>
 #include <cmath>
 #include <vector>
@@ -64,10 +65,8 @@ class PCTable {
    * @param xi Random value on the interval [0,1).
    */
   double sample_value(double xi) const {
-    auto cdf_it = std::lower_bound(cdf_.begin(), cdf_.end(), xi);
-    std::size_t l =
-        static_cast<std::size_t>(std::distance(cdf_.begin(), cdf_it));
-    if (xi == *cdf_it) return values_[l];
+    std::size_t l = guide_.lower_bound(cdf_, xi);
+    if (xi == cdf_[l]) return values_[l];
 
     l--;
 
@@ -140,6 +139,7 @@ class PCTable {
   std::vector<double> pdf_;
   std::vector<double> cdf_;
   Interpolation interp_;
+  GuideTable guide_;
 
   double histogram_interp(double xi, std::size_t l) const {
     return values_[l] + ((xi - cdf_[l]) / pdf_[l]);
@@ -32,6 +32,7 @@
 #include <PapillonNDL/cross_section.hpp>
 #include <PapillonNDL/reaction_base.hpp>
 #include <memory>
+#include <memory_resource>
 
 namespace pndl {
 
@@ -47,17 +48,26 @@ class Reaction<CrossSection> : public ReactionBase {
   /**
    * @param ace ACE file to take reaction from.
    * @param indx Reaction index in the MT array.
+   * @param egrid Pointer to the EnergyGrid for the nuclide.
+   * @param memory Memory resource from which the cross section is allocated.
+   *               If nullptr, the global heap is used. Default value is
+   *               nullptr.
    */
-  Reaction(const ACE& ace, std::size_t indx, std::shared_ptr<EnergyGrid> egrid);
+  Reaction(const ACE& ace, std::size_t indx, std::shared_ptr<EnergyGrid> egrid,
+           std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param ace ACE file to take cross section from.
    * @param indx Reaction index in the MT array.
    * @param egrid Pointer to the EnergyGrid for the nuclide.
    * @param reac Reaction object to take distributions from.
+   * @param memory Memory resource from which the cross section is allocated.
+   *               If nullptr, the global heap is used. Default value is
+   *               nullptr.
    */
   Reaction(const ACE& ace, std::size_t indx, std::shared_ptr<EnergyGrid> egrid,
-           const Reaction& reac);
+           const Reaction& reac,
+           std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param xs CrossSection for the reaction.
@@ -30,9 +30,11 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/frame.hpp>
 #include <PapillonNDL/function_1d.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -66,6 +68,16 @@ class ReactionBase {
    */
   const Function1D& yield() const { return *yield_; }
 
+  /**
+   * @brief Evaluates the reaction yield. Tabulated yields are evaluated from
+   *        a CompiledTabulated1D copy, which gives the same result.
+   * @param E_in Incident energy in MeV.
+   */
+  double yield(double E_in) const {
+    if (compiled_yield_) return (*compiled_yield_)(E_in);
+    return (*yield_)(E_in);
+  }
+
   /**
    * @brief Samples and angle and energy from the neutron reaction
    *        product distribution.
@@ -79,6 +91,49 @@ class ReactionBase {
     return neutron_distribution_->sample_angle_energy(E_in, rng);
   }
 
+  /**
+   * @brief Samples and angle and energy from the neutron reaction
+   *        product distribution, drawing the random numbers directly from
+   *        an RNGStream.
+   * @param E_in Incident energy in MeV.
+   * @param rng Random number stream.
+   */
+  AngleEnergyPacket sample_neutron_angle_energy(double E_in,
+                                                RNGStream& rng) const {
+    if (E_in < threshold_) return {0., 0.};
+
+    return neutron_distribution_->sample_angle_energy(E_in, rng);
+  }
+
+  /**
+   * @brief Samples and angle and energy from the neutron reaction
+   *        product distribution, with the interval of the incident energy
+   *        in the EnergyGrid of the nuclide already provided.
+   * @param E_in Incident energy in MeV.
+   * @param grid EnergyGrid in which E_in has been located.
+   * @param i Index of the interval of the grid which contains E_in.
+   * @param rng Random number stream.
+   */
+  AngleEnergyPacket sample_neutron_angle_energy(double E_in,
+                                                const EnergyGrid& grid,
+                                                std::size_t i,
+                                                RNGStream& rng) const {
+    if (E_in < threshold_) return {0., 0.};
+
+    return neutron_distribution_->sample_angle_energy(E_in, grid, i, rng);
+  }
+
+  /**
+   * @brief Precomputes the map from the intervals of an EnergyGrid to the
+   *        incident energy intervals of the neutron reaction product
+   *        distribution. This must not be called while other threads are
+   *        sampling the distribution.
+   * @param grid EnergyGrid of the nuclide.
+   */
+  void map_energy_grid(const EnergyGrid& grid) {
+    neutron_distribution_->map_energy_grid(grid);
+  }
+
   /**
    * @brief Returns the distribution for neutron reaction products.
    */
@@ -94,6 +149,12 @@ class ReactionBase {
   std::shared_ptr<Function1D> yield_;
   std::shared_ptr<AngleEnergy> neutron_distribution_;
 
+ private:
+  // Copy of the yield which is used for evaluation, if it is tabulated
+  std::shared_ptr<CompiledTabulated1D> compiled_yield_;
+
+ protected:
+
   /**
    * @param ace ACE file to take reaction from.
    * @param indx Reaction index in the MT array.
@@ -28,30 +28,55 @@
  * @author Hunter Belanger
  */
 
+#include <PapillonNDL/rng_stream.hpp>
 #include <cstddef>
 #include <cstdint>
 
 namespace pndl {
 
 /**
- * @brief Returns a pseudo random number on the interval [0,1).
+ * @brief Number of random numbers reserved for the rng stream of each thread
+ *        (2^48). The stream of the nth thread to call rng starts n times this
+ *        many steps after the seed, so the streams of different threads never
+ *        overlap.
+ */
+constexpr std::uint64_t rng_thread_stride = 0x1000000000000ULL;
+
+/**
+ * @brief Returns a pseudo random number on the interval [0,1). Each thread
+ *        has its own RNGStream, so rng may safely be called from multiple
+ *        threads. Threads are numbered in the order in which they first use
+ *        rng, and the stream of each thread is split from the seed with a
+ *        stride of rng_thread_stride, so that all threads draw disjoint
+ *        sequences.
  */
 double rng();
 
 /**
- * @brief Resets the seed of rng to the default value.
+ * @brief Returns a reference to the RNGStream used by rng on the calling
+ *        thread.
+ */
+RNGStream& rng_stream();
+
+/**
+ * @brief Resets the seed of rng on the calling thread to the default value.
+ *        The stream restarts at the beginning of the block reserved for the
+ *        thread.
  */
 void rng_reset();
 
 /**
- * @brief Sets the seed of rng to a specific value.
+ * @brief Sets the seed of rng on the calling thread to a specific value. The
+ *        stream starts at the block reserved for the thread, after the seed,
+ *        so threads with the same seed still draw disjoint sequences.
  * @param seed New seed for rng.
  */
 void rng_seed(std::uint64_t seed);
 
 /**
- * @brief Advances rng by a specified number of steps.
- * @brief n Number of steps to advance rng.
+ * @brief Advances rng on the calling thread by a specified number of steps,
+ *        in O(log n) time.
+ * @param n Number of steps to advance rng.
  */
 void rng_advance(std::uint64_t n);
 
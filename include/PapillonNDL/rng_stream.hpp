@@ -0,0 +1,124 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_RNG_STREAM_H
+#define PAPILLON_NDL_RNG_STREAM_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <cstdint>
+
+namespace pndl {
+
+/**
+ * @brief A stream of pseudo random numbers, generated with a 63 bit linear
+ *        congruential generator. The stream holds all of its state, so that
+ *        each thread, or each particle history, can own an independent
+ *        stream without any synchronization. The stream can be advanced by an
+ *        arbitrary number of steps in O(log n) time, which is used to split a
+ *        single sequence into many non-overlapping streams. The complete state
+ *        of the stream is a single integer, which may be saved and restored
+ *        to checkpoint a calculation.
+ */
+class RNGStream {
+ public:
+  /**
+   * @brief Default seed of a stream.
+   */
+  static constexpr std::uint64_t default_seed = 1;
+
+  /**
+   * @brief Default number of random numbers reserved for each stream, when
+   *        splitting a stream with the split method.
+   */
+  static constexpr std::uint64_t default_stride = 152917;
+
+  /**
+   * @param seed Initial seed for the stream.
+   */
+  constexpr RNGStream(std::uint64_t seed = default_seed)
+      : state_(seed & MASK) {}
+
+  /**
+   * @brief Returns a pseudo random number on the interval [0,1).
+   */
+  double operator()() {
+    state_ = (MULT * state_ + INC) & MASK;
+    const double xi = static_cast<double>(state_) * NORM;
+    return xi < 1. ? xi : ONE_MINUS_EPS;
+  }
+
+  /**
+   * @brief Returns a pseudo random number on the interval [0,1).
+   */
+  double rng() { return this->operator()(); }
+
+  /**
+   * @brief Resets the stream with a new seed.
+   * @param seed New seed for the stream.
+   */
+  void seed(std::uint64_t seed) { state_ = seed & MASK; }
+
+  /**
+   * @brief Advances the stream by n steps, in O(log n) time.
+   * @param n Number of steps to advance the stream.
+   */
+  void advance(std::uint64_t n);
+
+  /**
+   * @brief Returns a new stream, which starts n * stride steps after the
+   *        current state of this stream. If every particle history (or every
+   *        thread) uses a different value of n, and draws fewer than stride
+   *        random numbers, the streams will never overlap.
+   * @param n Index of the new stream.
+   * @param stride Number of random numbers reserved for each stream.
+   */
+  RNGStream split(std::uint64_t n,
+                  std::uint64_t stride = default_stride) const {
+    RNGStream stream(*this);
+    stream.advance(n * stride);
+    return stream;
+  }
+
+  /**
+   * @brief Returns the current state of the stream. A stream constructed or
+   *        seeded with this value will reproduce the remainder of the
+   *        stream.
+   */
+  std::uint64_t state() const { return state_; }
+
+ private:
+  static constexpr std::uint64_t MULT = 2806196910506780709ULL;
+  static constexpr std::uint64_t INC = 1;
+  static constexpr std::uint64_t MASK = 0x7FFFFFFFFFFFFFFFULL;
+  static constexpr double NORM = 1. / 9223372036854775808.;
+  static constexpr double ONE_MINUS_EPS = 1. - 0x1.0p-53;
+
+  std::uint64_t state_;
+};
+
+}  // namespace pndl
+
+#endif
@@ -29,17 +29,22 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/guide_table.hpp>
+#include <PapillonNDL/log_hash_table.hpp>
 #include <PapillonNDL/pndl_exception.hpp>
 #include <PapillonNDL/st_tsl_reaction.hpp>
 #include <algorithm>
 #include <iterator>
 #include <optional>
+#include <vector>
 
 namespace pndl {
 
 /**
  * @brief Holds the Coherent Elastic scattering data for a single nuclide
- *        at a single temperature.
+ *        at a single temperature. The Bragg edges are located with a hash
+ *        table on ln(E), and the edge off of which a neutron scatters is
+ *        sampled with a guide table on the structure factor sums.
  */
 class STCoherentElastic : public STTSLReaction {
  public:
@@ -50,56 +55,57 @@ class STCoherentElastic : public STTSLReaction {
   ~STCoherentElastic() = default;
 
   double xs(double E) const override final {
-    if (bragg_edges_.size() == 0) return 0.;
-
-    if (E > bragg_edges_.front() && E < bragg_edges_.back()) {
-      // Get index for lower bragg edge
-      auto Eit = std::lower_bound(bragg_edges_.begin(), bragg_edges_.end(), E);
-      std::size_t l = static_cast<std::size_t>(
-          std::distance(bragg_edges_.begin(), Eit) - 1);
-      return structure_factor_sum_[l] / E;
-    } else if (E < bragg_edges_.front()) {
-      return 0.;
-    } else {
-      return structure_factor_sum_.back() / E;
-    }
+    return this->xs(E, this->bragg_index(E));
+  }
+
+  /**
+   * @brief Evaluates the cross section, with the Bragg edge index already
+   *        provided.
+   * @param E Incident energy in MeV.
+   * @param n Number of Bragg edges which are less than E, as returned by
+   *          bragg_index.
+   */
+  double xs(double E, std::size_t n) const {
+    if (n == 0) return 0.;
+    return structure_factor_sum_[n - 1] / E;
+  }
+
+  /**
+   * @brief Returns the number of Bragg edges which are less than E, which is
+   *        the index of the first Bragg edge which is not less than E. The
+   *        search is restricted to a few edges by a hash table on ln(E). The
+   *        index may be given to xs and sample_angle_energy, so that the
+   *        search is only performed once.
+   * @param E Incident energy in MeV.
+   */
+  std::size_t bragg_index(double E) const {
+    const std::size_t NE = bragg_edges_.size();
+    if (NE == 0 || E <= bragg_edges_.front()) return 0;
+    if (E > bragg_edges_.back()) return NE;
+    return hash_.lower_bound(bragg_edges_, E);
   }
 
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final {
-    if (bragg_edges_.size() == 0) {
-      std::string mssg =
-          "Coherent elastic scattering is not possible. Cannot sample "
-          "distribution.";
-      throw PNDLException(mssg);
-    }
-
-    if (E_in > bragg_edges_.front()) {
-      // Get index for lower bragg edge
-      auto Eit =
-          std::lower_bound(bragg_edges_.begin(), bragg_edges_.end(), E_in);
-      std::size_t l = static_cast<std::size_t>(
-          std::distance(bragg_edges_.begin(), Eit) - 1);
-
-      // Sample which Bragg edge off of which we will scatter.
-      double Prob = rng() * structure_factor_sum_[l];
-      auto Sit = std::lower_bound(
-          structure_factor_sum_.begin(),
-          structure_factor_sum_.begin() + static_cast<std::ptrdiff_t>(l), Prob);
-      std::size_t Si = static_cast<std::size_t>(
-          std::distance(structure_factor_sum_.begin(), Sit));
-      double E_bragg = bragg_edges_[Si];
+    return this->sample_angle_energy_impl(E_in, this->bragg_index(E_in), rng);
+  }
 
-      // Calculate the cosine of the scattering angle.
-      double mu = 1. - (2. * E_bragg / E_in);
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final {
+    return this->sample_angle_energy_impl(E_in, this->bragg_index(E_in), rng);
+  }
 
-      return {mu, E_in};
-    } else {
-      // When E_in <= E_0, the xs is 0, so we shouldn't actually be sampling
-      // this distribution. We will indicated this through a forward scatter
-      // with no change in energy.
-      return {1., E_in};
-    }
+  /**
+   * @brief Samples an angle and energy from the distribution, with the Bragg
+   *        edge index already provided.
+   * @param E_in Incident energy in MeV.
+   * @param n Number of Bragg edges which are less than E_in, as returned by
+   *          bragg_index.
+   * @param rng Random number stream.
+   */
+  AngleEnergyPacket sample_angle_energy(double E_in, std::size_t n,
+                                        RNGStream& rng) const {
+    return this->sample_angle_energy_impl(E_in, n, rng);
   }
 
   std::optional<double> angle_pdf(double /*E_in*/,
@@ -127,6 +133,46 @@ class STCoherentElastic : public STTSLReaction {
  private:
   std::vector<double> bragg_edges_;
   std::vector<double> structure_factor_sum_;
+
+  // Structure factor sums divided by the last sum, and a guide table to
+  // sample the Bragg edge from them.
+  std::vector<double> structure_factor_cdf_;
+  GuideTable guide_;
+
+  // Hash table on ln(E) for the search of the Bragg edges
+  LogHashTable hash_;
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, std::size_t n,
+                                             RNG& rng) const {
+    if (bragg_edges_.size() == 0) {
+      std::string mssg =
+          "Coherent elastic scattering is not possible. Cannot sample "
+          "distribution.";
+      throw PNDLException(mssg);
+    }
+
+    if (n > 0) {
+      // Sample which Bragg edge off of which we will scatter. The first
+      // edge whose sum is not less than xi is never past the last edge
+      // below E_in.
+      const std::size_t l = n - 1;
+      const double xi = rng() * structure_factor_cdf_[l];
+      const std::size_t Si =
+          std::min(guide_.lower_bound(structure_factor_cdf_, xi), l);
+      double E_bragg = bragg_edges_[Si];
+
+      // Calculate the cosine of the scattering angle.
+      double mu = 1. - (2. * E_bragg / E_in);
+
+      return {mu, E_in};
+    } else {
+      // When E_in <= E_0, the xs is 0, so we shouldn't actually be sampling
+      // this distribution. We will indicated this through a forward scatter
+      // with no change in energy.
+      return {1., E_in};
+    }
+  }
 };
 
 }  // namespace pndl
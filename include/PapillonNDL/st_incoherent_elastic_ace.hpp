@@ -29,6 +29,8 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
+#include <PapillonNDL/jagged_array.hpp>
 #include <PapillonNDL/pndl_exception.hpp>
 #include <PapillonNDL/st_tsl_reaction.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
@@ -48,10 +50,62 @@ class STIncoherentElasticACE : public STTSLReaction {
   STIncoherentElasticACE(const ACE& ace);
   ~STIncoherentElasticACE() = default;
 
-  double xs(double E) const override final { return xs_->evaluate(E); }
+  double xs(double E) const override final { return (*compiled_xs_)(E); }
 
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final {
+    return this->sample_angle_energy_impl(E_in, rng);
+  }
+
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final {
+    return this->sample_angle_energy_impl(E_in, rng);
+  }
+
+  std::optional<double> angle_pdf(double /*E_in*/,
+                                  double /*mu*/) const override final {
+    return std::nullopt;
+  }
+
+  std::optional<double> pdf(double /*E_in*/, double /*mu*/,
+                            double /*E_out*/) const override final {
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Returns the cross section function.
+   */
+  const Tabulated1D& xs() const { return *xs_; }
+
+  /**
+   * @brief Returns vector to the incoming energy grid.
+   */
+  const std::vector<double>& incoming_energy() const {
+    return incoming_energy_;
+  }
+
+  /**
+   * @brief Returns array of discrete scattering cosines, with one row for
+   *        each incoming energy.
+   */
+  const JaggedArray<double>& cosines() const { return cosines_; }
+
+  /**
+   * @brief Returns the discrete scattering cosines for the ith incoming
+   *        energy.
+   * @param i Index to the incoming energy grid.
+   */
+  std::span<const double> cosines(std::size_t i) const { return cosines_[i]; }
+
+ private:
+  std::shared_ptr<Tabulated1D> xs_;
+  std::shared_ptr<CompiledTabulated1D> compiled_xs_;
+  uint32_t Nmu;
+  std::vector<double> incoming_energy_;
+  JaggedArray<double> cosines_;
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const {
     if (incoming_energy_.size() == 0) {
       std::string mssg =
           "Incoherent elastic scattering is not possible. Cannot sample "
@@ -80,19 +134,19 @@ class STIncoherentElasticACE : public STTSLReaction {
     // Sample random index for cosine
     uint32_t j = static_cast<uint32_t>(Nmu * rng());
 
-    double mu_prime =
-        cosines_[i][j] + f * (cosines_[i + 1][j] - cosines_[i][j]);
+    const std::span<const double> mu_i = cosines_[i];
+    const std::span<const double> mu_i_1 = cosines_[i + 1];
+
+    double mu_prime = mu_i[j] + f * (mu_i_1[j] - mu_i[j]);
 
     double mu_left = -1. - (mu_prime + 1.);
     if (j != 0) {
-      mu_left = cosines_[i][j - 1] +
-                f * (cosines_[i + 1][j - 1] - cosines_[i][j - 1]);
+      mu_left = mu_i[j - 1] + f * (mu_i_1[j - 1] - mu_i[j - 1]);
     }
 
     double mu_right = 1. - (mu_prime - 1.);
     if (j != Nmu - 1) {
-      mu_right = cosines_[i][j + 1] +
-                 f * (cosines_[i + 1][j + 1] - cosines_[i][j + 1]);
+      mu_right = mu_i[j + 1] + f * (mu_i_1[j + 1] - mu_i[j + 1]);
     }
 
     double mu = mu_prime + std::min(mu_prime - mu_left, mu_right - mu_prime) *
@@ -100,39 +154,6 @@ class STIncoherentElasticACE : public STTSLReaction {
 
     return {mu, E_in};
   }
-
-  std::optional<double> angle_pdf(double /*E_in*/,
-                                  double /*mu*/) const override final {
-    return std::nullopt;
-  }
-
-  std::optional<double> pdf(double /*E_in*/, double /*mu*/,
-                            double /*E_out*/) const override final {
-    return std::nullopt;
-  }
-
-  /**
-   * @brief Returns the cross section function.
-   */
-  const Tabulated1D& xs() const { return *xs_; }
-
-  /**
-   * @brief Returns vector to the incoming energy grid.
-   */
-  const std::vector<double>& incoming_energy() const {
-    return incoming_energy_;
-  }
-
-  /**
-   * @brief Returns array of discrete scattering cosines.
-   */
-  const std::vector<std::vector<double>>& cosines() const { return cosines_; }
-
- private:
-  std::shared_ptr<Tabulated1D> xs_;
-  uint32_t Nmu;
-  std::vector<double> incoming_energy_;
-  std::vector<std::vector<double>> cosines_;
 };
 
 }  // namespace pndl
@@ -29,6 +29,7 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/st_tsl_reaction.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
 #include <optional>
@@ -51,13 +52,18 @@ class STIncoherentInelastic : public STTSLReaction {
   STIncoherentInelastic(const ACE& ace, bool unit_based_interpolation = false);
   ~STIncoherentInelastic() = default;
 
-  double xs(double E) const override final { return xs_->evaluate(E); }
+  double xs(double E) const override final { return (*compiled_xs_)(E); }
 
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final {
     return angle_energy_->sample_angle_energy(E_in, rng);
   }
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final {
+    return angle_energy_->sample_angle_energy(E_in, rng);
+  }
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final {
     return angle_energy_->angle_pdf(E_in, mu);
   }
@@ -85,6 +91,7 @@ class STIncoherentInelastic : public STTSLReaction {
 
  private:
   std::shared_ptr<Tabulated1D> xs_;
+  std::shared_ptr<CompiledTabulated1D> compiled_xs_;
   std::shared_ptr<AngleEnergy> angle_energy_;
 };
 
@@ -33,29 +33,44 @@
 #include <PapillonNDL/reaction.hpp>
 #include <PapillonNDL/urr_ptables.hpp>
 #include <PapillonNDL/xs_packet.hpp>
+#include <PapillonNDL/xs_packet_batch.hpp>
 #include <memory>
+#include <memory_resource>
+#include <span>
 
 namespace pndl {
 
 /**
  * @brief Holds all continuous energy data for single nuclide, at a single
- *        temperature.
- *
+ *        temperature. The energy grid and all cross sections of the nuclide
+ *        are allocated from a single memory resource. Unless another resource
+ *        is provided, each nuclide owns a MemoryArena which is sized to hold
+ *        all of its cross sections in one contiguous block.
  */
 class STNeutron {
  public:
   /**
    * @param ace ACE file from which to construct the data.
+   * @param memory Memory resource from which the energy grid and cross
+   *               sections are allocated. The resource is kept alive for as
+   *               long as any of the data is in use. If nullptr, a new
+   *               MemoryArena is created for the nuclide. Default value is
+   *               nullptr.
    */
-  STNeutron(const ACE& ace);
+  STNeutron(const ACE& ace,
+            std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @param ace ACE file from which to take the new cross sections.
    * @param nuclide CENeutron containing another instance of the desired
    *                nuclide. Secondary distributions and fission data
    *                will be shared between the two data sets.
+   * @param memory Memory resource from which the energy grid and cross
+   *               sections are allocated. If nullptr, a new MemoryArena is
+   *               created for the nuclide. Default value is nullptr.
    */
-  STNeutron(const ACE& ace, const STNeutron& nuclide);
+  STNeutron(const ACE& ace, const STNeutron& nuclide,
+            std::shared_ptr<std::pmr::memory_resource> memory = nullptr);
 
   /**
    * @brief Returns the nuclide ZAID.
@@ -77,6 +92,21 @@ class STNeutron {
    */
   double temperature() const { return temperature_; }
 
+  /**
+   * @brief Returns the memory resource from which the energy grid and cross
+   *        sections of the nuclide are allocated.
+   */
+  const std::shared_ptr<std::pmr::memory_resource>& memory_resource() const {
+    return memory_;
+  }
+
+  /**
+   * @brief Returns the number of bytes reserved for the energy grid and cross
+   *        sections of the nuclide. If the memory resource of the nuclide is
+   *        not a MemoryArena, zero is returned.
+   */
+  std::size_t memory_footprint() const;
+
   /**
    * @brief Returns the energy grid for the nuclide.
    */
@@ -178,6 +208,16 @@ class STNeutron {
    */
   const Fission& fission() { return *fission_; }
 
+  /**
+   * @brief Maps the energy grid of the nuclide to the incident energy grids
+   *        of the elastic and reaction distributions. Afterwards, sampling a
+   *        distribution with the index from the energy grid does not require
+   *        a search of its incident energies. Each map requires one integer
+   *        per point of the energy grid which lies within the incident
+   *        energies of the distribution, so this is not done by default.
+   */
+  void map_energy_grid();
+
   /**
    * @brief Evaluates the important nuclide cross sections at a given energy,
    *        with the grid point already provided.
@@ -190,6 +230,7 @@ class STNeutron {
     xs.total = total_xs_->evaluate(Ein, i);
     xs.elastic = elastic_xs_->evaluate(Ein, i);
     xs.fission = fission_xs_->evaluate(Ein, i);
+    xs.nu_fission = xs.fission * fission_->nu_total(Ein, i);
     xs.absorption = disappearance_xs_->evaluate(Ein, i) + xs.fission;
     xs.heating = heating_number_->evaluate(Ein, i);
     xs.inelastic = xs.total - xs.elastic - xs.absorption;
@@ -214,12 +255,22 @@ class STNeutron {
     return this->evaluate_xs(Ein, i);
   }
 
+  /**
+   * @brief Evaluates the important nuclide cross sections for a batch of
+   *        incident energies.
+   * @param Ein Incident energies at which to evaluate the cross sections.
+   * @param xs Batch in which the cross sections are stored. It is resized
+   *           to the number of incident energies if required.
+   */
+  void evaluate_xs(std::span<const double> Ein, XSPacketBatch& xs) const;
+
  private:
   ZAID zaid_;
   double awr_;
   bool fissile_;
   double temperature_;
 
+  std::shared_ptr<std::pmr::memory_resource> memory_;
   std::shared_ptr<EnergyGrid> energy_grid_;
   std::shared_ptr<CrossSection> total_xs_;
   std::shared_ptr<CrossSection> disappearance_xs_;
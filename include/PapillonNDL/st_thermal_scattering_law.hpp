@@ -31,9 +31,30 @@
 #include <PapillonNDL/st_incoherent_inelastic.hpp>
 #include <PapillonNDL/st_tsl_reaction.hpp>
 #include <PapillonNDL/zaid.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace pndl {
 
+/**
+ * @brief The reactions which make up a thermal scattering law.
+ */
+enum class TSLChannel {
+  IncoherentInelastic, /**< Incoherent inelastic scattering */
+  IncoherentElastic,   /**< Incoherent elastic scattering */
+  CoherentElastic      /**< Coherent elastic scattering */
+};
+
+/**
+ * @brief Holds the total thermal scattering cross section at an incident
+ *        energy, and the reaction which was selected to sample the scatter.
+ */
+struct TSLSelection {
+  double xs;                     /**< Total thermal scattering cross section */
+  TSLChannel channel;            /**< Selected reaction */
+  const STTSLReaction* reaction; /**< Data of the selected reaction */
+};
+
 /**
  * @brief Class to hold all thermal scattering data for a single nuclide
  *        at at single temperature.
@@ -106,14 +127,41 @@ class STThermalScatteringLaw {
   }
 
   /**
-   * @breif Returns the total thermal scattering cross section.
+   * @brief Returns the total thermal scattering cross section. The cross
+   *        sections of all reactions are tabulated on the union of their
+   *        energy grids when the law is constructed, so only a single search
+   *        is required.
    * @param E Energy at which to evaluate the cross section.
    */
   double xs(double E) const {
-    double ii = incoherent_inelastic_->xs(E);
-    double ie = incoherent_elastic_->xs(E);
-    double ce = coherent_elastic_->xs(E);
-    return ii + ie + ce;
+    double ii = 0., ii_ie = 0., ce = 0.;
+    this->evaluate_union(E, ii, ii_ie, ce);
+    return ii_ie + ce;
+  }
+
+  /**
+   * @brief Evaluates the total thermal scattering cross section, and selects
+   *        the reaction with which the neutron scatters, with the same
+   *        probabilities as the ratios of the reaction cross sections. Only a
+   *        single search of the union energy grid is required. If the total
+   *        cross section is zero, incoherent inelastic scattering is
+   *        selected.
+   * @param E Incident energy in MeV.
+   * @param xi Random number in the interval [0, 1).
+   */
+  TSLSelection evaluate_and_select(double E, double xi) const {
+    double ii = 0., ii_ie = 0., ce = 0.;
+    this->evaluate_union(E, ii, ii_ie, ce);
+    const double total = ii_ie + ce;
+    const double x = xi * total;
+
+    if (total <= 0. || x < ii) {
+      return {total, TSLChannel::IncoherentInelastic,
+              incoherent_inelastic_.get()};
+    } else if (x < ii_ie) {
+      return {total, TSLChannel::IncoherentElastic, incoherent_elastic_.get()};
+    }
+    return {total, TSLChannel::CoherentElastic, coherent_elastic_.get()};
   }
 
  private:
@@ -126,6 +174,39 @@ class STThermalScatteringLaw {
   std::shared_ptr<STTSLReaction> coherent_elastic_;
   std::shared_ptr<STTSLReaction> incoherent_elastic_;
   std::shared_ptr<STIncoherentInelastic> incoherent_inelastic_;
+
+  // Union of the energy grids of the incoherent cross sections and of the
+  // Bragg edges. For each energy, the incoherent inelastic cross section,
+  // the sum of both incoherent cross sections, and the sum of the structure
+  // factors of the Bragg edges which are not greater than the energy. The
+  // incoherent cross sections are linear between the energies, and the
+  // coherent elastic cross section is the structure factor sum divided by
+  // the incident energy.
+  std::vector<double> energy_;
+  std::vector<double> table_;
+
+  void evaluate_union(double E, double& ii, double& ii_ie, double& ce) const {
+    const std::size_t NE = energy_.size();
+    std::size_t k = 0;
+    double f = 0.;
+    if (E > energy_.back()) {
+      k = NE - 1;
+    } else if (E > energy_.front()) {
+      k = static_cast<std::size_t>(
+              std::lower_bound(energy_.begin(), energy_.end(), E) -
+              energy_.begin()) -
+          1;
+      f = (E - energy_[k]) / (energy_[k + 1] - energy_[k]);
+    }
+
+    const double* low = table_.data() + 3 * k;
+    const double* hi = f > 0. ? low + 3 : low;
+    ii = low[0] + f * (hi[0] - low[0]);
+    ii_ie = low[1] + f * (hi[1] - low[1]);
+    ce = E > energy_.front() ? low[2] / E : 0.;
+  }
+
+  void tabulate_union_grid();
 };
 }  // namespace pndl
 
@@ -29,9 +29,11 @@
  */
 
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/energy_grid.hpp>
 #include <PapillonNDL/reaction.hpp>
 #include <array>
 #include <memory>
+#include <vector>
 
 namespace pndl {
 
@@ -43,7 +45,10 @@ namespace pndl {
  *        chance, and fourth chance fission respectively. If these four are
  *        provided insteadd of MT 18, then the prompt fission spectrum is the
  *        average of these four different spectra. This class handles this niche
- * case.
+ *        case. The partial fission cross sections are tabulated in cumulative
+ *        form on the energy grid of the nuclide when the spectrum is
+ *        constructed, so that selecting a reaction requires no evaluation of
+ *        the cross sections, and no division.
  */
 class SummedFissionSpectrum : public AngleEnergy {
  public:
@@ -61,15 +66,63 @@ class SummedFissionSpectrum : public AngleEnergy {
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
+  AngleEnergyPacket sample_angle_energy(double E_in, const EnergyGrid& grid,
+                                        std::size_t i,
+                                        RNGStream& rng) const override final;
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
                             double E_out) const override final;
 
+  /**
+   * @brief Selects the reaction from which the neutron is emitted, with the
+   *        same probabilities as the ratios of the partial fission cross
+   *        sections. Returns 0, 1, 2, or 3, for MT 19, 20, 21, and 38.
+   * @param E_in Incident energy in MeV.
+   * @param i Index of the interval of the energy grid of the nuclide which
+   *          contains E_in, as returned by EnergyGrid::get_lower_index.
+   * @param xi Random number in the interval [0, 1).
+   */
+  std::size_t select_reaction(double E_in, std::size_t i, double xi) const {
+    const std::size_t NE = grid_->size();
+    if (E_in < grid_->min_energy()) {
+      return this->select_reaction_direct(E_in, xi);
+    } else if (i >= NE - 1) {
+      i = NE - 1;
+    }
+
+    // The cumulative cross sections at E_in are L + (E_in - E_low) * D / dE.
+    // Both sides of each comparison with xi are multiplied by dE, which is
+    // positive, so no division is required.
+    const double* row = table_.data() + 8 * i;
+    const double dE = i < NE - 1 ? (*grid_)[i + 1] - (*grid_)[i] : 1.;
+    const double t = i < NE - 1 ? E_in - (*grid_)[i] : 0.;
+    const double xi_tot = xi * (row[6] * dE + row[7] * t);
+    if (xi_tot < row[0] * dE + row[1] * t) return 0;
+    if (xi_tot < row[2] * dE + row[3] * t) return 1;
+    if (xi_tot < row[4] * dE + row[5] * t) return 2;
+    return 3;
+  }
+
  private:
   std::array<std::shared_ptr<STReaction>, 4> reactions_;
+  const EnergyGrid* grid_;
+  // For each interval i of the energy grid, the cumulative cross sections
+  // of MT 19, 19+20, 19+20+21, and all four, at the lower bound of the
+  // interval, each followed by its increase over the interval. The last row
+  // applies above the grid.
+  std::vector<double> table_;
 
   void compute_probabilities(std::array<double, 4>& probs, double E_in) const;
+
+  std::size_t select_reaction_direct(double E_in, double xi) const;
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -30,6 +30,7 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/energy_law.hpp>
+#include <PapillonNDL/energy_grid_map.hpp>
 #include <PapillonNDL/pctable.hpp>
 
 namespace pndl {
@@ -55,8 +56,26 @@ class TabularEnergy : public EnergyLaw {
 
   ~TabularEnergy() = default;
 
-  double sample_energy(double E_in,
-                       const std::function<double()>& rng) const override final;
+  double sample_energy(double E_in, const std::function<double()>& rng)
+      const override final {
+    return this->sample_energy_impl(
+        E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+  }
+
+  double sample_energy(double E_in, RNGStream& rng) const override final {
+    return this->sample_energy_impl(
+        E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+  }
+
+  double sample_energy(double E_in, const EnergyGrid& grid, std::size_t i,
+                       RNGStream& rng) const override final {
+    return this->sample_energy_impl(
+        E_in, grid_map_.lower_bound(incoming_energy_, E_in, grid, i), rng);
+  }
+
+  void map_energy_grid(const EnergyGrid& grid) override final {
+    grid_map_.add(grid, incoming_energy_);
+  }
 
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
@@ -82,6 +101,49 @@ class TabularEnergy : public EnergyLaw {
  private:
   std::vector<double> incoming_energy_;
   std::vector<PCTable> tables_;
+  EnergyGridMap grid_map_;
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, std::size_t indx, RNG& rng) const {
+    // Determine the index of the bounding tabulated incoming energies
+    std::size_t l;
+    double f;  // Interpolation factor
+    if (indx == 0) {
+      l = 0;
+      f = 0.;
+    } else if (indx == incoming_energy_.size()) {
+      l = incoming_energy_.size() - 2;
+      f = 1.;
+    } else {
+      l = indx - 1;
+      f = (E_in - incoming_energy_[l]) /
+          (incoming_energy_[l + 1] - incoming_energy_[l]);
+    }
+    // Determine the index of the bounding tabulated incoming energies
+
+    double E_i_1 = tables_[l].min_value();
+    double E_i_M = tables_[l].max_value();
+    double E_i_1_1 = tables_[l + 1].min_value();
+    double E_i_1_M = tables_[l + 1].max_value();
+    double Emin = E_i_1 + f * (E_i_1_1 - E_i_1);
+    double Emax = E_i_M + f * (E_i_1_M - E_i_M);
+
+    double E_hat = E_in;
+    double E_l_1, E_l_M;
+    if (rng() > f) {
+      E_hat = tables_[l].sample_value(rng());
+      E_l_1 = E_i_1;
+      E_l_M = E_i_M;
+    } else {
+      E_hat = tables_[l + 1].sample_value(rng());
+      E_l_1 = E_i_1_1;
+      E_l_M = E_i_1_M;
+    }
+
+    double E_out = Emin + ((E_hat - E_l_1) / (E_l_M - E_l_1)) * (Emax - Emin);
+
+    return E_out;
+  }
 };
 
 }  // namespace pndl
@@ -30,6 +30,7 @@
 
 #include <PapillonNDL/ace.hpp>
 #include <PapillonNDL/angle_energy.hpp>
+#include <PapillonNDL/energy_grid_map.hpp>
 #include <PapillonNDL/energy_angle_table.hpp>
 
 namespace pndl {
@@ -59,6 +60,17 @@ class TabularEnergyAngle : public AngleEnergy {
   AngleEnergyPacket sample_angle_energy(
       double E_in, const std::function<double()>& rng) const override final;
 
+  AngleEnergyPacket sample_angle_energy(double E_in,
+                                        RNGStream& rng) const override final;
+
+  AngleEnergyPacket sample_angle_energy(double E_in, const EnergyGrid& grid,
+                                        std::size_t i,
+                                        RNGStream& rng) const override final;
+
+  void map_energy_grid(const EnergyGrid& grid) override final {
+    grid_map_.add(grid, incoming_energy_);
+  }
+
   std::optional<double> angle_pdf(double E_in, double mu) const override final;
 
   std::optional<double> pdf(double E_in, double mu,
@@ -92,6 +104,11 @@ class TabularEnergyAngle : public AngleEnergy {
  private:
   std::vector<double> incoming_energy_;
   std::vector<EnergyAngleTable> tables_;
+  EnergyGridMap grid_map_;
+
+  template <class RNG>
+  AngleEnergyPacket sample_angle_energy_impl(double E_in, std::size_t indx,
+                                             RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -79,12 +79,15 @@ class URRPTables {
    * @param fission Fission cross section of the nuclide.
    * @param heating Heating number CrossSection of the nuclide.
    * @param reactions Vector of all STReaction instances for the nuclide.
+   * @param nu_total Total nu of the nuclide, tabulated on its energy grid,
+   *                 used to compute the nu_fission cross section.
    */
   URRPTables(const ACE& ace, const CrossSection& total,
              const CrossSection& disappearance, const CrossSection& elastic,
              const CrossSection& capture, const CrossSection& fission,
              const CrossSection& heating,
-             const std::vector<STReaction>& reactions);
+             const std::vector<STReaction>& reactions,
+             const CrossSection& nu_total);
 
   /**
    * @brief Returns true if the PTables are present, and false if not.
@@ -94,7 +97,9 @@ class URRPTables {
   /**
    * @brief Calculates the cross section for a given incident energy and
    *        probability. If the incident energy is not within the URR, or if
-   *        there are no probability tables, std::nullopt is returned.
+   *        there are no probability tables, std::nullopt is returned. The
+   *        tables do not contain nu, so nu_fission is the sampled fission
+   *        cross section multiplied by the smooth total nu.
    * @param E Incident energy (MeV).
    * @param i Index of E in the global energy grid, for evaluating cross
    *          sections.
@@ -148,7 +153,7 @@ class URRPTables {
     }
 
     // XSPacket struct which will contain the returned cross sections
-    XSPacket xsout{0., 0., 0., 0., 0., 0., 0.};
+    XSPacket xsout{0., 0., 0., 0., 0., 0., 0., 0.};
 
     // Evaluate the cross sections depending on interpolation
     const auto& xsb_low = ptable_low.xs_bands[b_low];
@@ -206,6 +211,8 @@ class URRPTables {
     if (xsout.fission < 0.) xsout.fission = 0.;
     if (xsout.heating < 0.) xsout.heating = 0.;
 
+    xsout.nu_fission = xsout.fission * nu_total_(E, i);
+
     // Now get the inelastic portion (if there is any)
     if (inelastic_) {
       xsout.inelastic = inelastic_->evaluate(E, i);
@@ -315,6 +322,7 @@ class URRPTables {
   CrossSection capture_;  // MT 102
   CrossSection fission_;  // MT 18
   CrossSection heating_;
+  CrossSection nu_total_;
   std::shared_ptr<CrossSection> inelastic_;
   std::shared_ptr<CrossSection> absorption_;
   std::shared_ptr<std::vector<double>> energy_;
@@ -29,6 +29,7 @@
  */
 
 #include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/energy_law.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
 #include <memory>
@@ -58,6 +59,8 @@ class Watt : public EnergyLaw {
   double sample_energy(double E_in,
                        const std::function<double()>& rng) const override final;
 
+  double sample_energy(double E_in, RNGStream& rng) const override final;
+
   std::optional<double> pdf(double E_in, double E_out) const override final;
 
   /**
@@ -77,10 +80,37 @@ class Watt : public EnergyLaw {
    */
   double U() const { return restriction_energy_; }
 
+  /**
+   * @brief Selects the sampling method. The default is the analytic
+   *        sampler. When tabulated, the Maxwellian spectrum from which the
+   *        Watt spectrum is obtained is sampled from a shared tabulated
+   *        inverse CDF, and only over the values which may give an energy
+   *        below the restriction energy. Energies above the restriction
+   *        energy must still be rejected after the transformation. The
+   *        samples are not identical to those of the analytic sampler.
+   * @param tabulated True to sample from the tabulated inverse CDF.
+   */
+  void set_tabulated(bool tabulated);
+
+  /**
+   * @brief Returns true if the spectrum is sampled from the tabulated
+   *        inverse CDF.
+   */
+  bool tabulated() const { return tabulated_; }
+
  private:
   std::shared_ptr<Tabulated1D> a_;
   std::shared_ptr<Tabulated1D> b_;
+  std::shared_ptr<CompiledTabulated1D> compiled_a_;
+  std::shared_ptr<CompiledTabulated1D> compiled_b_;
   double restriction_energy_;
+  bool tabulated_;
+
+  template <class RNG>
+  double sample_energy_impl(double E_in, RNG& rng) const;
+
+  template <class RNG>
+  double sample_tabulated(double E_in, double a, double b, RNG& rng) const;
 };
 
 }  // namespace pndl
@@ -28,19 +28,26 @@
  * @author Hunter Belanger
  */
 
+#include <cstddef>
+#include <type_traits>
+
 namespace pndl {
 
 /**
- * @brief A struct to hold the set of basic cross sections.
+ * @brief A struct to hold the set of basic cross sections. The packet is
+ *        eight contiguous doubles aligned to a 64 byte boundary, so that the
+ *        element-wise operators can be compiled to full-width vector
+ *        instructions.
  */
-struct XSPacket {
-  double total;      /**< Total cross section (MT 1) */
-  double elastic;    /**< Elastic cross section (MT 2) */
-  double inelastic;  /**< Inelastic cross section (MT 3) */
-  double absorption; /**< Absorption cross section (MT 27) */
-  double fission;    /**< Fission cross section (MT 18) */
-  double capture;    /**< Radiative capture cross section (MT 102) */
-  double heating;    /**< Heating number */
+struct alignas(64) XSPacket {
+  double total;          /**< Total cross section (MT 1) */
+  double elastic;        /**< Elastic cross section (MT 2) */
+  double inelastic;      /**< Inelastic cross section (MT 3) */
+  double absorption;     /**< Absorption cross section (MT 27) */
+  double fission;        /**< Fission cross section (MT 18) */
+  double capture;        /**< Radiative capture cross section (MT 102) */
+  double heating;        /**< Heating number */
+  double nu_fission{0.}; /**< Fission cross section times total nu */
 
   XSPacket& operator+=(const XSPacket& other) {
     this->total += other.total;
@@ -50,6 +57,7 @@ struct XSPacket {
     this->fission += other.fission;
     this->capture += other.capture;
     this->heating += other.heating;
+    this->nu_fission += other.nu_fission;
     return *this;
   }
 
@@ -61,6 +69,7 @@ struct XSPacket {
     this->fission -= other.fission;
     this->capture -= other.capture;
     this->heating -= other.heating;
+    this->nu_fission -= other.nu_fission;
     return *this;
   }
 
@@ -72,6 +81,7 @@ struct XSPacket {
     this->fission *= C;
     this->capture *= C;
     this->heating *= C;
+    this->nu_fission *= C;
     return *this;
   }
 
@@ -89,6 +99,7 @@ struct XSPacket {
     pkt.fission = this->fission + other.fission;
     pkt.capture = this->capture + other.capture;
     pkt.heating = this->heating + other.heating;
+    pkt.nu_fission = this->nu_fission + other.nu_fission;
     return pkt;
   }
 
@@ -101,6 +112,7 @@ struct XSPacket {
     pkt.fission = this->fission - other.fission;
     pkt.capture = this->capture - other.capture;
     pkt.heating = this->heating - other.heating;
+    pkt.nu_fission = this->nu_fission - other.nu_fission;
     return pkt;
   }
 
@@ -113,6 +125,7 @@ struct XSPacket {
     pkt.fission = this->fission * C;
     pkt.capture = this->capture * C;
     pkt.heating = this->heating * C;
+    pkt.nu_fission = this->nu_fission * C;
     return pkt;
   }
 
@@ -129,9 +142,10 @@ struct XSPacket {
     neg.elastic = -this->elastic;
     neg.inelastic = -this->inelastic;
     neg.absorption = -this->absorption;
-    neg.fission = -this->absorption;
+    neg.fission = -this->fission;
     neg.capture = -this->capture;
     neg.heating = -this->heating;
+    neg.nu_fission = -this->nu_fission;
     return neg;
   }
 };
@@ -140,6 +154,12 @@ inline XSPacket operator*(const double& C, const XSPacket& xs) {
   return xs * C;
 }
 
+// The element-wise operators rely on all of the members being stored
+// contiguously, with no padding inserted by the compiler.
+static_assert(std::is_standard_layout_v<XSPacket>);
+static_assert(sizeof(XSPacket) == 8 * sizeof(double));
+static_assert(offsetof(XSPacket, nu_fission) == 7 * sizeof(double));
+
 }  // namespace pndl
 
 #endif
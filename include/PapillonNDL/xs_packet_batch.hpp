@@ -0,0 +1,272 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_XSPACKET_BATCH_H
+#define PAPILLON_NDL_XSPACKET_BATCH_H
+
+/**
+ * @file
+ * @author Hunter Belanger
+ */
+
+#include <PapillonNDL/pndl_exception.hpp>
+#include <PapillonNDL/xs_packet.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace pndl {
+
+/**
+ * @brief Holds the basic cross sections for a batch of particles, in a
+ *        structure-of-arrays layout. Each cross section is stored as its own
+ *        contiguous block, so all of the arithmetic operations are simple
+ *        loops over contiguous memory which the compiler can vectorize. This
+ *        is the output type used by the batched cross section evaluations.
+ */
+class XSPacketBatch {
+ public:
+  /**
+   * @param size Number of entries in the batch. All cross sections are
+   *             initialized to zero.
+   */
+  XSPacketBatch(std::size_t size = 0) : size_(size), data_(NXS * size, 0.) {}
+
+  /**
+   * @brief Returns the number of entries in the batch.
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * @brief Changes the number of entries in the batch. All cross sections
+   *        are reset to zero.
+   * @param size New number of entries in the batch.
+   */
+  void resize(std::size_t size) {
+    size_ = size;
+    data_.assign(NXS * size_, 0.);
+  }
+
+  /**
+   * @brief Sets all cross sections of all entries to zero.
+   */
+  void zero() { std::fill(data_.begin(), data_.end(), 0.); }
+
+  /**
+   * @brief Returns a copy of the cross sections of a single entry.
+   * @param i Index of the entry.
+   */
+  XSPacket get(std::size_t i) const {
+    XSPacket xs;
+    xs.total = data_[TOTAL * size_ + i];
+    xs.elastic = data_[ELASTIC * size_ + i];
+    xs.inelastic = data_[INELASTIC * size_ + i];
+    xs.absorption = data_[ABSORPTION * size_ + i];
+    xs.fission = data_[FISSION * size_ + i];
+    xs.capture = data_[CAPTURE * size_ + i];
+    xs.heating = data_[HEATING * size_ + i];
+    xs.nu_fission = data_[NU_FISSION * size_ + i];
+    return xs;
+  }
+
+  /**
+   * @brief Sets the cross sections of a single entry.
+   * @param i Index of the entry.
+   * @param xs Cross sections to store in the entry.
+   */
+  void set(std::size_t i, const XSPacket& xs) {
+    data_[TOTAL * size_ + i] = xs.total;
+    data_[ELASTIC * size_ + i] = xs.elastic;
+    data_[INELASTIC * size_ + i] = xs.inelastic;
+    data_[ABSORPTION * size_ + i] = xs.absorption;
+    data_[FISSION * size_ + i] = xs.fission;
+    data_[CAPTURE * size_ + i] = xs.capture;
+    data_[HEATING * size_ + i] = xs.heating;
+    data_[NU_FISSION * size_ + i] = xs.nu_fission;
+  }
+
+  /**
+   * @brief Returns the total cross sections (MT 1) of the batch.
+   */
+  std::span<double> total() { return channel(TOTAL); }
+  std::span<const double> total() const { return channel(TOTAL); }
+
+  /**
+   * @brief Returns the elastic cross sections (MT 2) of the batch.
+   */
+  std::span<double> elastic() { return channel(ELASTIC); }
+  std::span<const double> elastic() const { return channel(ELASTIC); }
+
+  /**
+   * @brief Returns the inelastic cross sections (MT 3) of the batch.
+   */
+  std::span<double> inelastic() { return channel(INELASTIC); }
+  std::span<const double> inelastic() const { return channel(INELASTIC); }
+
+  /**
+   * @brief Returns the absorption cross sections (MT 27) of the batch.
+   */
+  std::span<double> absorption() { return channel(ABSORPTION); }
+  std::span<const double> absorption() const { return channel(ABSORPTION); }
+
+  /**
+   * @brief Returns the fission cross sections (MT 18) of the batch.
+   */
+  std::span<double> fission() { return channel(FISSION); }
+  std::span<const double> fission() const { return channel(FISSION); }
+
+  /**
+   * @brief Returns the radiative capture cross sections (MT 102) of the
+   *        batch.
+   */
+  std::span<double> capture() { return channel(CAPTURE); }
+  std::span<const double> capture() const { return channel(CAPTURE); }
+
+  /**
+   * @brief Returns the heating numbers of the batch.
+   */
+  std::span<double> heating() { return channel(HEATING); }
+  std::span<const double> heating() const { return channel(HEATING); }
+
+  /**
+   * @brief Returns the fission cross sections multiplied by total nu of the
+   *        batch.
+   */
+  std::span<double> nu_fission() { return channel(NU_FISSION); }
+  std::span<const double> nu_fission() const { return channel(NU_FISSION); }
+
+  XSPacketBatch& operator+=(const XSPacketBatch& other) {
+    check_size(other.size_);
+    double* a = data_.data();
+    const double* b = other.data_.data();
+    const std::size_t N = data_.size();
+    for (std::size_t j = 0; j < N; j++) a[j] += b[j];
+    return *this;
+  }
+
+  XSPacketBatch& operator-=(const XSPacketBatch& other) {
+    check_size(other.size_);
+    double* a = data_.data();
+    const double* b = other.data_.data();
+    const std::size_t N = data_.size();
+    for (std::size_t j = 0; j < N; j++) a[j] -= b[j];
+    return *this;
+  }
+
+  XSPacketBatch& operator*=(const double& C) {
+    double* a = data_.data();
+    const std::size_t N = data_.size();
+    for (std::size_t j = 0; j < N; j++) a[j] *= C;
+    return *this;
+  }
+
+  XSPacketBatch& operator/=(const double& C) {
+    double D = 1. / C;
+    return this->operator*=(D);
+  }
+
+  /**
+   * @brief Multiplies all cross sections of each entry by a factor which
+   *        is specific to that entry.
+   * @param factors Multiplication factor for each entry in the batch.
+   */
+  void scale(std::span<const double> factors) {
+    check_size(factors.size());
+    const double* f = factors.data();
+    for (std::size_t c = 0; c < NXS; c++) {
+      double* a = data_.data() + c * size_;
+      for (std::size_t i = 0; i < size_; i++) a[i] *= f[i];
+    }
+  }
+
+  /**
+   * @brief Adds the microscopic cross sections of a nuclide, multiplied by
+   *        the nuclide's number density, to the batch. This is the usual
+   *        operation when building macroscopic material cross sections.
+   * @param micro Microscopic cross sections of the nuclide.
+   * @param density Number density of the nuclide.
+   */
+  void accumulate(const XSPacketBatch& micro, double density) {
+    check_size(micro.size_);
+    double* a = data_.data();
+    const double* b = micro.data_.data();
+    const std::size_t N = data_.size();
+    for (std::size_t j = 0; j < N; j++) a[j] += density * b[j];
+  }
+
+  /**
+   * @brief Adds the microscopic cross sections of a nuclide, multiplied by
+   *        a number density which is specific to each entry, to the batch.
+   * @param micro Microscopic cross sections of the nuclide.
+   * @param densities Number density of the nuclide for each entry.
+   */
+  void accumulate(const XSPacketBatch& micro,
+                  std::span<const double> densities) {
+    check_size(micro.size_);
+    check_size(densities.size());
+    const double* d = densities.data();
+    for (std::size_t c = 0; c < NXS; c++) {
+      double* a = data_.data() + c * size_;
+      const double* b = micro.data_.data() + c * size_;
+      for (std::size_t i = 0; i < size_; i++) a[i] += d[i] * b[i];
+    }
+  }
+
+ private:
+  enum Channel : std::size_t {
+    TOTAL,
+    ELASTIC,
+    INELASTIC,
+    ABSORPTION,
+    FISSION,
+    CAPTURE,
+    HEATING,
+    NU_FISSION
+  };
+  static constexpr std::size_t NXS = 8;
+
+  std::size_t size_;
+  std::vector<double> data_;
+
+  std::span<double> channel(std::size_t c) {
+    return {data_.data() + c * size_, size_};
+  }
+
+  std::span<const double> channel(std::size_t c) const {
+    return {data_.data() + c * size_, size_};
+  }
+
+  void check_size(std::size_t size) const {
+    if (size != size_) {
+      std::string mssg = "Batch has " + std::to_string(size_) +
+                         " entries, but was given " + std::to_string(size) +
+                         ".";
+      throw PNDLException(mssg);
+    }
+  }
+};
+
+}  // namespace pndl
+
+#endif
@@ -30,7 +30,8 @@
 
 namespace pndl {
 
-AngleDistribution::AngleDistribution() : energy_grid_(), laws_() {
+AngleDistribution::AngleDistribution()
+    : energy_grid_(), laws_(), grid_map_() {
   energy_grid_.reserve(2);
   laws_.reserve(2);
 
@@ -42,7 +43,7 @@ AngleDistribution::AngleDistribution() : energy_grid_(), laws_() {
 }
 
 AngleDistribution::AngleDistribution(const ACE& ace, int locb)
-    : energy_grid_(), laws_() {
+    : energy_grid_(), laws_(), grid_map_() {
   // Locb must be >= 0! If locb == -1, it means that there is
   // no angular distribution for the reaction (must use product distribution)
   if (locb < 0) {
@@ -100,7 +101,7 @@ AngleDistribution::AngleDistribution(const ACE& ace, int locb)
 AngleDistribution::AngleDistribution(
     const std::vector<double>& energy_grid,
     const std::vector<std::shared_ptr<AngleLaw>>& laws)
-    : energy_grid_(energy_grid), laws_(laws) {
+    : energy_grid_(energy_grid), laws_(laws), grid_map_() {
   if (energy_grid_.size() != laws_.size()) {
     std::string mssg =
         "The energy grid and the vector of laws must have the same size.";
@@ -113,18 +114,16 @@ AngleDistribution::AngleDistribution(
   }
 }
 
-double AngleDistribution::sample_angle(
-    double E_in, const std::function<double()>& rng) const {
-  auto E_it = std::lower_bound(energy_grid_.begin(), energy_grid_.end(), E_in);
-  if (E_it == energy_grid_.begin())
+template <class RNG>
+double AngleDistribution::sample_angle_impl(double E_in, std::size_t indx,
+                                            RNG& rng) const {
+  if (indx == 0)
     return laws_.front()->sample_mu(rng);
-  else if (E_it == energy_grid_.end())
+  else if (indx == energy_grid_.size())
     return laws_.back()->sample_mu(rng);
-  E_it--;
 
   // Get index of low energy
-  std::size_t l =
-      static_cast<std::size_t>(std::distance(energy_grid_.begin(), E_it));
+  std::size_t l = indx - 1;
   double f = (E_in - energy_grid_[l]) / (energy_grid_[l + 1] - energy_grid_[l]);
 
   double mu = 0;
@@ -139,6 +138,30 @@ double AngleDistribution::sample_angle(
   return mu;
 }
 
+double AngleDistribution::sample_angle(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_impl(
+      E_in, EnergyGridMap::lower_bound(energy_grid_, E_in), rng);
+}
+
+double AngleDistribution::sample_angle(double E_in, RNGStream& rng) const {
+  return this->sample_angle_impl(
+      E_in, EnergyGridMap::lower_bound(energy_grid_, E_in), rng);
+}
+
+double AngleDistribution::sample_angle(
+    double E_in, const EnergyGrid& grid, std::size_t i,
+    const std::function<double()>& rng) const {
+  return this->sample_angle_impl(
+      E_in, grid_map_.lower_bound(energy_grid_, E_in, grid, i), rng);
+}
+
+double AngleDistribution::sample_angle(double E_in, const EnergyGrid& grid,
+                                       std::size_t i, RNGStream& rng) const {
+  return this->sample_angle_impl(
+      E_in, grid_map_.lower_bound(energy_grid_, E_in, grid, i), rng);
+}
+
 double AngleDistribution::pdf(double E_in, double mu) const {
   auto E_it = std::lower_bound(energy_grid_.begin(), energy_grid_.end(), E_in);
   if (E_it == energy_grid_.begin())
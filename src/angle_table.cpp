@@ -112,10 +112,4 @@ AngleTable::AngleTable(const Legendre& legendre)
   }
 }
 
-double AngleTable::sample_mu(const std::function<double()>& rng) const {
-  double mu = distribution_.sample_value(rng());
-  if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
-  return mu;
-}
-
 }  // namespace pndl
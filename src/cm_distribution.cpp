@@ -30,11 +30,34 @@
 
 namespace pndl {
 
+template <class RNG>
+AngleEnergyPacket CMDistribution::sample_angle_energy_impl(double E_in,
+                                                           RNG& rng) const {
+  AngleEnergyPacket out = distribution_->sample_angle_energy(E_in, rng);
+
+  CMToLab::transform(E_in, kinematics_, out);
+
+  return out;
+}
+
 AngleEnergyPacket CMDistribution::sample_angle_energy(
     double E_in, const std::function<double()>& rng) const {
-  AngleEnergyPacket out = distribution_->sample_angle_energy(E_in, rng);
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket CMDistribution::sample_angle_energy(double E_in,
+                                                      RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket CMDistribution::sample_angle_energy(double E_in,
+                                                      const EnergyGrid& grid,
+                                                      std::size_t i,
+                                                      RNGStream& rng) const {
+  AngleEnergyPacket out =
+      distribution_->sample_angle_energy(E_in, grid, i, rng);
 
-  CMToLab::transform(E_in, awr_, out);
+  CMToLab::transform(E_in, kinematics_, out);
 
   return out;
 }
@@ -80,7 +103,7 @@ std::optional<double> CMDistribution::pdf(double E_in, double mu,
   // First, we need to get the angle and energy in the CM frame
   double mu_cm = mu;
   double Eout_cm = E_out;
-  LabToCM::transform(E_in, awr_, mu_cm, Eout_cm);
+  LabToCM::transform(E_in, kinematics_, mu_cm, Eout_cm);
 
   // We now get the PDF in the CM frame
   auto p = distribution_->pdf(E_in, mu_cm, Eout_cm);
@@ -0,0 +1,36 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/compiled_angle_distribution.hpp>
+
+namespace pndl {
+
+CompiledAngleDistribution::CompiledAngleDistribution(
+    const AngleDistribution& angle)
+    : energy_grid_(angle.energy()), laws_() {
+  laws_.reserve(angle.size());
+  for (std::size_t i = 0; i < angle.size(); i++) {
+    laws_.emplace_back(angle.law(i));
+  }
+}
+
+}  // namespace pndl
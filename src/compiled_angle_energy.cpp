@@ -0,0 +1,91 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/cm_distribution.hpp>
+#include <PapillonNDL/compiled_angle_energy.hpp>
+#include <PapillonNDL/multiple_distribution.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <PapillonNDL/uncorrelated.hpp>
+#include <memory>
+
+namespace pndl {
+
+CompiledAngleEnergy::CompiledAngleEnergy(const AngleEnergy& distribution)
+    : laws_(), multiple_(), kinematics_(1.), cm_(false) {
+  const AngleEnergy* dist = &distribution;
+
+  // Distributions in the center of mass frame are replaced by a flag
+  if (const auto* cm = dynamic_cast<const CMDistribution*>(dist)) {
+    cm_ = true;
+    kinematics_ = cm->kinematics();
+    dist = &cm->distribution();
+  }
+
+  // Multiple distributions are flattened into a list of distributions
+  if (const auto* mult = dynamic_cast<const MultipleDistribution*>(dist)) {
+    for (std::size_t i = 0; i < mult->size(); i++) {
+      laws_.push_back(compile(mult->distribution(i)));
+    }
+    multiple_ = std::static_pointer_cast<const MultipleDistribution>(
+        mult->shared_from_this());
+  } else {
+    laws_.push_back(compile(*dist));
+  }
+}
+
+bool CompiledAngleEnergy::compiled() const {
+  for (const auto& law : laws_) {
+    if (const auto* uncorr = std::get_if<UncorrelatedLaw>(&law)) {
+      if (!uncorr->angle.compiled() || !uncorr->energy.compiled())
+        return false;
+    } else if (std::holds_alternative<Virtual>(law)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+CompiledAngleEnergy::Law CompiledAngleEnergy::compile(
+    const AngleEnergy& distribution) {
+  if (const auto* uncorr = dynamic_cast<const Uncorrelated*>(&distribution)) {
+    return UncorrelatedLaw{CompiledAngleDistribution(uncorr->angle()),
+                           CompiledEnergyLaw(uncorr->energy())};
+  } else if (const auto* kal = dynamic_cast<const Kalbach*>(&distribution)) {
+    return *kal;
+  } else if (const auto* tab =
+                 dynamic_cast<const TabularEnergyAngle*>(&distribution)) {
+    return *tab;
+  } else if (const auto* nbody = dynamic_cast<const NBody*>(&distribution)) {
+    return *nbody;
+  }
+
+  try {
+    return Virtual{distribution.shared_from_this()};
+  } catch (std::bad_weak_ptr&) {
+    std::string mssg =
+        "Angle-energy distribution is of an unknown type, and is not managed "
+        "by an std::shared_ptr.";
+    throw PNDLException(mssg);
+  }
+}
+
+}  // namespace pndl
@@ -0,0 +1,53 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/compiled_angle_law.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <memory>
+
+namespace pndl {
+
+CompiledAngleLaw::CompiledAngleLaw(const AngleLaw& law) : law_(compile(law)) {}
+
+CompiledAngleLaw::Law CompiledAngleLaw::compile(const AngleLaw& law) {
+  if (const auto* iso = dynamic_cast<const Isotropic*>(&law)) {
+    return *iso;
+  } else if (const auto* bins =
+                 dynamic_cast<const EquiprobableAngleBins*>(&law)) {
+    return *bins;
+  } else if (const auto* table = dynamic_cast<const AngleTable*>(&law)) {
+    return *table;
+  } else if (const auto* leg = dynamic_cast<const Legendre*>(&law)) {
+    return *leg;
+  }
+
+  try {
+    return Virtual{law.shared_from_this()};
+  } catch (std::bad_weak_ptr&) {
+    std::string mssg =
+        "Angle law is of an unknown type, and is not managed by an "
+        "std::shared_ptr.";
+    throw PNDLException(mssg);
+  }
+}
+
+}  // namespace pndl
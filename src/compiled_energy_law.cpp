@@ -0,0 +1,63 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/compiled_energy_law.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <memory>
+
+namespace pndl {
+
+CompiledEnergyLaw::CompiledEnergyLaw(const EnergyLaw& law)
+    : law_(compile(law)) {}
+
+CompiledEnergyLaw::Law CompiledEnergyLaw::compile(const EnergyLaw& law) {
+  if (const auto* level = dynamic_cast<const LevelInelasticScatter*>(&law)) {
+    return *level;
+  } else if (const auto* photon = dynamic_cast<const DiscretePhoton*>(&law)) {
+    return *photon;
+  } else if (const auto* bins =
+                 dynamic_cast<const EquiprobableEnergyBins*>(&law)) {
+    return *bins;
+  } else if (const auto* tab = dynamic_cast<const TabularEnergy*>(&law)) {
+    return *tab;
+  } else if (const auto* gen_evap =
+                 dynamic_cast<const GeneralEvaporation*>(&law)) {
+    return *gen_evap;
+  } else if (const auto* evap = dynamic_cast<const Evaporation*>(&law)) {
+    return *evap;
+  } else if (const auto* maxw = dynamic_cast<const Maxwellian*>(&law)) {
+    return *maxw;
+  } else if (const auto* watt = dynamic_cast<const Watt*>(&law)) {
+    return *watt;
+  }
+
+  try {
+    return Virtual{law.shared_from_this()};
+  } catch (std::bad_weak_ptr&) {
+    std::string mssg =
+        "Energy law is of an unknown type, and is not managed by an "
+        "std::shared_ptr.";
+    throw PNDLException(mssg);
+  }
+}
+
+}  // namespace pndl
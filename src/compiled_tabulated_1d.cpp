@@ -0,0 +1,107 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace pndl {
+
+CompiledTabulated1D::CompiledTabulated1D(const Tabulated1D& function)
+    : x_(function.x()),
+      y_(function.y()),
+      interp_(),
+      region_end_(x_.size(), 0),
+      linlin_(false),
+      hash_() {
+  const auto& breakpoints = function.breakpoints();
+  const auto& interpolation = function.interpolation();
+
+  linlin_ = breakpoints.size() == 1 &&
+            interpolation.front() == Interpolation::LinLin;
+
+  // Each interval takes the interpolation of the region which contains it.
+  // The interval between the two points of a discontinuity at a region
+  // boundary has zero width, and is never used.
+  interp_.reserve(x_.size() > 0 ? x_.size() - 1 : 0);
+  for (std::size_t r = 0; r < breakpoints.size(); r++) {
+    const std::size_t end = std::min<std::size_t>(breakpoints[r], x_.size());
+    while (interp_.size() + 1 < end) interp_.push_back(interpolation[r]);
+    if (end > 0) region_end_[end - 1] = 1;
+  }
+  while (interp_.size() + 1 < x_.size())
+    interp_.push_back(interpolation.back());
+
+  if (x_.size() >= HASH_MIN_SIZE) hash_ = LogHashTable(x_);
+}
+
+double CompiledTabulated1D::integrate(double x_low, double x_hi) const {
+  bool inverted = x_low > x_hi;
+  if (inverted) std::swap(x_low, x_hi);
+
+  // Integration may only be carried out over the function's valid domain
+  x_low = std::clamp(x_low, min_x(), max_x());
+  x_hi = std::clamp(x_hi, min_x(), max_x());
+  if (x_low == x_hi) return 0.;
+
+  // Index of the first interval which contains x_low
+  std::size_t i = static_cast<std::size_t>(
+      std::upper_bound(x_.begin(), x_.end(), x_low) - x_.begin());
+  if (i > 0) i--;
+
+  double integral = 0.;
+  for (; i + 1 < x_.size() && x_[i] < x_hi; i++) {
+    const double x1 = x_[i];
+    const double x2 = x_[i + 1];
+    if (x1 == x2) continue;
+
+    const double y1 = y_[i];
+    const double y2 = y_[i + 1];
+    const double a = std::max(x_low, x1);
+    const double b = std::min(x_hi, x2);
+
+    switch (interp_[i]) {
+      case Interpolation::Histogram:
+        integral += Histogram::integrate(a, b, x1, y1, x2, y2);
+        break;
+      case Interpolation::LinLin:
+        integral += LinLin::integrate(a, b, x1, y1, x2, y2);
+        break;
+      case Interpolation::LinLog:
+        integral += LinLog::integrate(a, b, x1, y1, x2, y2);
+        break;
+      case Interpolation::LogLin:
+        integral += LogLin::integrate(a, b, x1, y1, x2, y2);
+        break;
+      case Interpolation::LogLog:
+        integral += LogLog::integrate(a, b, x1, y1, x2, y2);
+        break;
+    }
+  }
+
+  if (inverted) integral = -integral;
+
+  return integral;
+}
+
+}  // namespace pndl
@@ -73,13 +73,13 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
     uint32_t l = locs[ie];
 
     // Add a blank table to the tables list
-    tables_.push_back({{}, {}, {}, {}});
+    tables_.push_back({{}, {}, {}, {}, {}});
 
     // Allocate right size for tables
     tables_.back().energy.resize(Noe, 0.);
     tables_.back().pdf.resize(Noe, 0.);
     tables_.back().cdf.resize(Noe, 0.);
-    tables_.back().cosines.resize(Noe, std::vector<double>(Nmu, 0.));
+    std::vector<std::vector<double>> cosines(Noe, std::vector<double>(Nmu, 0.));
 
     // Go through all outgoing energies
     for (std::size_t oe = 0; oe < Noe; oe++) {
@@ -99,7 +99,7 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
 
       // Get all angles
       for (std::size_t m = 0; m < Nmu; m++) {
-        tables_.back().cosines[oe][m] = ace.xss(l);
+        cosines[oe][m] = ace.xss(l);
         l++;
       }
 
@@ -126,8 +126,7 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
             discrete_angles[i_mu] = discrete_angles[i_mu - 1] + dmu;
           }
         }
-        tables_.back().cosines.insert(tables_.back().cosines.begin(),
-                                      discrete_angles);
+        cosines.insert(cosines.begin(), discrete_angles);
 
         // Advance Noe and oe, due to the added grid point.
         oe++;
@@ -138,10 +137,8 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
       // The cosines SHOULD all be sorted, but this sometimes isn't the case
       // in the ACE files. If it isn't, since the angles are all equiprobable, I
       // just sort them.
-      if (!std::is_sorted(tables_.back().cosines[oe].begin(),
-                          tables_.back().cosines[oe].end())) {
-        std::sort(tables_.back().cosines[oe].begin(),
-                  tables_.back().cosines[oe].end());
+      if (!std::is_sorted(cosines[oe].begin(), cosines[oe].end())) {
+        std::sort(cosines[oe].begin(), cosines[oe].end());
       }
 
       // All of the cosines should of course be within the interval [-1,1],
@@ -149,7 +146,7 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
       // the case. One such example is the light water evaluation at 294K,
       // where there is an upper limit of 1.225, for the ENDF/B-VII.1 data
       // for MCNP.
-      if (tables_.back().cosines[oe].front() < -1.) {
+      if (cosines[oe].front() < -1.) {
         std::stringstream mssg;
         mssg << "Lowest scattering cosine is less than -1 for incoming energy "
                 "index "
@@ -158,7 +155,7 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
         throw PNDLException(mssg.str());
       }
 
-      if (tables_.back().cosines[oe].back() > 1.) {
+      if (cosines[oe].back() > 1.) {
         std::stringstream mssg;
         mssg << "Largest scattering cosine is greater than 1 for incoming "
                 "energy index "
@@ -208,20 +205,35 @@ ContinuousEnergyDiscreteCosines::ContinuousEnergyDiscreteCosines(
         }
       }
     }
+
+    tables_.back().cosines = JaggedArray<double>(cosines);
+    tables_.back().guide = GuideTable(tables_.back().cdf);
   }  // For all incident energies
 }
 
-AngleEnergyPacket ContinuousEnergyDiscreteCosines::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket ContinuousEnergyDiscreteCosines::sample_angle_energy_impl(
+    double E_in, RNG& rng) const {
   if (!unit_based_interpolation_)
     return sample_without_unit_based_interpolation(E_in, rng);
   else
     return sample_with_unit_based_interpolation(E_in, rng);
 }
 
+AngleEnergyPacket ContinuousEnergyDiscreteCosines::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket ContinuousEnergyDiscreteCosines::sample_angle_energy(
+    double E_in, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+template <class RNG>
 AngleEnergyPacket
 ContinuousEnergyDiscreteCosines::sample_with_unit_based_interpolation(
-    double E_in, const std::function<double()>& rng) const {
+    double E_in, RNG& rng) const {
   // First we sample the outgoing energy.
   // Determine the index of the bounding tabulated incoming energies
   std::size_t l;
@@ -273,22 +285,19 @@ ContinuousEnergyDiscreteCosines::sample_with_unit_based_interpolation(
   uint32_t k = static_cast<uint32_t>(Nmu * rng());
   f = (xi - tables_[i].cdf[j]) / (tables_[i].cdf[j + 1] - tables_[i].cdf[j]);
 
-  double mu_prime =
-      tables_[i].cosines[j][k] +
-      f * (tables_[i].cosines[j + 1][k] - tables_[i].cosines[j][k]);
+  const std::span<const double> mu_j = tables_[i].cosines[j];
+  const std::span<const double> mu_j_1 = tables_[i].cosines[j + 1];
+
+  double mu_prime = mu_j[k] + f * (mu_j_1[k] - mu_j[k]);
 
   double mu_left = -1. - (mu_prime + 1.);
   if (k != 0) {
-    mu_left =
-        tables_[i].cosines[j][k - 1] +
-        f * (tables_[i].cosines[j + 1][k - 1] - tables_[i].cosines[j][k - 1]);
+    mu_left = mu_j[k - 1] + f * (mu_j_1[k - 1] - mu_j[k - 1]);
   }
 
   double mu_right = 1. - (mu_prime - 1.);
   if (k != Nmu - 1) {
-    mu_right =
-        tables_[i].cosines[j][k + 1] +
-        f * (tables_[i].cosines[j + 1][k + 1] - tables_[i].cosines[j][k + 1]);
+    mu_right = mu_j[k + 1] + f * (mu_j_1[k + 1] - mu_j[k + 1]);
   }
 
   // Now we smear
@@ -302,9 +311,10 @@ ContinuousEnergyDiscreteCosines::sample_with_unit_based_interpolation(
   return {mu, E_out};
 }
 
+template <class RNG>
 AngleEnergyPacket
 ContinuousEnergyDiscreteCosines::sample_without_unit_based_interpolation(
-    double E_in, const std::function<double()>& rng) const {
+    double E_in, RNG& rng) const {
   // First we sample the outgoing energy.
   // Determine the index of the bounding tabulated incoming energies
   std::size_t l;
@@ -346,22 +356,19 @@ ContinuousEnergyDiscreteCosines::sample_without_unit_based_interpolation(
   uint32_t k = static_cast<uint32_t>(Nmu * rng());
   f = (xi - tables_[i].cdf[j]) / (tables_[i].cdf[j + 1] - tables_[i].cdf[j]);
 
-  double mu_prime =
-      tables_[i].cosines[j][k] +
-      f * (tables_[i].cosines[j + 1][k] - tables_[i].cosines[j][k]);
+  const std::span<const double> mu_j = tables_[i].cosines[j];
+  const std::span<const double> mu_j_1 = tables_[i].cosines[j + 1];
+
+  double mu_prime = mu_j[k] + f * (mu_j_1[k] - mu_j[k]);
 
   double mu_left = -1. - (mu_prime + 1.);
   if (k != 0) {
-    mu_left =
-        tables_[i].cosines[j][k - 1] +
-        f * (tables_[i].cosines[j + 1][k - 1] - tables_[i].cosines[j][k - 1]);
+    mu_left = mu_j[k - 1] + f * (mu_j_1[k - 1] - mu_j[k - 1]);
   }
 
   double mu_right = 1. - (mu_prime - 1.);
   if (k != Nmu - 1) {
-    mu_right =
-        tables_[i].cosines[j][k + 1] +
-        f * (tables_[i].cosines[j + 1][k + 1] - tables_[i].cosines[j][k + 1]);
+    mu_right = mu_j[k + 1] + f * (mu_j_1[k + 1] - mu_j[k + 1]);
   }
 
   // Now we smear
@@ -378,14 +385,11 @@ ContinuousEnergyDiscreteCosines::sample_without_unit_based_interpolation(
 double ContinuousEnergyDiscreteCosines::CEDCTable::sample_energy(
     double xi, std::size_t& j) const {
   double E_out = 0.;
-  std::size_t l = 0;
-  auto cdf_it = std::lower_bound(cdf.begin(), cdf.end(), xi);
-  if (cdf_it == cdf.begin()) {
-    l = 0;
-  } else if (cdf_it == cdf.end()) {
+  std::size_t l = guide.lower_bound(cdf, xi);
+  if (l == cdf.size()) {
     l = energy.size() - 2;
-  } else {
-    l = static_cast<std::size_t>(std::distance(cdf.begin(), cdf_it) - 1);
+  } else if (l > 0) {
+    l--;
   }
 
   // Must account for case where pdf_[l] = pdf_[l+1], which means  that
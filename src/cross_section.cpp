@@ -21,15 +21,21 @@
  *
  * */
 #include <PapillonNDL/cross_section.hpp>
+#include <PapillonNDL/interpolation.hpp>
 #include <PapillonNDL/pndl_exception.hpp>
 #include <algorithm>
+#include <array>
 #include <memory>
+#include <string>
+
+#include "memory.hpp"
 
 namespace pndl {
 
 CrossSection::CrossSection(const ACE& ace, std::size_t i,
                            std::shared_ptr<EnergyGrid> E_grid, bool get_index,
-                           bool is_heating)
+                           bool is_heating,
+                           std::shared_ptr<std::pmr::memory_resource> memory)
     : energy_grid_(E_grid), values_(nullptr), index_(0), single_value_(false) {
   uint32_t NE = static_cast<uint32_t>(ace.nxs(2));
   if (get_index) {
@@ -39,7 +45,9 @@ CrossSection::CrossSection(const ACE& ace, std::size_t i,
     i++;
   }
 
-  values_ = std::make_shared<std::vector<double>>(ace.xss(i, NE));
+  memory = detail::memory_or_default(memory);
+  values_ = detail::make_shared<std::pmr::vector<double>>(
+      memory, ace.xss_data() + i, ace.xss_data() + i + NE, memory.get());
 
   if (energy_grid_->size() - index_ != values_->size()) {
     std::string mssg =
@@ -63,12 +71,15 @@ CrossSection::CrossSection(const ACE& ace, std::size_t i,
 
 CrossSection::CrossSection(const std::vector<double>& xs,
                            std::shared_ptr<EnergyGrid> E_grid,
-                           std::size_t index)
+                           std::size_t index,
+                           std::shared_ptr<std::pmr::memory_resource> memory)
     : energy_grid_(E_grid),
       values_(nullptr),
       index_(static_cast<uint32_t>(index)),
       single_value_(false) {
-  values_ = std::make_shared<std::vector<double>>(xs);
+  memory = detail::memory_or_default(memory);
+  values_ = detail::make_shared<std::pmr::vector<double>>(
+      memory, xs.begin(), xs.end(), memory.get());
 
   if (index_ >= energy_grid_->size()) {
     std::string mssg = "Starting index is larger than size of the energy grid.";
@@ -90,10 +101,12 @@ CrossSection::CrossSection(const std::vector<double>& xs,
   }
 }
 
-CrossSection::CrossSection(double xs, std::shared_ptr<EnergyGrid> E_grid)
+CrossSection::CrossSection(double xs, std::shared_ptr<EnergyGrid> E_grid,
+                           std::shared_ptr<std::pmr::memory_resource> memory)
     : energy_grid_(E_grid), values_(nullptr), index_(0), single_value_(true) {
-  std::vector<double> xs_tmp{xs};
-  values_ = std::make_shared<std::vector<double>>(xs_tmp);
+  memory = detail::memory_or_default(memory);
+  values_ = detail::make_shared<std::pmr::vector<double>>(
+      memory, 1, xs, memory.get());
 
   if (values_->front() < 0.) {
     std::string mssg = "Negative cross section value provided.";
@@ -101,6 +114,60 @@ CrossSection::CrossSection(double xs, std::shared_ptr<EnergyGrid> E_grid)
   }
 }
 
+void CrossSection::evaluate(std::span<const double> E,
+                            std::span<const std::size_t> i,
+                            std::span<double> xs) const {
+  if (E.size() != xs.size() || i.size() != xs.size()) {
+    std::string mssg = "Energies (" + std::to_string(E.size()) + "), ";
+    mssg += "indices (" + std::to_string(i.size()) + ") and ";
+    mssg += "cross sections (" + std::to_string(xs.size()) + ") must have ";
+    mssg += "the same size.";
+    throw PNDLException(mssg);
+  }
+
+  if (single_value_) {
+    for (std::size_t j = 0; j < E.size(); j++) xs[j] = (*this)(E[j], i[j]);
+    return;
+  }
+
+  // The interpolation points are gathered into stack buffers, one block at
+  // a time. Entries outside of the cross section are given a dummy interval
+  // and are then overwritten with their scalar value.
+  constexpr std::size_t BLOCK = 64;
+  std::array<double, BLOCK> E_low, E_hi, sig_low, sig_hi;
+  const std::size_t i_end = index_ + values_->size() - 1;
+
+  for (std::size_t b = 0; b < E.size(); b += BLOCK) {
+    const std::size_t N = std::min(BLOCK, E.size() - b);
+
+    for (std::size_t j = 0; j < N; j++) {
+      const std::size_t ij = i[b + j];
+      if (ij < index_ || ij >= i_end) {
+        E_low[j] = 0.;
+        E_hi[j] = 1.;
+        sig_low[j] = 0.;
+        sig_hi[j] = 0.;
+      } else {
+        E_low[j] = (*energy_grid_)[ij];
+        E_hi[j] = (*energy_grid_)[ij + 1];
+        sig_low[j] = (*values_)[ij - index_];
+        sig_hi[j] = (*values_)[ij - index_ + 1];
+      }
+    }
+
+    InterpolationBatch<LinLin>::interpolate_batch(
+        E.subspan(b, N), std::span<const double>(E_low.data(), N),
+        std::span<const double>(sig_low.data(), N),
+        std::span<const double>(E_hi.data(), N),
+        std::span<const double>(sig_hi.data(), N), xs.subspan(b, N));
+
+    for (std::size_t j = 0; j < N; j++) {
+      const std::size_t ij = i[b + j];
+      if (ij < index_ || ij >= i_end) xs[b + j] = (*this)(E[b + j], ij);
+    }
+  }
+}
+
 std::vector<double> CrossSection::energy() const {
   return {energy_grid_->grid().begin() + static_cast<std::ptrdiff_t>(index_),
           energy_grid_->grid().end()};
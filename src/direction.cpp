@@ -0,0 +1,129 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/direction.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+
+#include "constants.hpp"
+
+namespace pndl {
+
+Direction Direction::rotate(double mu, RNGStream& rng) const {
+  return this->rotate(mu, 2. * PI * rng());
+}
+
+void Direction::rotate(double& x, double& y, double& z, double mu,
+                       double phi) {
+  phi = std::clamp(phi, 0., 2. * PI);
+  Direction::rotate_cs(x, y, z, mu, std::cos(phi), std::sin(phi));
+}
+
+void Direction::rotate(std::span<double> x, std::span<double> y,
+                       std::span<double> z, std::span<const double> mu,
+                       std::span<const double> phi) {
+  if (y.size() != x.size() || z.size() != x.size() ||
+      mu.size() != x.size() || phi.size() != x.size()) {
+    std::string mssg =
+        "x, y, z, mu, and phi must have the same size. x.size() = " +
+        std::to_string(x.size()) + ", y.size() = " + std::to_string(y.size()) +
+        ", z.size() = " + std::to_string(z.size()) +
+        ", mu.size() = " + std::to_string(mu.size()) +
+        ", phi.size() = " + std::to_string(phi.size()) + ".";
+    throw PNDLException(mssg);
+  }
+
+  std::array<double, BLOCK> c, s;
+
+  for (std::size_t i = 0; i < x.size(); i += BLOCK) {
+    const std::size_t n = std::min(BLOCK, x.size() - i);
+    for (std::size_t j = 0; j < n; j++) {
+      const double p = std::clamp(phi[i + j], 0., 2. * PI);
+      c[j] = std::cos(p);
+      s[j] = std::sin(p);
+    }
+    Direction::rotate_block(&x[i], &y[i], &z[i], &mu[i], c.data(), s.data(),
+                            n);
+  }
+}
+
+void Direction::rotate(std::span<double> x, std::span<double> y,
+                       std::span<double> z, std::span<const double> mu,
+                       RNGStream& rng) {
+  if (y.size() != x.size() || z.size() != x.size() ||
+      mu.size() != x.size()) {
+    std::string mssg =
+        "x, y, z, and mu must have the same size. x.size() = " +
+        std::to_string(x.size()) + ", y.size() = " + std::to_string(y.size()) +
+        ", z.size() = " + std::to_string(z.size()) +
+        ", mu.size() = " + std::to_string(mu.size()) + ".";
+    throw PNDLException(mssg);
+  }
+
+  std::array<double, BLOCK> c, s;
+
+  for (std::size_t i = 0; i < x.size(); i += BLOCK) {
+    const std::size_t n = std::min(BLOCK, x.size() - i);
+    for (std::size_t j = 0; j < n; j++) {
+      const double p = 2. * PI * rng();
+      c[j] = std::cos(p);
+      s[j] = std::sin(p);
+    }
+    Direction::rotate_block(&x[i], &y[i], &z[i], &mu[i], c.data(), s.data(),
+                            n);
+  }
+}
+
+void Direction::rotate_cs(double& x, double& y, double& z, double mu, double c,
+                          double s) {
+  mu = std::clamp(mu, -1., 1.);
+  const double C = std::sqrt(1. - mu * mu);
+
+  // Near the poles, the direction of the azimuthal rotation is also
+  // reversed.
+  const bool pole = std::abs(1. - z * z) <= 1.E-10;
+  const double a = pole ? y : z;
+  const double b = pole ? z : y;
+  const double sa = pole ? -s : s;
+  const double denom = std::sqrt(1. - a * a);
+
+  const double xo = x * mu + C * (c * x * a - sa * b) / denom;
+  const double bo = b * mu + C * (c * b * a + sa * x) / denom;
+  const double ao = a * mu - c * C * denom;
+
+  x = xo;
+  y = pole ? ao : bo;
+  z = pole ? bo : ao;
+}
+
+void Direction::rotate_block(double* x, double* y, double* z, const double* mu,
+                             const double* c, const double* s,
+                             std::size_t n) {
+  for (std::size_t j = 0; j < n; j++) {
+    Direction::rotate_cs(x[j], y[j], z[j], mu[j], c[j], s[j]);
+  }
+}
+
+}  // namespace pndl
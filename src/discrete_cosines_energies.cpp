@@ -31,7 +31,12 @@ namespace pndl {
 // DiscreteCosinesEnergies can only be used with STIncoherentInelastic,
 // and is the only distribution given, so the probability is always 1.
 DiscreteCosinesEnergies::DiscreteCosinesEnergies(const ACE& ace)
-    : incoming_energy_(), outgoing_energies_(), Noe(0), Nmu(0), skewed_(false) {
+    : incoming_energy_(),
+      outgoing_energies_(),
+      cosines_(),
+      Noe(0),
+      Nmu(0),
+      skewed_(false) {
   // Make sure the distributions is discrete cosines and energies
   int32_t nxs_7 = ace.nxs(6);
 
@@ -74,8 +79,8 @@ DiscreteCosinesEnergies::DiscreteCosinesEnergies(const ACE& ace)
 
   // Go through all incident energies
   for (std::size_t ie = 0; ie < Ne; ie++) {
-    // Add the empy vector of all discrete energies
-    outgoing_energies_.push_back({});
+    std::vector<double> E_outs;
+    E_outs.reserve(Noe);
 
     // Get all outgoing energies for the current incident energy
     for (std::size_t oe = 0; oe < Noe; oe++) {
@@ -100,14 +105,17 @@ DiscreteCosinesEnergies::DiscreteCosinesEnergies(const ACE& ace)
       }
       i += Nmu;
 
-      // Add the pair to the last outgoing_energy
-      outgoing_energies_.back().push_back({E_out, mu});
+      E_outs.push_back(E_out);
+      cosines_.push_back(mu);
     }  // For all outgoing energies
-  }    // For all incident energies
+
+    outgoing_energies_.push_back(E_outs);
+  }  // For all incident energies
 }
 
-AngleEnergyPacket DiscreteCosinesEnergies::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket DiscreteCosinesEnergies::sample_angle_energy_impl(
+    double E_in, RNG& rng) const {
   uint32_t j = 0;
   uint32_t k = static_cast<uint32_t>(Nmu * rng());
   // Sample j for the outgoing energy point
@@ -141,24 +149,23 @@ AngleEnergyPacket DiscreteCosinesEnergies::sample_angle_energy(
       std::lower_bound(incoming_energy_.begin(), incoming_energy_.end(), E_in);
   if (Eit == incoming_energy_.begin()) {
     // Below lowest incident energy.
-    return {outgoing_energies_.front()[j].cosines[k],
-            outgoing_energies_.front()[j].energy};
+    return {cosines_[j][k], outgoing_energies_.front()[j]};
   } else if (Eit == incoming_energy_.end()) {
     // Above largest incident energy.
-    return {outgoing_energies_.back()[j].cosines[k],
-            outgoing_energies_.back()[j].energy};
+    const std::size_t i = incoming_energy_.size() - 1;
+    return {cosines_[i * Noe + j][k], outgoing_energies_.back()[j]};
   }
   std::size_t i = static_cast<std::size_t>(
       std::distance(incoming_energy_.begin(), Eit) - 1);
   double f = (E_in - incoming_energy_[i]) /
              (incoming_energy_[i + 1] - incoming_energy_[i]);
 
-  double E_i_j = outgoing_energies_[i][j].energy;
-  double E_i_1_j = outgoing_energies_[i + 1][j].energy;
+  double E_i_j = outgoing_energies_[i][j];
+  double E_i_1_j = outgoing_energies_[i + 1][j];
   double E = E_i_j + f * (E_i_1_j - E_i_j);
 
-  double mu_i_j_k = outgoing_energies_[i][j].cosines[k];
-  double mu_i_1_j_k = outgoing_energies_[i + 1][j].cosines[k];
+  double mu_i_j_k = cosines_[i * Noe + j][k];
+  double mu_i_1_j_k = cosines_[(i + 1) * Noe + j][k];
   double mu = mu_i_j_k + f * (mu_i_1_j_k - mu_i_j_k);
 
   if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
@@ -166,6 +173,16 @@ AngleEnergyPacket DiscreteCosinesEnergies::sample_angle_energy(
   return {mu, E};
 }
 
+AngleEnergyPacket DiscreteCosinesEnergies::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket DiscreteCosinesEnergies::sample_angle_energy(
+    double E_in, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
 std::optional<double> DiscreteCosinesEnergies::angle_pdf(double /*E_in*/,
                                                          double /*mu*/) const {
   return std::nullopt;
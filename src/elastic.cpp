@@ -61,8 +61,11 @@ Elastic::Elastic(std::shared_ptr<ElasticDopplerBroadener> broadener,
   }
 }
 
-AngleEnergyPacket Elastic::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket Elastic::sample_angle_energy_impl(double E_in,
+                                                    const EnergyGrid* grid,
+                                                    std::size_t i,
+                                                    RNG& rng) const {
   // Direction in
   const Vector u_n(0., 0., 1.);
 
@@ -87,8 +90,10 @@ AngleEnergyPacket Elastic::sample_angle_energy(
   // Calculate direction in the CM frame
   const Vector U_n = V_n / S_n;
 
-  // Sample the scattering angle in the CM frame
-  const double mu_cm = angle_.sample_angle(E_in, rng);
+  // Sample the scattering angle in the CM frame, using the index of the
+  // incident energy in the EnergyGrid of the nuclide if it was provided.
+  const double mu_cm = grid ? angle_.sample_angle(E_in, *grid, i, rng)
+                            : angle_.sample_angle(E_in, rng);
 
   // Get the outgoing velocity in the CM frame
   const Vector V_n_out = U_n.rotate(mu_cm, 2. * PI * rng()) * S_n;
@@ -111,6 +116,23 @@ AngleEnergyPacket Elastic::sample_angle_energy(
   return {mu_lab, E_out};
 }
 
+AngleEnergyPacket Elastic::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, nullptr, 0, rng);
+}
+
+AngleEnergyPacket Elastic::sample_angle_energy(double E_in,
+                                               RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, nullptr, 0, rng);
+}
+
+AngleEnergyPacket Elastic::sample_angle_energy(double E_in,
+                                               const EnergyGrid& grid,
+                                               std::size_t i,
+                                               RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, &grid, i, rng);
+}
+
 void Elastic::set_elastic_doppler_broadener(
     std::shared_ptr<ElasticDopplerBroadener> broadener) {
   if (broadener == nullptr) {
@@ -23,32 +23,65 @@
 
 #include <PapillonNDL/elastic_dbrc.hpp>
 #include <PapillonNDL/elastic_svt.hpp>
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <numeric>
 
 #include "vector.hpp"
 
 namespace pndl {
 
+ElasticDBRC::ElasticDBRC(const CrossSection& xs) : xs_(xs), max_table_() {
+  this->build_max_table();
+}
+
+void ElasticDBRC::build_max_table() {
+  const std::size_t N = xs_.energy_grid().size();
+
+  // The first level is the cross section at every grid point
+  max_table_.emplace_back(N, 0.);
+  for (std::size_t i = 0; i < N; i++) max_table_[0][i] = xs_[i];
+
+  // Each new level is built from the maxima of two adjacent ranges in
+  // the previous level.
+  for (std::size_t len = 2; len <= N; len *= 2) {
+    const std::vector<double>& prev = max_table_.back();
+    const std::size_t half = len / 2;
+    std::vector<double> level(N - len + 1, 0.);
+    for (std::size_t i = 0; i < level.size(); i++) {
+      level[i] = std::max(prev[i], prev[i + half]);
+    }
+    max_table_.push_back(std::move(level));
+  }
+}
+
 double ElasticDBRC::max_xs_value(const double& Emin, const double& Emax) const {
   const std::size_t i_min = xs_.energy_grid().get_lower_index(Emin);
-  // const double xs_Emin = xs(Emin, i_min);
-  const double xs_Emin = xs_(Emin);
+  const double xs_Emin = xs_(Emin, i_min);
   const std::size_t i_max = xs_.energy_grid().get_lower_index(Emax);
-  // const double xs_Emax = xs(Emax, i_max);
-  const double xs_Emax = xs_(Emax);
+  const double xs_Emax = xs_(Emax, i_max);
   double xs_max = std::max(xs_Emin, xs_Emax);
 
-  for (std::size_t i = i_min + 1; i <= i_max; i++) {
-    if (xs_.xs()[i] > xs_max) xs_max = xs_.xs()[i];
+  // Maximum of all grid points in the range [i_min + 1, i_max]
+  if (i_max > i_min) {
+    const std::size_t l = i_min + 1;
+    const std::size_t len = i_max - i_min;
+    const std::size_t k = static_cast<std::size_t>(std::bit_width(len)) - 1;
+    const std::vector<double>& level = max_table_[k];
+    const double range_max =
+        std::max(level[l], level[i_max + 1 - (std::size_t{1} << k)]);
+    if (range_max > xs_max) xs_max = range_max;
   }
 
   return xs_max;
 }
 
-std::array<double, 3> ElasticDBRC::sample_target_velocity(
-    const double& Ein, const double& kT, const double& awr,
-    const std::function<double()>& rng) const {
+template <class RNG>
+std::array<double, 3> ElasticDBRC::sample_target_velocity_impl(
+    const double& Ein, const double& kT, const double& awr, RNG& rng) const {
   const static ElasticSVT svt;
 
   // Get min and max energies for finding the max, based on incident energy
@@ -81,6 +114,105 @@ std::array<double, 3> ElasticDBRC::sample_target_velocity(
   return v_t.array();
 }
 
+std::array<double, 3> ElasticDBRC::sample_target_velocity(
+    const double& Ein, const double& kT, const double& awr,
+    const std::function<double()>& rng) const {
+  return this->sample_target_velocity_impl(Ein, kT, awr, rng);
+}
+
+std::array<double, 3> ElasticDBRC::sample_target_velocity(
+    const double& Ein, const double& kT, const double& awr,
+    RNGStream& rng) const {
+  return this->sample_target_velocity_impl(Ein, kT, awr, rng);
+}
+
+template <class RNG>
+void ElasticDBRC::sample_target_velocities_impl(
+    std::span<const double> Ein, const double& kT, const double& awr, RNG& rng,
+    std::span<std::array<double, 3>> vt) const {
+  const static ElasticSVT svt;
+
+  if (Ein.size() != vt.size()) {
+    std::string mssg = "Ein and vt must have the same size. Ein.size() = " +
+                       std::to_string(Ein.size()) +
+                       ", vt.size() = " + std::to_string(vt.size()) + ".";
+    throw PNDLException(mssg);
+  }
+
+  const std::size_t N = Ein.size();
+
+  // Relative energy window and majorant for each neutron in the batch
+  std::vector<double> Er_min(N, 0.);
+  std::vector<double> Er_max(N, 0.);
+  std::vector<double> xs_max(N, 0.);
+  for (std::size_t i = 0; i < N; i++) {
+    const double y = std::sqrt(awr * Ein[i] / kT);
+    const double y_min = std::max(0., y - 4.);
+    const double y_max = y + 4.;
+    Er_min[i] = y_min * y_min * kT / awr;
+    Er_max[i] = y_max * y_max * kT / awr;
+    xs_max[i] = this->max_xs_value(Er_min[i], Er_max[i]);
+  }
+
+  // Each pass samples SVT velocities for all lanes which have not yet been
+  // accepted, and then applies the DBRC rejection to all of them. Accepted
+  // lanes are masked out, and the remaining lanes are compacted.
+  std::vector<std::size_t> active(N, 0);
+  std::iota(active.begin(), active.end(), 0);
+  std::vector<double> trial_Ein(N, 0.);
+  std::vector<std::array<double, 3>> trial_vt(N);
+  std::vector<double> xi(N, 0.);
+  std::vector<std::uint8_t> accepted(N, 0);
+
+  while (active.empty() == false) {
+    const std::size_t M = active.size();
+    for (std::size_t k = 0; k < M; k++) trial_Ein[k] = Ein[active[k]];
+    svt.sample_target_velocities({trial_Ein.data(), M}, kT, awr, rng,
+                                 {trial_vt.data(), M});
+    for (std::size_t k = 0; k < M; k++) xi[k] = rng();
+
+    for (std::size_t k = 0; k < M; k++) {
+      const std::size_t j = active[k];
+      const double vr_x = trial_vt[k][0];
+      const double vr_y = trial_vt[k][1];
+      const double vr_z = std::sqrt(trial_Ein[k]) - trial_vt[k][2];
+      const double Er = vr_x * vr_x + vr_y * vr_y + vr_z * vr_z;
+
+      if (Er < Er_min[j] || Er > Er_max[j]) {
+        accepted[k] = false;
+        continue;
+      }
+
+      const std::size_t i_Er = xs_.energy_grid().get_lower_index(Er);
+      accepted[k] = xi[k] * xs_max[j] < xs_(Er, i_Er);
+    }
+
+    std::size_t n_active = 0;
+    for (std::size_t k = 0; k < M; k++) {
+      const std::size_t j = active[k];
+      if (accepted[k]) {
+        vt[j] = trial_vt[k];
+      } else {
+        active[n_active++] = j;
+      }
+    }
+    active.resize(n_active);
+  }
+}
+
+void ElasticDBRC::sample_target_velocities(
+    std::span<const double> Ein, const double& kT, const double& awr,
+    const std::function<double()>& rng,
+    std::span<std::array<double, 3>> vt) const {
+  this->sample_target_velocities_impl(Ein, kT, awr, rng, vt);
+}
+
+void ElasticDBRC::sample_target_velocities(
+    std::span<const double> Ein, const double& kT, const double& awr,
+    RNGStream& rng, std::span<std::array<double, 3>> vt) const {
+  this->sample_target_velocities_impl(Ein, kT, awr, rng, vt);
+}
+
 std::string ElasticDBRC::algorithm() const { return "DBRC"; }
 
 }  // namespace pndl
@@ -0,0 +1,177 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/elastic_rvs.hpp>
+#include <PapillonNDL/elastic_svt.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "vector.hpp"
+
+namespace pndl {
+
+ElasticRVS::ElasticRVS(const CrossSection& xs) : xs_(xs), pdf_(), cdf_() {
+  const EnergyGrid& egrid = xs_.energy_grid();
+  const std::size_t N = egrid.size();
+
+  if (N < 2) {
+    std::string mssg =
+        "The 0K elastic cross section must have at least two points.";
+    throw PNDLException(mssg);
+  }
+
+  pdf_.resize(N, 0.);
+  cdf_.resize(N, 0.);
+  for (std::size_t i = 0; i < N; i++) {
+    pdf_[i] = std::sqrt(egrid[i]) * xs_[i];
+  }
+
+  // Integrate the linearly interpolated pdf with the trapezoid rule
+  for (std::size_t i = 0; i < N - 1; i++) {
+    cdf_[i + 1] =
+        cdf_[i] + 0.5 * (pdf_[i] + pdf_[i + 1]) * (egrid[i + 1] - egrid[i]);
+  }
+
+  if (cdf_.back() <= 0.) {
+    std::string mssg = "The 0K elastic cross section is zero everywhere.";
+    throw PNDLException(mssg);
+  }
+}
+
+double ElasticRVS::cdf_value(double Er, std::size_t i) const {
+  const EnergyGrid& egrid = xs_.energy_grid();
+  const double dE = Er - egrid[i];
+  const double m = (pdf_[i + 1] - pdf_[i]) / (egrid[i + 1] - egrid[i]);
+  return cdf_[i] + dE * (pdf_[i] + 0.5 * m * dE);
+}
+
+double ElasticRVS::invert_cdf(double c, std::size_t i_min,
+                              std::size_t i_max) const {
+  const EnergyGrid& egrid = xs_.energy_grid();
+
+  // Find the interval l such that cdf_[l] <= c < cdf_[l+1]
+  const auto cdf_begin = cdf_.begin() + static_cast<std::ptrdiff_t>(i_min + 1);
+  const auto cdf_end = cdf_.begin() + static_cast<std::ptrdiff_t>(i_max + 1);
+  const std::size_t l = static_cast<std::size_t>(
+      std::upper_bound(cdf_begin, cdf_end, c) - cdf_.begin() - 1);
+
+  // Invert the quadratic CDF of the interval. This form of the solution is
+  // stable for both positive and negative slopes, and reduces to the
+  // histogram solution when the slope is zero.
+  const double dc = c - cdf_[l];
+  const double f = pdf_[l];
+  const double m = (pdf_[l + 1] - f) / (egrid[l + 1] - egrid[l]);
+  const double denom = f + std::sqrt(std::max(0., f * f + 2. * m * dc));
+  if (denom <= 0.) return egrid[l];
+
+  return egrid[l] + 2. * dc / denom;
+}
+
+template <class RNG>
+std::array<double, 3> ElasticRVS::sample_target_velocity_impl(
+    const double& Ein, const double& kT, const double& awr, RNG& rng) const {
+  const EnergyGrid& egrid = xs_.energy_grid();
+
+  // Get min and max relative energies, based on incident energy. These are
+  // restricted to the energy grid of the 0K cross section.
+  const double y = std::sqrt(awr * Ein / kT);
+  const double y_min = std::max(0., y - 4.);
+  const double y_max = y + 4.;
+  const double Er_min = std::max(y_min * y_min * kT / awr, egrid.min_energy());
+  const double Er_max = std::min(y_max * y_max * kT / awr, egrid.max_energy());
+
+  const std::size_t i_min =
+      std::min(egrid.get_lower_index(Er_min), egrid.size() - 2);
+  const std::size_t i_max =
+      std::min(egrid.get_lower_index(Er_max), egrid.size() - 2);
+  const double c_min = cdf_value(Er_min, i_min);
+  const double c_max = cdf_value(Er_max, i_max);
+
+  // If there is no scattering in the window of relative energies, the
+  // cross section is effectively constant (and zero).
+  if (Er_max <= Er_min || c_max <= c_min) {
+    const static ElasticSVT svt;
+    return svt.sample_target_velocity(Ein, kT, awr, rng);
+  }
+
+  // Sample the relative energy from sqrt(Er) * xs(Er), and reject on the
+  // Maxwellian factor of the free-gas kernel.
+  double Er = 0.;
+  double x = 0.;
+  bool sample_energy = true;
+  while (sample_energy) {
+    Er = invert_cdf(c_min + rng() * (c_max - c_min), i_min, i_max);
+    Er = std::clamp(Er, Er_min, Er_max);
+    x = std::sqrt(awr * Er / kT);
+
+    const double P_accept =
+        std::exp(-(x - y) * (x - y)) - std::exp(-(x + y) * (x + y));
+
+    if (rng() < P_accept) sample_energy = false;
+  }
+
+  // Sample the cosine between the incident and relative velocities, which
+  // is distributed as exp(2*x*y*mu).
+  const double a = 2. * x * y;
+  double mu = 0.;
+  if (a > 0.) {
+    mu = 1. + std::log(1. - rng() * (1. - std::exp(-2. * a))) / a;
+  } else {
+    mu = 2. * rng() - 1.;
+  }
+  mu = std::clamp(mu, -1., 1.);
+
+  // The target velocity is the difference of the incident and relative
+  // velocities. The incident neutron is always along the z-axis.
+  const Vector v_n(0., 0., std::sqrt(Ein));
+  const Vector u_n(0., 0., 1.);
+  const Vector v_r = u_n.rotate(mu, 2. * PI * rng()) * std::sqrt(Er);
+
+  return (v_n - v_r).array();
+}
+
+std::array<double, 3> ElasticRVS::sample_target_velocity(
+    const double& Ein, const double& kT, const double& awr,
+    const std::function<double()>& rng) const {
+  return this->sample_target_velocity_impl(Ein, kT, awr, rng);
+}
+
+std::array<double, 3> ElasticRVS::sample_target_velocity(
+    const double& Ein, const double& kT, const double& awr,
+    RNGStream& rng) const {
+  return this->sample_target_velocity_impl(Ein, kT, awr, rng);
+}
+
+std::string ElasticRVS::algorithm() const { return "RVS"; }
+
+}  // namespace pndl
+
+/*
+ * REFERENCES
+ *
+ * [1] P. K. Romano and J. A. Walsh, “An improved target velocity sampling
+ * algorithm for free gas elastic scattering,” Ann Nucl Energy, vol. 114, no.
+ * Ann.  Nucl. Energy 36 2009, pp. 318–324, 2018,
+ * doi: 10.1016/j.anucene.2017.12.044.
+ */
@@ -22,16 +22,20 @@
  * */
 
 #include <PapillonNDL/elastic_svt.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <numeric>
+#include <vector>
 
 #include "vector.hpp"
 
 namespace pndl {
 
-std::array<double, 3> ElasticSVT::sample_target_velocity(
-    const double& Ein, const double& kT, const double& awr,
-    const std::function<double()>& rng) const {
+template <class RNG>
+std::array<double, 3> ElasticSVT::sample_target_velocity_impl(
+    const double& Ein, const double& kT, const double& awr, RNG& rng) const {
   const double y = std::sqrt(awr * Ein / kT);
   double x_sqrd = 0.;
   double mu = 0.;
@@ -68,6 +72,124 @@ std::array<double, 3> ElasticSVT::sample_target_velocity(
   return (u_t * s_t).array();
 }
 
+std::array<double, 3> ElasticSVT::sample_target_velocity(
+    const double& Ein, const double& kT, const double& awr,
+    const std::function<double()>& rng) const {
+  return this->sample_target_velocity_impl(Ein, kT, awr, rng);
+}
+
+std::array<double, 3> ElasticSVT::sample_target_velocity(
+    const double& Ein, const double& kT, const double& awr,
+    RNGStream& rng) const {
+  return this->sample_target_velocity_impl(Ein, kT, awr, rng);
+}
+
+template <class RNG>
+void ElasticSVT::sample_target_velocities_impl(
+    std::span<const double> Ein, const double& kT, const double& awr, RNG& rng,
+    std::span<std::array<double, 3>> vt) const {
+  if (Ein.size() != vt.size()) {
+    std::string mssg = "Ein and vt must have the same size. Ein.size() = " +
+                       std::to_string(Ein.size()) +
+                       ", vt.size() = " + std::to_string(vt.size()) + ".";
+    throw PNDLException(mssg);
+  }
+
+  const std::size_t N = Ein.size();
+
+  // Reduced incident speed, and probability of sampling from C49, for each
+  // neutron in the batch.
+  std::vector<double> y(N, 0.);
+  std::vector<double> P_C49(N, 0.);
+  for (std::size_t i = 0; i < N; i++) {
+    y[i] = std::sqrt(awr * Ein[i] / kT);
+    P_C49[i] = 2. / (std::sqrt(PI) * y[i] + 2.);
+  }
+
+  // Accepted values of x^2 and mu for each neutron in the batch
+  std::vector<double> x_sqrd(N, 0.);
+  std::vector<double> mu(N, 0.);
+
+  // Each pass of the rejection loop works on the list of lanes which have not
+  // yet been accepted. All random numbers for a pass are drawn up front, and
+  // the trial values are computed for every lane without branching. Accepted
+  // lanes are then masked out, and the remaining lanes are compacted for the
+  // next pass.
+  constexpr std::size_t NXI = 6;
+  std::vector<std::size_t> active(N, 0);
+  std::iota(active.begin(), active.end(), 0);
+  std::vector<double> xi(NXI * N, 0.);
+  std::vector<double> trial_x_sqrd(N, 0.);
+  std::vector<double> trial_mu(N, 0.);
+  std::vector<std::uint8_t> accepted(N, 0);
+
+  while (active.empty() == false) {
+    const std::size_t M = active.size();
+    for (std::size_t k = 0; k < NXI * M; k++) xi[k] = rng();
+
+    const double* xi_branch = xi.data();
+    const double* xi_1 = xi_branch + M;
+    const double* xi_2 = xi_1 + M;
+    const double* xi_c = xi_2 + M;
+    const double* xi_mu = xi_c + M;
+    const double* xi_accept = xi_mu + M;
+
+    for (std::size_t k = 0; k < M; k++) {
+      const std::size_t j = active[k];
+
+      // Sampling x from C49 or C61 only differs by the factor on the second
+      // logarithm, which is 1 for C49 and cos^2 for C61.
+      const double c = std::cos(PI / 2.0 * xi_c[k]);
+      const double f = xi_branch[k] < P_C49[j] ? 1. : c * c;
+      const double xs = -std::log(xi_1[k]) - std::log(xi_2[k]) * f;
+      const double x = std::sqrt(xs);
+      const double m = 2. * xi_mu[k] - 1.;
+      const double P_accept =
+          std::sqrt(y[j] * y[j] + xs - 2. * y[j] * x * m) / (x + y[j]);
+
+      trial_x_sqrd[k] = xs;
+      trial_mu[k] = m;
+      accepted[k] = xi_accept[k] < P_accept;
+    }
+
+    std::size_t n_active = 0;
+    for (std::size_t k = 0; k < M; k++) {
+      const std::size_t j = active[k];
+      if (accepted[k]) {
+        x_sqrd[j] = trial_x_sqrd[k];
+        mu[j] = trial_mu[k];
+      } else {
+        active[n_active++] = j;
+      }
+    }
+    active.resize(n_active);
+  }
+
+  // Get the target velocities. The incident neutron is always along the
+  // z-axis, so rotating (0,0,1) by mu and phi gives the target direction.
+  for (std::size_t i = 0; i < N; i++) xi[i] = 2. * PI * rng();
+  for (std::size_t i = 0; i < N; i++) {
+    const double s_t = std::sqrt(x_sqrd[i] * kT / awr);
+    const double C = std::sqrt(std::max(0., 1. - mu[i] * mu[i]));
+    vt[i][0] = s_t * C * std::sin(xi[i]);
+    vt[i][1] = -s_t * C * std::cos(xi[i]);
+    vt[i][2] = s_t * mu[i];
+  }
+}
+
+void ElasticSVT::sample_target_velocities(
+    std::span<const double> Ein, const double& kT, const double& awr,
+    const std::function<double()>& rng,
+    std::span<std::array<double, 3>> vt) const {
+  this->sample_target_velocities_impl(Ein, kT, awr, rng, vt);
+}
+
+void ElasticSVT::sample_target_velocities(
+    std::span<const double> Ein, const double& kT, const double& awr,
+    RNGStream& rng, std::span<std::array<double, 3>> vt) const {
+  this->sample_target_velocities_impl(Ein, kT, awr, rng, vt);
+}
+
 std::string ElasticSVT::algorithm() const { return "SVT"; }
 
 }  // namespace pndl
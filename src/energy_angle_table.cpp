@@ -27,7 +27,12 @@ namespace pndl {
 
 EnergyAngleTable::EnergyAngleTable(const ACE& ace, std::size_t i,
                                    std::size_t JED)
-    : energy_(), pdf_(), cdf_(), angles_(), interp_() {
+    : arena_(),
+      points_(nullptr),
+      size_(0),
+      angles_(),
+      interp_(),
+      guide_() {
   interp_ = ace.xss<Interpolation>(i);
   if ((interp_ != Interpolation::Histogram) &&
       (interp_ != Interpolation::LinLin)) {
@@ -38,47 +43,47 @@ EnergyAngleTable::EnergyAngleTable(const ACE& ace, std::size_t i,
     throw PNDLException(mssg);
   }
   uint32_t NP = ace.xss<uint32_t>(i + 1);
-  energy_ = ace.xss(i + 2, NP);
+  std::vector<double> energy = ace.xss(i + 2, NP);
 
-  pdf_ = ace.xss(i + 2 + NP, NP);
-  cdf_ = ace.xss(i + 2 + NP + NP, NP);
+  std::vector<double> pdf = ace.xss(i + 2 + NP, NP);
+  std::vector<double> cdf = ace.xss(i + 2 + NP + NP, NP);
 
-  if (!std::is_sorted(energy_.begin(), energy_.end())) {
+  if (!std::is_sorted(energy.begin(), energy.end())) {
     std::string mssg =
         "Energies are not sorted. Index of EnergyAngleTable in XSS block is " +
         std::to_string(i) + ".";
     throw PNDLException(mssg);
   }
 
-  if (!std::is_sorted(cdf_.begin(), cdf_.end())) {
+  if (!std::is_sorted(cdf.begin(), cdf.end())) {
     std::string mssg =
         "CDF is not sorted. Index of EnergyAngleTable in XSS block is " +
         std::to_string(i) + ".";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[0] != 0.) {
+  if (cdf[0] != 0.) {
     std::string mssg = "First CDF entry is not 0, but " +
-                       std::to_string(cdf_[0]) +
+                       std::to_string(cdf[0]) +
                        ". Index of EnergyAngleTable in XSS block is " +
                        std::to_string(i) + ".";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[cdf_.size() - 1] != 1.) {
+  if (cdf[cdf.size() - 1] != 1.) {
     // If last element is close to 1, just set it to exactly 1
-    if (std::abs(cdf_[cdf_.size() - 1] - 1.) < 1.E-7) {
-      cdf_[cdf_.size() - 1] = 1.;
+    if (std::abs(cdf[cdf.size() - 1] - 1.) < 1.E-7) {
+      cdf[cdf.size() - 1] = 1.;
     } else {
       std::string mssg = "Last CDF entry is not 1, but " +
-                         std::to_string(cdf_[cdf_.size() - 1]) +
+                         std::to_string(cdf[cdf.size() - 1]) +
                          ". Index of EnergyAngleTable in XSS block is " +
                          std::to_string(i) + ".";
       throw PNDLException(mssg);
     }
   }
 
-  for (const auto& p : pdf_) {
+  for (const auto& p : pdf) {
     if (p < 0.) {
       std::string mssg =
           "Negative value found in PDF. Index of PCTable in XSS block is " +
@@ -96,13 +101,16 @@ EnergyAngleTable::EnergyAngleTable(const ACE& ace, std::size_t i,
     } catch (PNDLException& error) {
       std::string mssg = "Couldn't create angle table for " +
                          std::to_string(j) + "th energy " +
-                         std::to_string(energy_[j]) +
+                         std::to_string(energy[j]) +
                          " MeV. Index of EnergyAngleTable in XSS block is " +
                          std::to_string(i) + ".";
       error.add_to_exception(mssg);
       throw error;
     }
   }
+
+  set_points(energy, pdf, cdf);
+  guide_ = GuideTable(cdf);
 }
 
 EnergyAngleTable::EnergyAngleTable(const std::vector<double>& outgoing_energy,
@@ -110,11 +118,12 @@ EnergyAngleTable::EnergyAngleTable(const std::vector<double>& outgoing_energy,
                                    const std::vector<double>& cdf,
                                    const std::vector<PCTable>& angle_tables,
                                    Interpolation interp)
-    : energy_(outgoing_energy),
-      pdf_(pdf),
-      cdf_(cdf),
+    : arena_(),
+      points_(nullptr),
+      size_(0),
       angles_(angle_tables),
-      interp_(interp) {
+      interp_(interp),
+      guide_() {
   if ((interp_ != Interpolation::Histogram) &&
       (interp_ != Interpolation::LinLin)) {
     std::string mssg = "Invalid interpolation of " +
@@ -122,47 +131,90 @@ EnergyAngleTable::EnergyAngleTable(const std::vector<double>& outgoing_energy,
     throw PNDLException(mssg);
   }
 
-  if (!std::is_sorted(energy_.begin(), energy_.end())) {
+  if (!std::is_sorted(outgoing_energy.begin(), outgoing_energy.end())) {
     std::string mssg = "Energies are not sorted.";
     throw PNDLException(mssg);
   }
 
-  if (!std::is_sorted(cdf_.begin(), cdf_.end())) {
+  if (!std::is_sorted(cdf.begin(), cdf.end())) {
     std::string mssg = "CDF is not sorted.";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[0] != 0.) {
+  if (cdf[0] != 0.) {
     std::string mssg =
-        "First CDF entry is not 0, but " + std::to_string(cdf_[0]) + ".";
+        "First CDF entry is not 0, but " + std::to_string(cdf[0]) + ".";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[cdf_.size() - 1] != 1.) {
+  std::vector<double> cdf_1 = cdf;
+  if (cdf_1[cdf_1.size() - 1] != 1.) {
     // If last element is close to 1, just set it to exactly 1
-    if (std::abs(cdf_[cdf_.size() - 1] - 1.) < 1.E-7) {
-      cdf_[cdf_.size() - 1] = 1.;
+    if (std::abs(cdf_1[cdf_1.size() - 1] - 1.) < 1.E-7) {
+      cdf_1[cdf_1.size() - 1] = 1.;
     } else {
       std::string mssg = "Last CDF entry is not 1, but " +
-                         std::to_string(cdf_[cdf_.size() - 1]) + ".";
+                         std::to_string(cdf_1[cdf_1.size() - 1]) + ".";
       throw PNDLException(mssg);
     }
   }
 
-  for (const auto& p : pdf_) {
+  for (const auto& p : pdf) {
     if (p < 0.) {
       std::string mssg = "Negative value found in PDF.";
       throw PNDLException(mssg);
     }
   }
+
+  set_points(outgoing_energy, pdf, cdf_1);
+  guide_ = GuideTable(cdf_1);
 }
 
 EnergyAngleTable::EnergyAngleTable(const PCTable& outgoing_energy,
                                    const std::vector<PCTable>& angle_tables)
-    : energy_(outgoing_energy.values()),
-      pdf_(outgoing_energy.pdf()),
-      cdf_(outgoing_energy.cdf()),
+    : arena_(),
+      points_(nullptr),
+      size_(0),
       angles_(angle_tables),
-      interp_(outgoing_energy.interpolation()) {}
+      interp_(outgoing_energy.interpolation()),
+      guide_(outgoing_energy.cdf()) {
+  set_points(outgoing_energy.values(), outgoing_energy.pdf(),
+             outgoing_energy.cdf());
+}
+
+void EnergyAngleTable::set_points(const std::vector<double>& energy,
+                                  const std::vector<double>& pdf,
+                                  const std::vector<double>& cdf) {
+  auto points = std::make_shared<std::vector<Point>>();
+  points->reserve(energy.size());
+  for (std::size_t j = 0; j < energy.size(); j++) {
+    points->push_back({energy[j], pdf[j], cdf[j]});
+  }
+
+  points_ = points->data();
+  size_ = points->size();
+  arena_ = points;
+}
+
+void EnergyAngleTable::pack(std::vector<EnergyAngleTable>& tables) {
+  std::size_t NP = 0;
+  for (const auto& table : tables) NP += table.size_;
+
+  // The offset of each table is recorded while copying its points, as the
+  // pointers into the arena can only be set once it is complete.
+  auto arena = std::make_shared<std::vector<Point>>();
+  arena->reserve(NP);
+  std::vector<std::size_t> offsets;
+  offsets.reserve(tables.size());
+  for (const auto& table : tables) {
+    offsets.push_back(arena->size());
+    arena->insert(arena->end(), table.points_, table.points_ + table.size_);
+  }
+
+  for (std::size_t j = 0; j < tables.size(); j++) {
+    tables[j].points_ = arena->data() + offsets[j];
+    tables[j].arena_ = arena;
+  }
+}
 
 }  // namespace pndl
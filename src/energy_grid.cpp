@@ -24,17 +24,19 @@
 #include <PapillonNDL/pndl_exception.hpp>
 #include <algorithm>
 
+#include "memory.hpp"
+
 namespace pndl {
 
-EnergyGrid::EnergyGrid(const ACE& ace, uint32_t NBINS)
-    : energy_values_({0.}),
-      bin_pointers_(),
+EnergyGrid::EnergyGrid(const ACE& ace, uint32_t NBINS,
+                       std::shared_ptr<std::pmr::memory_resource> memory)
+    : memory_(detail::memory_or_default(memory)),
+      energy_values_(ace.xss_data() + ace.ESZ(),
+                     ace.xss_data() + ace.ESZ() + ace.nxs(2), memory_.get()),
+      bin_pointers_(memory_.get()),
       u_min(),
       du(),
       urr_start_energy_() {
-  energy_values_ = ace.xss(static_cast<std::size_t>(ace.ESZ()),
-                           static_cast<std::size_t>(ace.nxs(2)));
-
   // Check if there are URR tables.
   if (ace.jxs(22) != 0) {
     // There are URR tables. Get the starting energy.
@@ -62,8 +64,13 @@ EnergyGrid::EnergyGrid(const ACE& ace, uint32_t NBINS)
   hash_energy_grid(NBINS);
 }
 
-EnergyGrid::EnergyGrid(const std::vector<double>& energy, uint32_t NBINS)
-    : energy_values_(energy), bin_pointers_(), u_min(), du() {
+EnergyGrid::EnergyGrid(const std::vector<double>& energy, uint32_t NBINS,
+                       std::shared_ptr<std::pmr::memory_resource> memory)
+    : memory_(detail::memory_or_default(memory)),
+      energy_values_(energy.begin(), energy.end(), memory_.get()),
+      bin_pointers_(memory_.get()),
+      u_min(),
+      du() {
   if (!std::is_sorted(energy_values_.begin(), energy_values_.end())) {
     std::string mssg = "Energy values are not sorted.";
     throw PNDLException(mssg);
@@ -0,0 +1,52 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/energy_grid_map.hpp>
+#include <utility>
+
+namespace pndl {
+
+void EnergyGridMap::add(const EnergyGrid& grid,
+                        std::span<const double> energy) {
+  if (this->has(grid) || energy.empty()) return;
+
+  // Only the intervals of the grid which lie between the first and last
+  // incident energies need to be stored.
+  const auto egrid = grid.grid();
+  const std::size_t begin = static_cast<std::size_t>(
+      std::lower_bound(egrid.begin(), egrid.end(), energy.front()) -
+      egrid.begin());
+  const std::size_t end = static_cast<std::size_t>(
+      std::lower_bound(egrid.begin(), egrid.end(), energy.back()) -
+      egrid.begin());
+
+  Map map{&grid, begin, std::vector<uint32_t>(end - begin, 0)};
+  std::size_t l = 0;
+  for (std::size_t i = begin; i < end; i++) {
+    while (l < energy.size() && energy[l] <= egrid[i]) l++;
+    map.indices[i - begin] = static_cast<uint32_t>(l);
+  }
+
+  maps_.push_back(std::move(map));
+}
+
+}  // namespace pndl
@@ -77,21 +77,6 @@ EquiprobableAngleBins::EquiprobableAngleBins(const std::vector<double>& bounds)
   }
 }
 
-double EquiprobableAngleBins::sample_mu(
-    const std::function<double()>& rng) const {
-  const double xi = rng();
-  std::size_t bin =
-      static_cast<std::size_t>(std::floor(static_cast<double>(NBOUNDS) * xi));
-  if (bin == NBOUNDS) bin--;
-  double C_b = static_cast<double>(bin) * P_BIN;
-  double mu_low = bounds_[bin];
-  double mu = ((xi - C_b) / P_BIN) + mu_low;
-
-  if (std::abs(mu) > 1.) mu = std::copysign(1, mu);
-
-  return mu;
-}
-
 double EquiprobableAngleBins::pdf(double mu) const {
   if (mu < bounds_.front() || mu > bounds_.back()) return 0.;
 
@@ -93,31 +93,6 @@ EquiprobableEnergyBins::EquiprobableEnergyBins(
   }
 }
 
-double EquiprobableEnergyBins::sample_energy(
-    double E_in, const std::function<double()>& rng) const {
-  // Determine the index of the bounding tabulated incoming energies
-  auto in_E_it =
-      std::lower_bound(incoming_energy_.begin(), incoming_energy_.end(), E_in);
-  if (in_E_it == incoming_energy_.begin()) {
-    return sample_bins(rng(), rng(), bin_sets_.front());
-  } else if (in_E_it == incoming_energy_.end()) {
-    return sample_bins(rng(), rng(), bin_sets_.back());
-  }
-
-  std::size_t l = static_cast<std::size_t>(
-      std::distance(incoming_energy_.begin(), in_E_it));
-  l--;
-
-  double f = (E_in - incoming_energy_[l]) /
-             (incoming_energy_[l + 1] - incoming_energy_[l]);
-
-  if (rng() > f) {
-    return sample_bins(rng(), rng(), bin_sets_[l]);
-  } else {
-    return sample_bins(rng(), rng(), bin_sets_[l + 1]);
-  }
-}
-
 std::optional<double> EquiprobableEnergyBins::pdf(double E_in,
                                                   double E_out) const {
   // Determine the index of the bounding tabulated incoming energies
@@ -140,15 +115,8 @@ std::optional<double> EquiprobableEnergyBins::pdf(double E_in,
          f * pdf_bins(E_out, bin_sets_[l + 1]);
 }
 
-double EquiprobableEnergyBins::sample_bins(
-    double xi1, double xi2, const std::vector<double>& bounds) const {
-  std::size_t bin = static_cast<std::size_t>(
-      std::floor(static_cast<double>(bounds.size()) * xi1));
-  return (bounds[bin + 1] - bounds[bin]) * xi2 + bounds[bin];
-}
-
 double EquiprobableEnergyBins::pdf_bins(
-    double E_out, const std::vector<double>& bounds) const {
+    double E_out, std::span<const double> bounds) const {
   if (E_out < bounds.front() || E_out > bounds.back()) return 0;
 
   std::size_t bin = 0;
@@ -24,10 +24,15 @@
 #include <PapillonNDL/tabulated_1d.hpp>
 #include <cmath>
 
+#include "spectrum_table.hpp"
+
 namespace pndl {
 
 Evaporation::Evaporation(const ACE& ace, std::size_t i)
-    : temperature_(), restriction_energy_() {
+    : temperature_(),
+      compiled_temperature_(),
+      restriction_energy_(),
+      tabulated_(false) {
   uint32_t NR = ace.xss<uint32_t>(i);
   uint32_t NE = ace.xss<uint32_t>(i + 1 + 2 * NR);
   std::vector<uint32_t> NBT;
@@ -52,6 +57,8 @@ Evaporation::Evaporation(const ACE& ace, std::size_t i)
   // Create Function1D pointer
   try {
     temperature_ = std::make_shared<Tabulated1D>(NBT, INT, energy, temperature);
+    compiled_temperature_ =
+        std::make_shared<CompiledTabulated1D>(*temperature_);
   } catch (PNDLException& error) {
     std::string mssg =
         "Could not construct Tabular1D for the effective nuclear temperature. "
@@ -64,11 +71,26 @@ Evaporation::Evaporation(const ACE& ace, std::size_t i)
 
 Evaporation::Evaporation(std::shared_ptr<Tabulated1D> temperature,
                          double restriction_energy)
-    : temperature_(temperature), restriction_energy_(restriction_energy) {}
+    : temperature_(temperature),
+      compiled_temperature_(
+          std::make_shared<CompiledTabulated1D>(*temperature_)),
+      restriction_energy_(restriction_energy),
+      tabulated_(false) {}
+
+void Evaporation::set_tabulated(bool tabulated) {
+  if (tabulated) detail::evaporation_spectrum_table();
+  tabulated_ = tabulated;
+}
+
+template <class RNG>
+double Evaporation::sample_energy_impl(double E_in, RNG& rng) const {
+  double T = (*compiled_temperature_)(E_in);
+
+  if (tabulated_) {
+    const double x_max = (E_in - restriction_energy_) / T;
+    return T * detail::evaporation_spectrum_table().sample(rng, x_max);
+  }
 
-double Evaporation::sample_energy(double E_in,
-                                  const std::function<double()>& rng) const {
-  double T = (*temperature_)(E_in);
   double xi1 = 0.;
   double xi2 = 0.;
   double g = 0.;
@@ -90,11 +112,20 @@ double Evaporation::sample_energy(double E_in,
   return E_out;
 }
 
+double Evaporation::sample_energy(double E_in,
+                                  const std::function<double()>& rng) const {
+  return this->sample_energy_impl(E_in, rng);
+}
+
+double Evaporation::sample_energy(double E_in, RNGStream& rng) const {
+  return this->sample_energy_impl(E_in, rng);
+}
+
 std::optional<double> Evaporation::pdf(double E_in, double E_out) const {
   double du = E_in - restriction_energy_;
   if (E_out < 0. || E_out > du) return 0.;
 
-  double T = (*temperature_)(E_in);
+  double T = (*compiled_temperature_)(E_in);
   double I = T * T * (1. - std::exp(-du / T) * (1. + (du / T)));
   return (E_out / I) * std::exp(-E_out / T);
 }
@@ -30,15 +30,22 @@
 #include <PapillonNDL/sum_1d.hpp>
 #include <PapillonNDL/summed_fission_spectrum.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
+#include <algorithm>
 #include <memory>
 
+#include "memory.hpp"
+
 namespace pndl {
 
-Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid)
+Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
+                 std::shared_ptr<std::pmr::memory_resource> memory)
     : zaid_(ace.zaid()),
+      energy_grid_(energy_grid),
       nu_total_(nullptr),
       nu_prompt_(nullptr),
       nu_delayed_(nullptr),
+      nu_total_grid_(nullptr),
+      nu_delayed_grid_(nullptr),
       mt18_(nullptr),
       mt19_(nullptr),
       mt20_(nullptr),
@@ -46,6 +53,8 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid)
       mt38_(nullptr),
       prompt_spectrum_(nullptr),
       delayed_families_(),
+      family_energy_(),
+      family_sums_(),
       mt_list_() {
   if (ace.fissile() == false) {
     nu_total_ = std::make_shared<Constant>(0.);
@@ -136,6 +145,8 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid)
           g++;
         }
       }
+
+      tabulate_delayed_families();
     } catch (PNDLException& err) {
       std::string mssg = "Could not read delayed families.";
       err.add_to_exception(mssg);
@@ -150,19 +161,24 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid)
         uint32_t MT =
             ace.xss<uint32_t>(static_cast<std::size_t>(ace.MTR()) + indx);
         if (MT == 18) {
-          mt18_ = std::make_shared<STReaction>(ace, indx, energy_grid);
+          mt18_ =
+              std::make_shared<STReaction>(ace, indx, energy_grid, memory);
           mt_list_.push_back(18);
         } else if (MT == 19) {
-          mt19_ = std::make_shared<STReaction>(ace, indx, energy_grid);
+          mt19_ =
+              std::make_shared<STReaction>(ace, indx, energy_grid, memory);
           mt_list_.push_back(19);
         } else if (MT == 20) {
-          mt20_ = std::make_shared<STReaction>(ace, indx, energy_grid);
+          mt20_ =
+              std::make_shared<STReaction>(ace, indx, energy_grid, memory);
           mt_list_.push_back(20);
         } else if (MT == 21) {
-          mt21_ = std::make_shared<STReaction>(ace, indx, energy_grid);
+          mt21_ =
+              std::make_shared<STReaction>(ace, indx, energy_grid, memory);
           mt_list_.push_back(21);
         } else if (MT == 38) {
-          mt38_ = std::make_shared<STReaction>(ace, indx, energy_grid);
+          mt38_ =
+              std::make_shared<STReaction>(ace, indx, energy_grid, memory);
           mt_list_.push_back(38);
         }
       }
@@ -191,14 +207,21 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid)
       throw err;
     }
   }
+
+  nu_total_grid_ = tabulate_nu(*nu_total_, memory);
+  nu_delayed_grid_ = tabulate_nu(*nu_delayed_, memory);
 }
 
 Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
-                 const Fission& fission)
+                 const Fission& fission,
+                 std::shared_ptr<std::pmr::memory_resource> memory)
     : zaid_(ace.zaid()),
+      energy_grid_(energy_grid),
       nu_total_(fission.nu_total_),
       nu_prompt_(fission.nu_prompt_),
       nu_delayed_(fission.nu_delayed_),
+      nu_total_grid_(nullptr),
+      nu_delayed_grid_(nullptr),
       mt18_(nullptr),
       mt19_(nullptr),
       mt20_(nullptr),
@@ -206,6 +229,8 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
       mt38_(nullptr),
       prompt_spectrum_(nullptr),
       delayed_families_(fission.delayed_families_),
+      family_energy_(fission.family_energy_),
+      family_sums_(fission.family_sums_),
       mt_list_() {
   if (ace.fissile() == false) {
     prompt_spectrum_ = fission.prompt_spectrum_;
@@ -219,23 +244,23 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
             ace.xss<uint32_t>(static_cast<std::size_t>(ace.MTR()) + indx);
         if (MT == 18) {
           mt18_ = std::make_shared<STReaction>(ace, indx, energy_grid,
-                                               *fission.mt18_);
+                                               *fission.mt18_, memory);
           mt_list_.push_back(18);
         } else if (MT == 19) {
           mt19_ = std::make_shared<STReaction>(ace, indx, energy_grid,
-                                               *fission.mt19_);
+                                               *fission.mt19_, memory);
           mt_list_.push_back(19);
         } else if (MT == 20) {
           mt20_ = std::make_shared<STReaction>(ace, indx, energy_grid,
-                                               *fission.mt20_);
+                                               *fission.mt20_, memory);
           mt_list_.push_back(20);
         } else if (MT == 21) {
           mt21_ = std::make_shared<STReaction>(ace, indx, energy_grid,
-                                               *fission.mt21_);
+                                               *fission.mt21_, memory);
           mt_list_.push_back(21);
         } else if (MT == 38) {
           mt38_ = std::make_shared<STReaction>(ace, indx, energy_grid,
-                                               *fission.mt38_);
+                                               *fission.mt38_, memory);
           mt_list_.push_back(38);
         }
       }
@@ -264,6 +289,9 @@ Fission::Fission(const ACE& ace, std::shared_ptr<EnergyGrid> energy_grid,
       throw err;
     }
   }
+
+  nu_total_grid_ = tabulate_nu(*nu_total_, memory);
+  nu_delayed_grid_ = tabulate_nu(*nu_delayed_, memory);
 }
 
 std::shared_ptr<Function1D> Fission::read_nu(const ACE& ace, std::size_t i) {
@@ -301,4 +329,95 @@ std::shared_ptr<Function1D> Fission::read_tabular_nu(const ACE& ace,
     return std::make_shared<Tabulated1D>(breaks, interps, energy, y);
   }
 }
+
+void Fission::tabulate_delayed_families() {
+  family_energy_.clear();
+  family_sums_.clear();
+  if (delayed_families_.empty()) return;
+
+  // The partial sums of the probabilities are linear between the union of
+  // the energies only if every family probability is linear between its own
+  // points. The sums are kept unnormalized, as the ratio of two linear
+  // functions is not itself linear.
+  for (const auto& family : delayed_families_) {
+    for (const auto& interp : family.probability().interpolation()) {
+      if (interp != Interpolation::LinLin) return;
+    }
+  }
+
+  for (const auto& family : delayed_families_) {
+    const auto& energy = family.probability().x();
+    family_energy_.insert(family_energy_.end(), energy.begin(), energy.end());
+  }
+  std::sort(family_energy_.begin(), family_energy_.end());
+  family_energy_.erase(
+      std::unique(family_energy_.begin(), family_energy_.end()),
+      family_energy_.end());
+
+  const std::size_t NG = delayed_families_.size();
+  family_sums_.resize(NG * family_energy_.size(), 0.);
+  for (std::size_t p = 0; p < family_energy_.size(); p++) {
+    double* sums = family_sums_.data() + NG * p;
+    double P = 0.;
+    for (std::size_t g = 0; g < NG; g++) {
+      P += std::max(delayed_families_[g].probability()(family_energy_[p]), 0.);
+      sums[g] = P;
+    }
+  }
+}
+
+std::shared_ptr<CrossSection> Fission::tabulate_nu(
+    const Function1D& nu,
+    std::shared_ptr<std::pmr::memory_resource> memory) const {
+  // Without any fission reactions, nu is zero everywhere
+  if (mt_list_.empty()) {
+    return detail::make_shared<CrossSection>(memory, 0., energy_grid_, memory);
+  }
+
+  std::vector<double> values(energy_grid_->size(), 0.);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = std::max(nu((*energy_grid_)[i]), 0.);
+  }
+
+  return detail::make_shared<CrossSection>(memory, values, energy_grid_, 0,
+                                           memory);
+}
+
+std::size_t Fission::sample_fission_neutrons(
+    double E_in, std::size_t i, std::size_t n, RNGStream& rng,
+    std::vector<FissionNeutron>& neutrons) const {
+  const double nu_t = this->nu_total(E_in, i);
+  const double nu_d =
+      delayed_families_.empty() ? 0. : this->nu_delayed(E_in, i);
+  if (nu_t <= 0.) return 0;
+
+  const std::size_t start = neutrons.size();
+  neutrons.reserve(start + n * static_cast<std::size_t>(nu_t + 1.));
+
+  for (std::size_t e = 0; e < n; e++) {
+    const std::size_t n_neutrons = static_cast<std::size_t>(nu_t + rng());
+
+    for (std::size_t k = 0; k < n_neutrons; k++) {
+      FissionNeutron neutron{0., 0., 0};
+
+      if (rng() * nu_t < nu_d) {
+        const std::size_t g = this->select_delayed_family(E_in, rng());
+        neutron.cosine_angle = 2. * rng() - 1.;
+        neutron.energy =
+            delayed_families_[g].sample_energy(E_in, *energy_grid_, i, rng);
+        neutron.family = static_cast<uint32_t>(g + 1);
+      } else {
+        const AngleEnergyPacket out =
+            prompt_spectrum_->sample_angle_energy(E_in, *energy_grid_, i, rng);
+        neutron.cosine_angle = out.cosine_angle;
+        neutron.energy = out.energy;
+      }
+
+      neutrons.push_back(neutron);
+    }
+  }
+
+  return neutrons.size() - start;
+}
+
 }  // namespace pndl
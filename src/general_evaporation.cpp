@@ -27,7 +27,7 @@
 namespace pndl {
 
 GeneralEvaporation::GeneralEvaporation(const ACE& ace, std::size_t i)
-    : temperature_(), bin_bounds_() {
+    : temperature_(), compiled_temperature_(), bin_bounds_() {
   uint32_t NR = ace.xss<uint32_t>(i);
   uint32_t NE = ace.xss<uint32_t>(i + 1 + 2 * NR);
   std::vector<uint32_t> NBT;
@@ -62,6 +62,8 @@ GeneralEvaporation::GeneralEvaporation(const ACE& ace, std::size_t i)
   // Create Function1D pointer
   try {
     temperature_ = std::make_shared<Tabulated1D>(NBT, INT, energy, temperature);
+    compiled_temperature_ =
+        std::make_shared<CompiledTabulated1D>(*temperature_);
   } catch (PNDLException& error) {
     std::string mssg =
         "Could not construct Tabulated1D for the effective nuclear "
@@ -75,27 +77,18 @@ GeneralEvaporation::GeneralEvaporation(const ACE& ace, std::size_t i)
 
 GeneralEvaporation::GeneralEvaporation(std::shared_ptr<Tabulated1D> temperature,
                                        const std::vector<double>& bounds)
-    : temperature_(temperature), bin_bounds_(bounds) {
+    : temperature_(temperature),
+      compiled_temperature_(
+          std::make_shared<CompiledTabulated1D>(*temperature_)),
+      bin_bounds_(bounds) {
   if (!std::is_sorted(bin_bounds_.begin(), bin_bounds_.end())) {
     std::string mssg = "Bin bounds for X are not sorted.";
     throw PNDLException(mssg);
   }
 }
 
-double GeneralEvaporation::sample_energy(
-    double E_in, const std::function<double()>& rng) const {
-  double T = (*temperature_)(E_in);
-  double xi1 = rng();
-  std::size_t bin = static_cast<std::size_t>(
-      std::floor(static_cast<double>(bin_bounds_.size()) * xi1));
-  double xi2 = rng();
-  double Chi =
-      (bin_bounds_[bin + 1] - bin_bounds_[bin]) * xi2 + bin_bounds_[bin];
-  return Chi * T;
-}
-
 std::optional<double> GeneralEvaporation::pdf(double E_in, double E_out) const {
-  double T = (*temperature_)(E_in);
+  double T = (*compiled_temperature_)(E_in);
   double Chi = E_out / T;
 
   // Go find Chi in bins
@@ -0,0 +1,44 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/guide_table.hpp>
+
+namespace pndl {
+
+GuideTable::GuideTable(const std::vector<double>& cdf) : guides_() {
+  if (cdf.empty()) return;
+
+  const std::size_t NBINS = cdf.size();
+  guides_.reserve(NBINS + 1);
+
+  // Each guide is the index of the first CDF point which is not less than
+  // the lower bound of the bin. The bounds are increasing, so all guides
+  // are found with a single pass over the CDF.
+  std::size_t i = 0;
+  for (std::size_t b = 0; b <= NBINS; b++) {
+    const double bound = static_cast<double>(b) / static_cast<double>(NBINS);
+    while (i < cdf.size() && cdf[i] < bound) i++;
+    guides_.push_back(static_cast<uint32_t>(i));
+  }
+}
+
+}  // namespace pndl
@@ -26,12 +26,6 @@
 
 namespace pndl {
 
-double Isotropic::sample_mu(const std::function<double()>& rng) const {
-  double mu = 2. * rng() - 1.;
-  if (std::abs(mu) > 1.) mu = std::copysign(1., mu);
-  return mu;
-}
-
 double Isotropic::pdf(double mu) const {
   if (mu < -1. || mu > 1.) return 0.;
   return 0.5;
@@ -61,6 +61,8 @@ Kalbach::Kalbach(const ACE& ace, std::size_t i)
       throw error;
     }
   }
+
+  KalbachTable::pack(tables_);
 }
 
 Kalbach::Kalbach(const std::vector<double>& incoming_energy,
@@ -77,24 +79,24 @@ Kalbach::Kalbach(const std::vector<double>& incoming_energy,
         "there are KalbachTables for the outgoing energy and angle.";
     throw PNDLException(mssg);
   }
+
+  KalbachTable::pack(tables_);
 }
 
-AngleEnergyPacket Kalbach::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket Kalbach::sample_angle_energy_impl(
+    double E_in, std::size_t indx, RNG& rng) const {
   // Determine the index of the bounding tabulated incoming energies
   std::size_t l;
   double f;  // Interpolation factor
-  auto in_E_it =
-      std::lower_bound(incoming_energy_.begin(), incoming_energy_.end(), E_in);
-  if (in_E_it == incoming_energy_.begin()) {
+  if (indx == 0) {
     l = 0;
     f = 0.;
-  } else if (in_E_it == incoming_energy_.end()) {
+  } else if (indx == incoming_energy_.size()) {
     l = incoming_energy_.size() - 2;
     f = 1.;
   } else {
-    l = static_cast<std::size_t>(
-        std::distance(incoming_energy_.begin(), in_E_it) - 1);
+    l = indx - 1;
     f = (E_in - incoming_energy_[l]) /
         (incoming_energy_[l + 1] - incoming_energy_[l]);
   }
@@ -107,22 +109,21 @@ AngleEnergyPacket Kalbach::sample_angle_energy(
   double Emin = E_i_1 + f * (E_i_1_1 - E_i_1);
   double Emax = E_i_M + f * (E_i_1_M - E_i_M);
 
-  double E_hat = E_in;
+  // R and A are found with the same search used to sample E_hat
+  KalbachTable::Sample smpl;
   double E_l_1, E_l_M;
-  double R, A;
   if (rng() > f) {
-    E_hat = tables_[l].sample_energy(rng());
+    smpl = tables_[l].sample(rng());
     E_l_1 = E_i_1;
     E_l_M = E_i_M;
-    R = tables_[l].R(E_hat);
-    A = tables_[l].A(E_hat);
   } else {
-    E_hat = tables_[l + 1].sample_energy(rng());
+    smpl = tables_[l + 1].sample(rng());
     E_l_1 = E_i_1_1;
     E_l_M = E_i_1_M;
-    R = tables_[l + 1].R(E_hat);
-    A = tables_[l + 1].A(E_hat);
   }
+  const double E_hat = smpl.energy;
+  const double R = smpl.R;
+  const double A = smpl.A;
 
   double E_out = Emin + ((E_hat - E_l_1) / (E_l_M - E_l_1)) * (Emax - Emin);
 
@@ -141,6 +142,24 @@ AngleEnergyPacket Kalbach::sample_angle_energy(
   return {mu, E_out};
 }
 
+AngleEnergyPacket Kalbach::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(
+      E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+}
+
+AngleEnergyPacket Kalbach::sample_angle_energy(double E_in,
+                                               RNGStream& rng) const {
+  return this->sample_angle_energy_impl(
+      E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+}
+
+AngleEnergyPacket Kalbach::sample_angle_energy(
+    double E_in, const EnergyGrid& grid, std::size_t i, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(
+      E_in, grid_map_.lower_bound(incoming_energy_, E_in, grid, i), rng);
+}
+
 std::optional<double> Kalbach::angle_pdf(double E_in, double mu) const {
   // Determine the index of the bounding tabulated incoming energies
   std::size_t l;
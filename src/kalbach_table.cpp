@@ -26,7 +26,7 @@
 namespace pndl {
 
 KalbachTable::KalbachTable(const ACE& ace, std::size_t i)
-    : energy_(), pdf_(), cdf_(), R_(), A_(), interp_() {
+    : arena_(), points_(nullptr), size_(0), interp_(), guide_() {
   interp_ = ace.xss<Interpolation>(i);
   if ((interp_ != Interpolation::Histogram) &&
       (interp_ != Interpolation::LinLin)) {
@@ -37,48 +37,48 @@ KalbachTable::KalbachTable(const ACE& ace, std::size_t i)
     throw PNDLException(mssg);
   }
   uint32_t NP = ace.xss<uint32_t>(i + 1);
-  energy_ = ace.xss(i + 2, NP);
+  std::vector<double> energy = ace.xss(i + 2, NP);
 
-  pdf_ = ace.xss(i + 2 + NP, NP);
-  cdf_ = ace.xss(i + 2 + NP + NP, NP);
-  R_ = ace.xss(i + 2 + NP + NP + NP, NP);
-  A_ = ace.xss(i + 2 + NP + NP + NP + NP, NP);
+  std::vector<double> pdf = ace.xss(i + 2 + NP, NP);
+  std::vector<double> cdf = ace.xss(i + 2 + NP + NP, NP);
+  std::vector<double> R = ace.xss(i + 2 + NP + NP + NP, NP);
+  std::vector<double> A = ace.xss(i + 2 + NP + NP + NP + NP, NP);
 
-  if (!std::is_sorted(energy_.begin(), energy_.end())) {
+  if (!std::is_sorted(energy.begin(), energy.end())) {
     std::string mssg =
         "Energies are not sorted. Index of KalbachTable in XSS block is " +
         std::to_string(i) + ".";
     throw PNDLException(mssg);
   }
 
-  if (!std::is_sorted(cdf_.begin(), cdf_.end())) {
+  if (!std::is_sorted(cdf.begin(), cdf.end())) {
     std::string mssg =
         "CDF is not sorted. Index of KalbachTable in XSS block is " +
         std::to_string(i) + ".";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[0] != 0.) {
+  if (cdf[0] != 0.) {
     std::string mssg =
-        "First CDF entry is not 0, but " + std::to_string(cdf_[0]) +
+        "First CDF entry is not 0, but " + std::to_string(cdf[0]) +
         ". Index of KalbachTable in XSS block is " + std::to_string(i) + ".";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[cdf_.size() - 1] != 1.) {
+  if (cdf[cdf.size() - 1] != 1.) {
     // If last element is close to 1, just set it to exactly 1
-    if (std::abs(cdf_[cdf_.size() - 1] - 1.) < 1.E-7) {
-      cdf_[cdf_.size() - 1] = 1.;
+    if (std::abs(cdf[cdf.size() - 1] - 1.) < 1.E-7) {
+      cdf[cdf.size() - 1] = 1.;
     } else {
       std::string mssg = "Last CDF entry is not 1, but " +
-                         std::to_string(cdf_[cdf_.size() - 1]) +
+                         std::to_string(cdf[cdf.size() - 1]) +
                          ". Index of KalbachTable in XSS block is " +
                          std::to_string(i) + ".";
       throw PNDLException(mssg);
     }
   }
 
-  for (const auto& p : pdf_) {
+  for (const auto& p : pdf) {
     if (p < 0.) {
       std::string mssg =
           "Negative value found in PDF. Index of PCTable in XSS block is " +
@@ -86,6 +86,9 @@ KalbachTable::KalbachTable(const ACE& ace, std::size_t i)
       throw PNDLException(mssg);
     }
   }
+
+  set_points(energy, pdf, cdf, R, A);
+  guide_ = GuideTable(cdf);
 }
 
 KalbachTable::KalbachTable(const std::vector<double>& energy,
@@ -93,7 +96,7 @@ KalbachTable::KalbachTable(const std::vector<double>& energy,
                            const std::vector<double>& cdf,
                            const std::vector<double>& R,
                            const std::vector<double>& A, Interpolation interp)
-    : energy_(energy), pdf_(pdf), cdf_(cdf), R_(R), A_(A), interp_(interp) {
+    : arena_(), points_(nullptr), size_(0), interp_(interp), guide_() {
   if ((interp_ != Interpolation::Histogram) &&
       (interp_ != Interpolation::LinLin)) {
     std::string mssg = "Invalid interpolation of " +
@@ -101,47 +104,88 @@ KalbachTable::KalbachTable(const std::vector<double>& energy,
     throw PNDLException(mssg);
   }
 
-  if ((energy_.size() != pdf_.size()) || (pdf_.size() != cdf_.size()) ||
-      (cdf_.size() != R_.size()) || (R_.size() != A_.size())) {
+  if ((energy.size() != pdf.size()) || (pdf.size() != cdf.size()) ||
+      (cdf.size() != R.size()) || (R.size() != A.size())) {
     std::string mssg =
         "The outgoing energy, PDF, CDF, R, and A grids must all be the same "
         "size.";
     throw PNDLException(mssg);
   }
 
-  if (!std::is_sorted(energy_.begin(), energy_.end())) {
+  if (!std::is_sorted(energy.begin(), energy.end())) {
     std::string mssg = "Energies are not sorted.";
     throw PNDLException(mssg);
   }
 
-  if (!std::is_sorted(cdf_.begin(), cdf_.end())) {
+  if (!std::is_sorted(cdf.begin(), cdf.end())) {
     std::string mssg = "CDF is not sorted.";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[0] != 0.) {
+  if (cdf[0] != 0.) {
     std::string mssg =
-        "First CDF entry is not 0, but " + std::to_string(cdf_[0]) + ".";
+        "First CDF entry is not 0, but " + std::to_string(cdf[0]) + ".";
     throw PNDLException(mssg);
   }
 
-  if (cdf_[cdf_.size() - 1] != 1.) {
+  std::vector<double> cdf_1 = cdf;
+  if (cdf_1[cdf_1.size() - 1] != 1.) {
     // If last element is close to 1, just set it to exactly 1
-    if (std::abs(cdf_[cdf_.size() - 1] - 1.) < 1.E-7) {
-      cdf_[cdf_.size() - 1] = 1.;
+    if (std::abs(cdf_1[cdf_1.size() - 1] - 1.) < 1.E-7) {
+      cdf_1[cdf_1.size() - 1] = 1.;
     } else {
       std::string mssg = "Last CDF entry is not 1, but " +
-                         std::to_string(cdf_[cdf_.size() - 1]) + ".";
+                         std::to_string(cdf_1[cdf_1.size() - 1]) + ".";
       throw PNDLException(mssg);
     }
   }
 
-  for (const auto& p : pdf_) {
+  for (const auto& p : pdf) {
     if (p < 0.) {
       std::string mssg = "Negative value found in PDF.";
       throw PNDLException(mssg);
     }
   }
+
+  set_points(energy, pdf, cdf_1, R, A);
+  guide_ = GuideTable(cdf_1);
+}
+
+void KalbachTable::set_points(const std::vector<double>& energy,
+                              const std::vector<double>& pdf,
+                              const std::vector<double>& cdf,
+                              const std::vector<double>& R,
+                              const std::vector<double>& A) {
+  auto points = std::make_shared<std::vector<Point>>();
+  points->reserve(energy.size());
+  for (std::size_t j = 0; j < energy.size(); j++) {
+    points->push_back({energy[j], pdf[j], cdf[j], R[j], A[j]});
+  }
+
+  points_ = points->data();
+  size_ = points->size();
+  arena_ = points;
+}
+
+void KalbachTable::pack(std::vector<KalbachTable>& tables) {
+  std::size_t NP = 0;
+  for (const auto& table : tables) NP += table.size_;
+
+  // The offset of each table is recorded while copying its points, as the
+  // pointers into the arena can only be set once it is complete.
+  auto arena = std::make_shared<std::vector<Point>>();
+  arena->reserve(NP);
+  std::vector<std::size_t> offsets;
+  offsets.reserve(tables.size());
+  for (const auto& table : tables) {
+    offsets.push_back(arena->size());
+    arena->insert(arena->end(), table.points_, table.points_ + table.size_);
+  }
+
+  for (std::size_t j = 0; j < tables.size(); j++) {
+    tables[j].points_ = arena->data() + offsets[j];
+    tables[j].arena_ = arena;
+  }
 }
 
 }  // namespace pndl
@@ -27,71 +27,23 @@
  */
 
 #include <PapillonNDL/legendre.hpp>
+#include <PapillonNDL/linearize.hpp>
 #include <PapillonNDL/pndl_exception.hpp>
 
+#include <cmath>
 #include <functional>
-#include <utility>
 
 #include "constants.hpp"
 
 namespace pndl {
 
-namespace detail {
-
-// This method for evaluating the Legendre polynomials is based on the
-// boost::math implementation. I start to recursively get orders after n >=5
-// however, instead of n >= 2.
-double legendre(unsigned n, double x) {
-  switch (n) {
-    case 0:
-      return 1.;
-      break;
-    case 1:
-      return x;
-      break;
-    case 2:
-      return 0.5 * (3. * x * x - 1.);
-      break;
-    case 3:
-      return 0.5 * (5. * x * x * x - 3. * x);
-      break;
-    case 4: {
-      const double x_2 = x * x;
-      return 0.125 * (35. * x_2 * x_2 - 30. * x_2 + 3.);
-      break;
-    }
-    default: {
-      // n >= 5, so start get getting p3 and p4
-      const double x_2 = x * x;
-      const double x_3 = x_2 * x;
-      const double x_4 = x_3 * x;
-      double p3 = 0.5 * (5. * x_3 - 3. * x);
-      double p4 = 0.125 * (35. * x_4 - 30. * x_2 + 3.);
-
-      // Iterate up to the desired Legendre order.
-      unsigned l = 4;
-      while (l < n) {
-        std::swap(p3, p4);
-        p4 = ((2. * l + 1.) * x * p3 - l * p4) / (l + 1.);
-        l++;
-      }
-      return p4;
-
-      break;
-    }
-  }
-}
-}  // namespace detail
+Legendre::Legendre()
+    : a_({0.5}),
+      distribution_({-1., 1.}, {0.5, 0.5}, {0., 1.}, Interpolation::LinLin) {}
 
-Legendre::Legendre() : a_({0.5}), pdf_max_(0.) {
-  this->find_max();
-
-  if (this->positive() == false) {
-    throw PNDLException("Legendre distribution is negative within [-1,1].");
-  }
-}
-
-Legendre::Legendre(const std::vector<double>& a) : a_(a), pdf_max_(0.) {
+Legendre::Legendre(const std::vector<double>& a)
+    : a_(a),
+      distribution_({-1., 1.}, {0.5, 0.5}, {0., 1.}, Interpolation::LinLin) {
   // Add the a_[0] = 1. moment.
   a_.insert(a_.begin(), 1.);
 
@@ -100,33 +52,30 @@ Legendre::Legendre(const std::vector<double>& a) : a_(a), pdf_max_(0.) {
     a_[l] *= (2. * static_cast<double>(l) + 1.) / 2.;
   }
 
-  this->find_max();
-
   if (this->positive() == false) {
     throw PNDLException("Legendre distribution is negative within [-1,1].");
   }
-}
-
-double Legendre::pdf(double mu) const {
-  double pdf = 0.;
-
-  for (unsigned l = 0; l < a_.size(); l++) {
-    pdf += a_[l] * detail::legendre(l, mu);
-  }
 
-  return pdf;
+  this->linearize_distribution();
 }
 
-double Legendre::sample_mu(const std::function<double()>& rng) const {
-  double mu = -2.;
-
-  while (true) {
-    mu = 2. * rng() - 1.;
-    double P_accept = pdf(mu) / pdf_max_;
-    if (rng() < P_accept) break;
+double Legendre::pdf(double mu) const {
+  // The series is summed with the Clenshaw recurrence, using the Legendre
+  // recurrence relation
+  //   P_{l+1}(mu) = ((2l + 1) mu P_l(mu) - l P_{l-1}(mu)) / (l + 1),
+  // so that the cost is linear in the number of moments.
+  double b1 = 0.;
+  double b2 = 0.;
+
+  for (std::size_t i = a_.size(); i > 0; i--) {
+    const double l = static_cast<double>(i - 1);
+    const double b0 = a_[i - 1] + ((2. * l + 1.) / (l + 1.)) * mu * b1 -
+                      ((l + 1.) / (l + 2.)) * b2;
+    b2 = b1;
+    b1 = b0;
   }
 
-  return mu;
+  return b1;
 }
 
 void Legendre::set_moment(std::size_t l, double a) {
@@ -141,29 +90,45 @@ void Legendre::set_moment(std::size_t l, double a) {
   // Set the moment
   a_[l] = a * (2. * static_cast<double>(l) + 1.) / 2.;
 
-  // Find new max
-  this->find_max();
-
   // Check positivity
   if (this->positive() == false) {
     throw PNDLException("Legendre distribution is negative within [-1,1].");
   }
+
+  // Construct the new CDF
+  this->linearize_distribution();
 }
 
-void Legendre::find_max() {
-  pdf_max_ = 0.;
-  double mu = -1.;
-  double pdf_mu = this->pdf(mu);
-  double pdf_max = pdf_mu;
+void Legendre::linearize_distribution() {
+  std::function<double(double)> f = [this](double mu) {
+    return this->pdf(mu);
+  };
 
-  constexpr double d_mu = 0.001;
-  for (std::size_t i = 0; i < 2000; i++) {
-    mu += d_mu;
-    pdf_mu = this->pdf(mu);
-    if (pdf_mu > pdf_max) pdf_max = pdf_mu;
-  }
+  try {
+    Tabulated1D tab_pdf = linearize(-1., 1., f);
+
+    std::vector<double> cosines = tab_pdf.x();
+    std::vector<double> pdf = tab_pdf.y();
+    std::vector<double> cdf(pdf.size(), 0.);
+
+    // Trapezoid rule
+    for (std::size_t i = 0; i < cosines.size() - 1; i++) {
+      cdf[i + 1] =
+          0.5 * (pdf[i] + pdf[i + 1]) * (cosines[i + 1] - cosines[i]) + cdf[i];
+    }
 
-  pdf_max_ = 1.001 * pdf_max;
+    const double norm = cdf.back();
+    for (std::size_t i = 0; i < cosines.size(); i++) {
+      pdf[i] /= norm;
+      cdf[i] /= norm;
+    }
+
+    distribution_ = PCTable(cosines, pdf, cdf, Interpolation::LinLin);
+  } catch (PNDLException& err) {
+    std::string mssg = "Could not linearize Legenre distribution.";
+    err.add_to_exception(mssg);
+    throw err;
+  }
 }
 
 bool Legendre::positive() const {
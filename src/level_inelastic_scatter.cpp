@@ -44,11 +44,6 @@ LevelInelasticScatter::LevelInelasticScatter(double Q, double AWR)
   C2_ = tmp * tmp;
 }
 
-double LevelInelasticScatter::sample_energy(
-    double E_in, const std::function<double()>&) const {
-  return C2_ * (E_in - C1_);
-}
-
 std::optional<double> LevelInelasticScatter::pdf(double /*E_in*/,
                                                  double /*E_out*/) const {
   return std::nullopt;
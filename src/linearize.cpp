@@ -26,54 +26,86 @@
 #include <PapillonNDL/pndl_exception.hpp>
 #include <algorithm>
 #include <cmath>
+#include <utility>
 #include <vector>
 
 namespace pndl {
 
-Tabulated1D linearize(const std::vector<double>& i_x,
-                      const std::vector<double>& i_y,
-                      std::function<double(double)> f, double tolerance) {
-  std::vector<double> x = i_x;
-  std::vector<double> y = i_y;
+namespace {
 
-  // Do checks on vectors
-  if (x.size() != y.size()) {
-    std::string mssg = "x and y must have the same length.";
-    throw PNDLException(mssg);
-  }
+// Refines the interval between the last point of x and y, and the point
+// (x_hi, y_hi), appending the new points and then (x_hi, y_hi). Intervals are
+// bisected depth-first, lower half first, so that the points and the order of
+// the calls to f are the same as when the mid-points are inserted in place.
+// The stack holds the upper end points of the intervals which remain to be
+// refined.
+void refine(std::vector<double>& x, std::vector<double>& y, double x_hi,
+            double y_hi, const std::function<double(double)>& f,
+            double tolerance, std::vector<std::pair<double, double>>& stack) {
+  stack.clear();
+  stack.emplace_back(x_hi, y_hi);
 
-  if (std::is_sorted(x.begin(), x.end()) == false) {
-    std::string mssg = "x must be sorted.";
-    throw PNDLException(mssg);
-  }
+  while (stack.empty() == false) {
+    const double x_low = x.back();
+    const double y_low = y.back();
+    const auto [x_up, y_up] = stack.back();
 
-  // Bisect intervals until we are linearly interpolable
-  std::size_t i = 0;
-  while (i < (x.size() - 1)) {
-    // Get mid-point x value. If x[i] == x[i+1], this is a discontinuity, so we
+    // Get mid-point x value. If x_low == x_up, this is a discontinuity, so we
     // continue.
-    if (std::nextafter(x[i], x[i + 1]) == x[i + 1]) {
-      i++;
+    if (std::nextafter(x_low, x_up) == x_up) {
+      x.push_back(x_up);
+      y.push_back(y_up);
+      stack.pop_back();
       continue;
     }
-    double x_mid = 0.5 * (x[i] + x[i + 1]);
+    double x_mid = 0.5 * (x_low + x_up);
 
     // Get interpolated and real function value
-    const double f_interp = 0.5 * (y[i] + y[i + 1]);
+    const double f_interp = 0.5 * (y_low + y_up);
     const double f_real = f(x_mid);
 
     // Check tolerance
     const double rel_diff = std::abs((f_interp - f_real) / f_real);
     if (rel_diff > tolerance) {
-      // Add the mid-point
-      auto xp = x.begin() + static_cast<std::ptrdiff_t>(i) + 1;
-      auto yp = y.begin() + static_cast<std::ptrdiff_t>(i) + 1;
-      x.insert(xp, x_mid);
-      y.insert(yp, f_real);
+      // Refine the lower half first
+      stack.emplace_back(x_mid, f_real);
     } else {
-      i++;
+      x.push_back(x_up);
+      y.push_back(y_up);
+      stack.pop_back();
     }
   }
+}
+
+}  // namespace
+
+Tabulated1D linearize(const std::vector<double>& i_x,
+                      const std::vector<double>& i_y,
+                      std::function<double(double)> f, double tolerance) {
+  // Do checks on vectors
+  if (i_x.size() != i_y.size()) {
+    std::string mssg = "x and y must have the same length.";
+    throw PNDLException(mssg);
+  }
+
+  if (std::is_sorted(i_x.begin(), i_x.end()) == false) {
+    std::string mssg = "x must be sorted.";
+    throw PNDLException(mssg);
+  }
+
+  std::vector<double> x, y;
+  x.reserve(2 * i_x.size());
+  y.reserve(2 * i_y.size());
+  if (i_x.empty() == false) {
+    x.push_back(i_x.front());
+    y.push_back(i_y.front());
+  }
+
+  // Bisect each of the initial intervals until it is linearly interpolable
+  std::vector<std::pair<double, double>> stack;
+  for (std::size_t i = 1; i < i_x.size(); i++) {
+    refine(x, y, i_x[i], i_y[i], f, tolerance, stack);
+  }
 
   x.shrink_to_fit();
   y.shrink_to_fit();
@@ -0,0 +1,48 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/log_hash_table.hpp>
+
+namespace pndl {
+
+LogHashTable::LogHashTable(const std::vector<double>& grid)
+    : hash_(), u_min_(0.), du_(0.) {
+  if (grid.empty() || grid.front() <= 0.) return;
+
+  const std::size_t NBINS = grid.size();
+  u_min_ = std::log(grid.front());
+  du_ = (std::log(grid.back()) - u_min_) / static_cast<double>(NBINS);
+  if (du_ <= 0.) return;
+
+  // The lower bounds of the bins are increasing, so the index of the first
+  // point which is not less than each bound is found in a single pass.
+  hash_.reserve(NBINS + 1);
+  std::size_t i = 0;
+  for (std::size_t b = 0; b < NBINS; b++) {
+    const double bound = std::exp(u_min_ + static_cast<double>(b) * du_);
+    while (i < grid.size() && grid[i] < bound) i++;
+    hash_.push_back(static_cast<uint32_t>(i));
+  }
+  hash_.push_back(static_cast<uint32_t>(grid.size()));
+}
+
+}  // namespace pndl
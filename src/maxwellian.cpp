@@ -25,11 +25,15 @@
 #include <cmath>
 
 #include "constants.hpp"
+#include "spectrum_table.hpp"
 
 namespace pndl {
 
 Maxwellian::Maxwellian(const ACE& ace, std::size_t i)
-    : temperature_(), restriction_energy_() {
+    : temperature_(),
+      compiled_temperature_(),
+      restriction_energy_(),
+      tabulated_(false) {
   uint32_t NR = ace.xss<uint32_t>(i);
   uint32_t NE = ace.xss<uint32_t>(i + 1 + 2 * NR);
   std::vector<uint32_t> NBT;
@@ -53,6 +57,8 @@ Maxwellian::Maxwellian(const ACE& ace, std::size_t i)
   // Create Function1D pointer
   try {
     temperature_ = std::make_unique<Tabulated1D>(NBT, INT, energy, temperature);
+    compiled_temperature_ =
+        std::make_shared<CompiledTabulated1D>(*temperature_);
   } catch (PNDLException& error) {
     std::string mssg =
         "Could not construct Tabulated1D for the effective nuclear "
@@ -66,11 +72,27 @@ Maxwellian::Maxwellian(const ACE& ace, std::size_t i)
 
 Maxwellian::Maxwellian(std::shared_ptr<Tabulated1D> temperature,
                        double restriction_energy)
-    : temperature_(temperature), restriction_energy_(restriction_energy) {}
+    : temperature_(temperature),
+      compiled_temperature_(
+          std::make_shared<CompiledTabulated1D>(*temperature_)),
+      restriction_energy_(restriction_energy),
+      tabulated_(false) {}
+
+void Maxwellian::set_tabulated(bool tabulated) {
+  // The table is built here, instead of at the first sample
+  if (tabulated) detail::maxwellian_spectrum_table();
+  tabulated_ = tabulated;
+}
+
+template <class RNG>
+double Maxwellian::sample_energy_impl(double E_in, RNG& rng) const {
+  double T = (*compiled_temperature_)(E_in);
+
+  if (tabulated_) {
+    const double x_max = (E_in - restriction_energy_) / T;
+    return T * detail::maxwellian_spectrum_table().sample(rng, x_max);
+  }
 
-double Maxwellian::sample_energy(double E_in,
-                                 const std::function<double()>& rng) const {
-  double T = (*temperature_)(E_in);
   double xi1 = 0.;
   double xi2 = 0.;
   double xi3 = 0.;
@@ -92,11 +114,20 @@ double Maxwellian::sample_energy(double E_in,
   return E_out;
 }
 
+double Maxwellian::sample_energy(double E_in,
+                                 const std::function<double()>& rng) const {
+  return this->sample_energy_impl(E_in, rng);
+}
+
+double Maxwellian::sample_energy(double E_in, RNGStream& rng) const {
+  return this->sample_energy_impl(E_in, rng);
+}
+
 std::optional<double> Maxwellian::pdf(double E_in, double E_out) const {
   double du = E_in - restriction_energy_;
   if (E_out < 0. || E_out > du) return 0.;
 
-  double T = (*temperature_)(E_in);
+  double T = (*compiled_temperature_)(E_in);
   double I = std::pow(T, 3. / 2.) * ((std::sqrt(PI) / 2.) * std::erf(du / T) -
                                      std::sqrt(du / T) * std::exp(-du / T));
   return (std::sqrt(E_out) / I) * std::exp(-E_out / T);
@@ -0,0 +1,97 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_MEMORY_H
+#define PAPILLON_NDL_MEMORY_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace pndl {
+namespace detail {
+
+// Returns the global new/delete resource, as a shared pointer which does not
+// own the resource. This is used when no memory resource is provided.
+inline std::shared_ptr<std::pmr::memory_resource> new_delete_memory() {
+  return std::shared_ptr<std::pmr::memory_resource>(
+      std::shared_ptr<void>(), std::pmr::new_delete_resource());
+}
+
+// Returns memory if it is not null, and the global new/delete resource
+// otherwise.
+inline std::shared_ptr<std::pmr::memory_resource> memory_or_default(
+    std::shared_ptr<std::pmr::memory_resource> memory) {
+  if (memory) return memory;
+  return new_delete_memory();
+}
+
+// Allocator which keeps a shared pointer to its memory resource. When used
+// with std::allocate_shared, the copy of the allocator in the control block
+// keeps the resource alive for as long as the object exists, even if the
+// object outlives the owner of the resource.
+template <class T>
+class MemoryAllocator {
+ public:
+  using value_type = T;
+
+  MemoryAllocator(std::shared_ptr<std::pmr::memory_resource> memory)
+      : memory_(std::move(memory)) {}
+
+  template <class U>
+  MemoryAllocator(const MemoryAllocator<U>& other) : memory_(other.memory()) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(memory_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    memory_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  const std::shared_ptr<std::pmr::memory_resource>& memory() const {
+    return memory_;
+  }
+
+  template <class U>
+  bool operator==(const MemoryAllocator<U>& other) const {
+    return memory_ == other.memory();
+  }
+
+ private:
+  std::shared_ptr<std::pmr::memory_resource> memory_;
+};
+
+// Constructs an object of type T, with the object and its control block
+// allocated from memory.
+template <class T, class... Args>
+std::shared_ptr<T> make_shared(
+    const std::shared_ptr<std::pmr::memory_resource>& memory, Args&&... args) {
+  return std::allocate_shared<T>(MemoryAllocator<T>(memory_or_default(memory)),
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace detail
+}  // namespace pndl
+
+#endif  // PAPILLON_NDL_MEMORY_H
@@ -0,0 +1,113 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/memory_arena.hpp>
+#include <memory>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace pndl {
+
+MemoryArena::MemoryArena(std::size_t initial_size, bool huge_pages)
+    : blocks_(),
+      current_(nullptr),
+      remaining_(0),
+      next_block_size_(initial_size),
+      footprint_(0),
+      bytes_allocated_(0),
+      huge_pages_(huge_pages) {
+#if !defined(__linux__)
+  huge_pages_ = false;
+#endif
+
+  if (next_block_size_ == 0) next_block_size_ = 65536;
+}
+
+MemoryArena::~MemoryArena() {
+  for (const auto& block : blocks_) {
+#if defined(__linux__)
+    if (huge_pages_) {
+      munmap(block.data, block.size);
+      continue;
+    }
+#endif
+    ::operator delete(block.data);
+  }
+}
+
+bool MemoryArena::contains(const void* p) const {
+  const std::byte* b = static_cast<const std::byte*>(p);
+  for (const auto& block : blocks_) {
+    if (b >= block.data && b < block.data + block.size) return true;
+  }
+  return false;
+}
+
+void MemoryArena::add_block(std::size_t min_size) {
+  std::size_t size = next_block_size_ > min_size ? next_block_size_ : min_size;
+  std::byte* data = nullptr;
+
+#if defined(__linux__)
+  if (huge_pages_) {
+    // Round the block up to a whole number of huge pages, and advise the
+    // kernel to back it with transparent huge pages.
+    size = ((size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) throw std::bad_alloc();
+    madvise(ptr, size, MADV_HUGEPAGE);
+    data = static_cast<std::byte*>(ptr);
+  }
+#endif
+
+  if (data == nullptr) data = static_cast<std::byte*>(::operator new(size));
+
+  blocks_.push_back({data, size});
+  current_ = data;
+  remaining_ = size;
+  footprint_ += size;
+  next_block_size_ = 2 * size;
+}
+
+void* MemoryArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes == 0) bytes = 1;
+
+  void* p = current_;
+  std::size_t space = remaining_;
+  if (p == nullptr || std::align(alignment, bytes, p, space) == nullptr) {
+    add_block(bytes + alignment);
+    p = current_;
+    space = remaining_;
+    std::align(alignment, bytes, p, space);
+  }
+
+  // Padding required for the alignment is counted as allocated
+  bytes_allocated_ += remaining_ - space + bytes;
+  current_ = static_cast<std::byte*>(p) + bytes;
+  remaining_ = space - bytes;
+  return p;
+}
+
+}  // namespace pndl
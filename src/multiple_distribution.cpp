@@ -22,6 +22,7 @@
  * */
 #include <PapillonNDL/multiple_distribution.hpp>
 #include <PapillonNDL/pndl_exception.hpp>
+#include <limits>
 #include <optional>
 
 namespace pndl {
@@ -29,7 +30,11 @@ namespace pndl {
 MultipleDistribution::MultipleDistribution(
     const std::vector<std::shared_ptr<AngleEnergy>>& distributions,
     const std::vector<std::shared_ptr<Tabulated1D>>& probabilities)
-    : distributions_(distributions), probabilities_(probabilities) {
+    : distributions_(distributions),
+      probabilities_(probabilities),
+      compiled_probabilities_(),
+      cdf_energy_(),
+      cdf_() {
   if (distributions_.size() != probabilities_.size()) {
     std::string mssg =
         "Different number of distributions and probabilities provided.";
@@ -52,22 +57,87 @@ MultipleDistribution::MultipleDistribution(
       throw PNDLException(mssg);
     }
   }
+
+  compiled_probabilities_.reserve(probabilities_.size());
+  for (const auto& prob : probabilities_)
+    compiled_probabilities_.emplace_back(*prob);
+
+  build_cdf_table();
 }
 
-AngleEnergyPacket MultipleDistribution::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
-  // First select distribution
-  double xi = rng();
-  double sum = 0.;
-  for (std::size_t d = 0; d < distributions_.size(); d++) {
-    sum += (*probabilities_[d])(E_in);
-    if (xi < sum) {
-      return distributions_[d]->sample_angle_energy(E_in, rng);
+void MultipleDistribution::build_cdf_table() {
+  // The table is only exact if every probability is linear between the
+  // points of the union grid.
+  for (const auto& prob : probabilities_) {
+    for (const auto& interp : prob->interpolation()) {
+      if (interp != Interpolation::Histogram &&
+          interp != Interpolation::LinLin) {
+        return;
+      }
     }
   }
 
-  // Shouldn't get here, but if we do, use the last distribution
-  return distributions_.back()->sample_angle_energy(E_in, rng);
+  for (const auto& prob : probabilities_) {
+    cdf_energy_.insert(cdf_energy_.end(), prob->x().begin(), prob->x().end());
+  }
+  std::sort(cdf_energy_.begin(), cdf_energy_.end());
+  cdf_energy_.erase(std::unique(cdf_energy_.begin(), cdf_energy_.end()),
+                    cdf_energy_.end());
+
+  const std::size_t N = distributions_.size() - 1;
+  const std::size_t NR = cdf_energy_.size() + 1;
+  cdf_.assign(2 * N * NR, 0.);
+
+  for (std::size_t r = 0; r < NR; r++) {
+    double* row = cdf_.data() + 2 * N * r;
+    double value = 0.;
+    double slope = 0.;
+    for (std::size_t d = 0; d < N; d++) {
+      const Tabulated1D& prob = *probabilities_[d];
+      if (r == 0) {
+        value += prob(std::numeric_limits<double>::lowest());
+      } else if (r == NR - 1) {
+        value += prob(std::numeric_limits<double>::max());
+      } else {
+        // Probabilities are evaluated inside of the interval, so that
+        // discontinuities at the bounds do not matter.
+        const double E_low = cdf_energy_[r - 1];
+        const double dE = cdf_energy_[r] - E_low;
+        const double p1 = prob(E_low + 0.25 * dE);
+        const double p2 = prob(E_low + 0.75 * dE);
+        const double b = (p2 - p1) / (0.5 * dE);
+        value += p1 - 0.25 * dE * b;
+        slope += b;
+      }
+      row[2 * d] = value;
+      row[2 * d + 1] = slope;
+    }
+  }
+}
+
+template <class RNG>
+AngleEnergyPacket MultipleDistribution::sample_angle_energy_impl(
+    double E_in, RNG& rng) const {
+  // First select distribution
+  const std::size_t d = this->select_distribution(E_in, rng());
+  return distributions_[d]->sample_angle_energy(E_in, rng);
+}
+
+AngleEnergyPacket MultipleDistribution::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket MultipleDistribution::sample_angle_energy(
+    double E_in, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket MultipleDistribution::sample_angle_energy(
+    double E_in, const EnergyGrid& grid, std::size_t i, RNGStream& rng) const {
+  // First select distribution
+  const std::size_t d = this->select_distribution(E_in, rng());
+  return distributions_[d]->sample_angle_energy(E_in, grid, i, rng);
 }
 
 std::optional<double> MultipleDistribution::angle_pdf(double E_in,
@@ -80,7 +150,7 @@ std::optional<double> MultipleDistribution::angle_pdf(double E_in,
       return std::nullopt;
     }
 
-    a_pdf += (*probabilities_[d])(E_in)*E_in_pdf.value();
+    a_pdf += compiled_probabilities_[d](E_in) * E_in_pdf.value();
   }
 
   return a_pdf;
@@ -96,7 +166,7 @@ std::optional<double> MultipleDistribution::pdf(double E_in, double mu,
       return std::nullopt;
     }
 
-    j_pdf += (*probabilities_[d])(E_in)*E_in_pdf.value();
+    j_pdf += compiled_probabilities_[d](E_in) * E_in_pdf.value();
   }
 
   return j_pdf;
@@ -25,11 +25,12 @@
 #include <cmath>
 
 #include "constants.hpp"
+#include "spectrum_table.hpp"
 
 namespace pndl {
 
 NBody::NBody(const ACE& ace, std::size_t i, double iQ)
-    : n_(), Ap_(), A_(), Q_(iQ) {
+    : n_(), Ap_(), A_(), Q_(iQ), tabulated_(false) {
   n_ = ace.xss<uint32_t>(i);
   Ap_ = ace.xss(i + 1);
   A_ = ace.awr();
@@ -58,7 +59,7 @@ NBody::NBody(const ACE& ace, std::size_t i, double iQ)
 }
 
 NBody::NBody(uint16_t n, double Ap, double AWR, double Q)
-    : n_(n), Ap_(Ap), A_(AWR), Q_(Q) {
+    : n_(n), Ap_(Ap), A_(AWR), Q_(Q), tabulated_(false) {
   if ((n_ != 3) && (n_ != 4) && (n_ != 5)) {
     std::string mssg =
         "n may only be 3, 4, or 5. Was given n = " + std::to_string(n_) + ".";
@@ -77,8 +78,8 @@ NBody::NBody(uint16_t n, double Ap, double AWR, double Q)
   }
 }
 
-AngleEnergyPacket NBody::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket NBody::sample_angle_energy_impl(double E_in, RNG& rng) const {
   const double Emax = ((Ap_ - 1.) / Ap_) * ((A_ / (A_ + 1.)) * E_in + Q_);
   const double x = maxwellian_spectrum(rng);
   double y = 0.;
@@ -104,7 +105,25 @@ AngleEnergyPacket NBody::sample_angle_energy(
   return {mu, E_out};
 }
 
-double NBody::maxwellian_spectrum(const std::function<double()>& rng) const {
+AngleEnergyPacket NBody::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket NBody::sample_angle_energy(double E_in,
+                                             RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+void NBody::set_tabulated(bool tabulated) {
+  if (tabulated) detail::maxwellian_spectrum_table();
+  tabulated_ = tabulated;
+}
+
+template <class RNG>
+double NBody::maxwellian_spectrum(RNG& rng) const {
+  if (tabulated_) return detail::maxwellian_spectrum_table().sample(rng);
+
   const double a = PI * rng() / 2.;
   return -(std::log(rng()) + std::log(rng()) * std::cos(a) * std::cos(a));
 }
@@ -28,7 +28,7 @@
 namespace pndl {
 
 PCTable::PCTable(const ACE& ace, std::size_t i, double normalization)
-    : values_(), pdf_(), cdf_(), interp_() {
+    : values_(), pdf_(), cdf_(), interp_(), guide_() {
   interp_ = ace.xss<Interpolation>(i);
   if ((interp_ != Interpolation::Histogram) &&
       (interp_ != Interpolation::LinLin)) {
@@ -86,12 +86,14 @@ PCTable::PCTable(const ACE& ace, std::size_t i, double normalization)
       throw PNDLException(mssg);
     }
   }
+
+  guide_ = GuideTable(cdf_);
 }
 
 PCTable::PCTable(const std::vector<double>& values,
                  const std::vector<double>& pdf, const std::vector<double>& cdf,
                  Interpolation interp)
-    : values_(values), pdf_(pdf), cdf_(cdf), interp_(interp) {
+    : values_(values), pdf_(pdf), cdf_(cdf), interp_(interp), guide_() {
   if ((interp_ != Interpolation::Histogram) &&
       (interp_ != Interpolation::LinLin)) {
     std::string mssg = "Invalid interpolation of " +
@@ -136,6 +138,8 @@ PCTable::PCTable(const std::vector<double>& values,
       throw PNDLException(mssg);
     }
   }
+
+  guide_ = GuideTable(cdf_);
 }
 
 }  // namespace pndl
@@ -37,7 +37,9 @@ void init_AngleDistribution(py::module& m) {
       .def(py::init<const ACE&, int>())
       .def(py::init<const std::vector<double>&,
                     const std::vector<std::shared_ptr<AngleLaw>>&>())
-      .def("sample_angle", &AngleDistribution::sample_angle)
+      .def("sample_angle",
+           py::overload_cast<double, const std::function<double()>&>(
+               &AngleDistribution::sample_angle, py::const_))
       .def("pdf", &AngleDistribution::pdf)
       .def("size", &AngleDistribution::size)
       .def("energy",
@@ -35,6 +35,7 @@
 #include <PapillonNDL/elastic.hpp>
 #include <PapillonNDL/elastic_dbrc.hpp>
 #include <PapillonNDL/elastic_doppler_broadener.hpp>
+#include <PapillonNDL/elastic_rvs.hpp>
 #include <PapillonNDL/elastic_svt.hpp>
 #include <PapillonNDL/energy_angle_table.hpp>
 #include <PapillonNDL/kalbach.hpp>
@@ -46,11 +47,18 @@
 #include <PapillonNDL/uncorrelated.hpp>
 #include <array>
 #include <optional>
+#include <vector>
 
 namespace py = pybind11;
 
 using namespace pndl;
 
+// Columns of the interleaved tables are returned to Python as copies
+template <class Column>
+std::vector<double> column_vector(const Column& column) {
+  return std::vector<double>(column.begin(), column.end());
+}
+
 void init_AngleEnergyPacket(py::module& m) {
   py::class_<AngleEnergyPacket>(m, "AngleEnergyPacket")
       .def_readwrite("cosine_angle", &AngleEnergyPacket::cosine_angle)
@@ -102,7 +110,9 @@ void init_AngleEnergy(py::module& m) {
   py::class_<AngleEnergy, PyAngleEnergy, std::shared_ptr<AngleEnergy>>(
       m, "AngleEnergy")
       .def(py::init<>())
-      .def("sample_angle_energy", &AngleEnergy::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &AngleEnergy::sample_angle_energy, py::const_))
       .def("angle_pdf", &AngleEnergy::angle_pdf)
       .def("pdf", &AngleEnergy::pdf);
 }
@@ -111,7 +121,9 @@ void init_Uncorrelated(py::module& m) {
   py::class_<Uncorrelated, AngleEnergy, std::shared_ptr<Uncorrelated>>(
       m, "Uncorrelated")
       .def(py::init<const AngleDistribution&, std::shared_ptr<EnergyLaw>>())
-      .def("sample_angle_energy", &Uncorrelated::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Uncorrelated::sample_angle_energy, py::const_))
       .def("angle", &Uncorrelated::angle)
       .def("energy", &Uncorrelated::energy,
            py::return_value_policy::reference_internal)
@@ -122,11 +134,15 @@ void init_Uncorrelated(py::module& m) {
 void init_NBody(py::module& m) {
   py::class_<NBody, AngleEnergy, std::shared_ptr<NBody>>(m, "NBody")
       .def(py::init<uint32_t, double, double, double>())
-      .def("sample_angle_energy", &NBody::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &NBody::sample_angle_energy, py::const_))
       .def("n", &NBody::n)
       .def("Ap", &NBody::Ap)
       .def("A", &NBody::A)
       .def("Q", &NBody::Q)
+      .def("set_tabulated", &NBody::set_tabulated)
+      .def("tabulated", &NBody::tabulated)
       .def("angle_pdf", &NBody::angle_pdf)
       .def("pdf", &NBody::pdf);
 }
@@ -140,16 +156,19 @@ void init_KalbachTable(py::module& m) {
       .def("sample_energy", &KalbachTable::sample_energy)
       .def("min_energy", &KalbachTable::min_energy)
       .def("max_energy", &KalbachTable::max_energy)
-      .def("energy", &KalbachTable::energy)
-      .def("pdf", py::overload_cast<>(&KalbachTable::pdf, py::const_))
+      .def("energy",
+           [](const KalbachTable& t) { return column_vector(t.energy()); })
+      .def("pdf",
+           [](const KalbachTable& t) { return column_vector(t.pdf()); })
       .def("pdf",
            py::overload_cast<double, double>(&KalbachTable::pdf, py::const_))
       .def("angle_pdf", &KalbachTable::angle_pdf)
-      .def("cdf", &KalbachTable::cdf)
+      .def("cdf",
+           [](const KalbachTable& t) { return column_vector(t.cdf()); })
       .def("R", py::overload_cast<double>(&KalbachTable::R, py::const_))
-      .def("R", py::overload_cast<>(&KalbachTable::R, py::const_))
+      .def("R", [](const KalbachTable& t) { return column_vector(t.R()); })
       .def("A", py::overload_cast<double>(&KalbachTable::A, py::const_))
-      .def("A", py::overload_cast<>(&KalbachTable::A, py::const_))
+      .def("A", [](const KalbachTable& t) { return column_vector(t.A()); })
       .def("interpolation", &KalbachTable::interpolation);
 }
 
@@ -157,7 +176,9 @@ void init_Kalbach(py::module& m) {
   py::class_<Kalbach, AngleEnergy, std::shared_ptr<Kalbach>>(m, "Kalbach")
       .def(py::init<const std::vector<double>&,
                     const std::vector<KalbachTable>&>())
-      .def("sample_angle_energy", &Kalbach::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Kalbach::sample_angle_energy, py::const_))
       .def("incoming_energy",
            py::overload_cast<>(&Kalbach::incoming_energy, py::const_))
       .def("incoming_energy",
@@ -175,16 +196,21 @@ void init_EnergyAngleTable(py::module& m) {
                     const std::vector<double>&, const std::vector<PCTable>&,
                     Interpolation>())
       .def(py::init<const PCTable&, const std::vector<PCTable>&>())
-      .def("sample_angle_energy", &EnergyAngleTable::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<const std::function<double()>&>(
+               &EnergyAngleTable::sample_angle_energy, py::const_))
       .def("min_energy", &EnergyAngleTable::min_energy)
       .def("max_energy", &EnergyAngleTable::max_energy)
       .def("interpolation", &EnergyAngleTable::interpolation)
-      .def("energy", &EnergyAngleTable::energy)
-      .def("pdf", py::overload_cast<>(&EnergyAngleTable::pdf, py::const_))
+      .def("energy",
+           [](const EnergyAngleTable& t) { return column_vector(t.energy()); })
+      .def("pdf",
+           [](const EnergyAngleTable& t) { return column_vector(t.pdf()); })
       .def("pdf", py::overload_cast<double, double>(&EnergyAngleTable::pdf,
                                                     py::const_))
       .def("angle_pdf", &EnergyAngleTable::angle_pdf)
-      .def("cdf", &EnergyAngleTable::cdf)
+      .def("cdf",
+           [](const EnergyAngleTable& t) { return column_vector(t.cdf()); })
       .def("size", &EnergyAngleTable::size)
       .def("angle_table", &EnergyAngleTable::angle_table);
 }
@@ -194,7 +220,9 @@ void init_TabularEnergyAngle(py::module& m) {
              std::shared_ptr<TabularEnergyAngle>>(m, "TabularEnergyAngle")
       .def(py::init<const std::vector<double>&,
                     const std::vector<EnergyAngleTable>&>())
-      .def("sample_angle_energy", &TabularEnergyAngle::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &TabularEnergyAngle::sample_angle_energy, py::const_))
       .def(
           "incoming_energy",
           py::overload_cast<>(&TabularEnergyAngle::incoming_energy, py::const_))
@@ -209,18 +237,30 @@ void init_TabularEnergyAngle(py::module& m) {
 
 void init_DiscreteCosinesEnergies(py::module& m) {
   py::class_<DiscreteCosinesEnergies::DiscreteEnergy>(m, "DiscreteEnergy")
-      .def_readwrite("energy", &DiscreteCosinesEnergies::DiscreteEnergy::energy)
-      .def_readwrite("cosines",
-                     &DiscreteCosinesEnergies::DiscreteEnergy::cosines);
+      .def_readonly("energy", &DiscreteCosinesEnergies::DiscreteEnergy::energy)
+      .def_property_readonly(
+          "cosines", [](const DiscreteCosinesEnergies::DiscreteEnergy& d) {
+            return std::vector<double>(d.cosines.begin(), d.cosines.end());
+          });
 
   py::class_<DiscreteCosinesEnergies, AngleEnergy,
              std::shared_ptr<DiscreteCosinesEnergies>>(
       m, "DiscreteCosinesEnergies")
       .def(py::init<const ACE&>())
-      .def("sample_angle_energy", &DiscreteCosinesEnergies::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &DiscreteCosinesEnergies::sample_angle_energy, py::const_))
       .def("skewed", &DiscreteCosinesEnergies::skewed)
       .def("incoming_energy", &DiscreteCosinesEnergies::incoming_energy)
-      .def("outgoing_energies", &DiscreteCosinesEnergies::outgoing_energies)
+      .def("num_outgoing_energies",
+           &DiscreteCosinesEnergies::num_outgoing_energies)
+      .def("outgoing_energies",
+           [](const DiscreteCosinesEnergies& d, std::size_t i) {
+             auto E = d.outgoing_energies(i);
+             return std::vector<double>(E.begin(), E.end());
+           })
+      .def("outgoing_energy", &DiscreteCosinesEnergies::outgoing_energy,
+           py::keep_alive<0, 1>())
       .def("angle_pdf", &DiscreteCosinesEnergies::angle_pdf)
       .def("pdf", &DiscreteCosinesEnergies::pdf);
 }
@@ -231,8 +271,11 @@ void init_ContinuousEnergyDiscreteCosines(py::module& m) {
                      &ContinuousEnergyDiscreteCosines::CEDCTable::energy)
       .def_readwrite("pdf", &ContinuousEnergyDiscreteCosines::CEDCTable::pdf)
       .def_readwrite("cdf", &ContinuousEnergyDiscreteCosines::CEDCTable::cdf)
-      .def_readwrite("cosines",
-                     &ContinuousEnergyDiscreteCosines::CEDCTable::cosines)
+      .def_property_readonly(
+          "cosines",
+          [](const ContinuousEnergyDiscreteCosines::CEDCTable& t) {
+            return t.cosines.rows();
+          })
       .def("sample_energy",
            &ContinuousEnergyDiscreteCosines::CEDCTable::sample_energy);
 
@@ -241,7 +284,8 @@ void init_ContinuousEnergyDiscreteCosines(py::module& m) {
       m, "ContinuousEnergyDiscreteCosines")
       .def(py::init<const ACE&, bool>())
       .def("sample_angle_energy",
-           &ContinuousEnergyDiscreteCosines::sample_angle_energy)
+           py::overload_cast<double, const std::function<double()>&>(
+               &ContinuousEnergyDiscreteCosines::sample_angle_energy, py::const_))
       .def("incoming_energy", &ContinuousEnergyDiscreteCosines::incoming_energy)
       .def("size", &ContinuousEnergyDiscreteCosines::size)
       .def("tables", &ContinuousEnergyDiscreteCosines::tables)
@@ -257,12 +301,15 @@ void init_MultipleDistribution(py::module& m) {
              std::shared_ptr<MultipleDistribution>>(m, "MultipleDistribution")
       .def(py::init<const std::vector<std::shared_ptr<AngleEnergy>>&,
                     const std::vector<std::shared_ptr<Tabulated1D>>&>())
-      .def("sample_angle_energy", &MultipleDistribution::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &MultipleDistribution::sample_angle_energy, py::const_))
       .def("size", &MultipleDistribution::size)
       .def("distribution", &MultipleDistribution::distribution,
            py::return_value_policy::reference_internal)
       .def("probability", &MultipleDistribution::probability,
            py::return_value_policy::reference_internal)
+      .def("select_distribution", &MultipleDistribution::select_distribution)
       .def("angle_pdf", &MultipleDistribution::angle_pdf)
       .def("pdf", &MultipleDistribution::pdf);
 }
@@ -272,29 +319,38 @@ void init_SummedFissionSpectrum(py::module& m) {
              std::shared_ptr<SummedFissionSpectrum>>(m, "SummedFissionSpectrum")
       .def(py::init<std::shared_ptr<STReaction>, std::shared_ptr<STReaction>,
                     std::shared_ptr<STReaction>, std::shared_ptr<STReaction>>())
-      .def("sample_angle_energy", &SummedFissionSpectrum::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &SummedFissionSpectrum::sample_angle_energy, py::const_))
       .def("angle_pdf", &SummedFissionSpectrum::angle_pdf)
-      .def("pdf", &SummedFissionSpectrum::pdf);
+      .def("pdf", &SummedFissionSpectrum::pdf)
+      .def("select_reaction", &SummedFissionSpectrum::select_reaction);
 }
 
 void init_CMDistribution(py::module& m) {
   py::class_<CMDistribution, AngleEnergy, std::shared_ptr<CMDistribution>>(
       m, "CMDistribution")
       .def(py::init<double, double, std::shared_ptr<AngleEnergy>>())
-      .def("sample_angle_energy", &CMDistribution::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &CMDistribution::sample_angle_energy, py::const_))
       .def("angle_pdf", &CMDistribution::angle_pdf)
       .def("pdf", &CMDistribution::pdf)
       .def("distribution", &CMDistribution::distribution,
            py::return_value_policy::reference_internal)
       .def("awr", &CMDistribution::awr)
-      .def("q", &CMDistribution::q);
+      .def("q", &CMDistribution::q)
+      .def("kinematics", &CMDistribution::kinematics,
+           py::return_value_policy::reference_internal);
 }
 
 void init_Absorption(py::module& m) {
   py::class_<Absorption, AngleEnergy, std::shared_ptr<Absorption>>(m,
                                                                    "Absorption")
       .def(py::init<uint32_t>())
-      .def("sample_angle_energy", &Absorption::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Absorption::sample_angle_energy, py::const_))
       .def("angle_pdf", &Absorption::angle_pdf)
       .def("pdf", &Absorption::pdf);
 }
@@ -305,21 +361,49 @@ void init_Elastic(py::module& m) {
       m, "ElasticDopplerBroadener")
       .def(py::init<>())
       .def("sample_target_velocity",
-           &ElasticDopplerBroadener::sample_target_velocity)
+           py::overload_cast<const double&, const double&, const double&,
+                             const std::function<double()>&>(
+               &ElasticDopplerBroadener::sample_target_velocity, py::const_))
+      .def("sample_target_velocities",
+           [](const ElasticDopplerBroadener& broadener,
+              const std::vector<double>& Ein, double kT, double awr,
+              const std::function<double()>& rng) {
+             std::vector<std::array<double, 3>> vt(Ein.size());
+             broadener.sample_target_velocities(Ein, kT, awr, rng, vt);
+             return vt;
+           })
       .def("algorithm", &ElasticDopplerBroadener::algorithm);
 
   py::class_<ElasticSVT, ElasticDopplerBroadener, std::shared_ptr<ElasticSVT>>(
       m, "ElasticSVT")
       .def(py::init<>())
-      .def("sample_target_velocity", &ElasticSVT::sample_target_velocity)
+      .def("sample_target_velocity",
+           py::overload_cast<const double&, const double&, const double&,
+                             const std::function<double()>&>(
+               &ElasticSVT::sample_target_velocity, py::const_))
       .def("algorithm", &ElasticSVT::algorithm);
 
   py::class_<ElasticDBRC, ElasticDopplerBroadener,
              std::shared_ptr<ElasticDBRC>>(m, "ElasticDBRC")
       .def(py::init<const CrossSection&>())
-      .def("sample_target_velocity", &ElasticDBRC::sample_target_velocity)
+      .def("sample_target_velocity",
+           py::overload_cast<const double&, const double&, const double&,
+                             const std::function<double()>&>(
+               &ElasticDBRC::sample_target_velocity, py::const_))
       .def("algorithm", &ElasticDBRC::algorithm)
-      .def("elastic_0K_xs", &ElasticDBRC::elastic_0K_xs);
+      .def("elastic_0K_xs", &ElasticDBRC::elastic_0K_xs)
+      .def("max_xs_value", &ElasticDBRC::max_xs_value);
+
+  py::class_<ElasticRVS, ElasticDopplerBroadener, std::shared_ptr<ElasticRVS>>(
+      m, "ElasticRVS")
+      .def(py::init<const CrossSection&>())
+      .def("sample_target_velocity",
+           py::overload_cast<const double&, const double&, const double&,
+                             const std::function<double()>&>(
+               &ElasticRVS::sample_target_velocity, py::const_))
+      .def("algorithm", &ElasticRVS::algorithm)
+      .def("elastic_0K_xs", &ElasticRVS::elastic_0K_xs)
+      .def("cdf", &ElasticRVS::cdf);
 
   py::class_<Elastic, AngleEnergy, std::shared_ptr<Elastic>>(m, "Elastic")
       .def(py::init<std::shared_ptr<ElasticDopplerBroadener>,
@@ -331,7 +415,9 @@ void init_Elastic(py::module& m) {
            py::return_value_policy::reference_internal)
       .def("set_elastic_doppler_broadener",
            &Elastic::set_elastic_doppler_broadener)
-      .def("sample_angle_energy", &Elastic::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Elastic::sample_angle_energy, py::const_))
       .def("angle_pdf", &Elastic::angle_pdf)
       .def("pdf", &Elastic::pdf)
       .def("angle_distribution", &Elastic::angle_distribution)
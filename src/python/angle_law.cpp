@@ -50,14 +50,18 @@ class PyAngleLaw : public AngleLaw {
 void init_AngleLaw(py::module& m) {
   py::class_<AngleLaw, PyAngleLaw, std::shared_ptr<AngleLaw>>(m, "AngleLaw")
       .def(py::init<>())
-      .def("sample_mu", &AngleLaw::sample_mu)
+      .def("sample_mu",
+           py::overload_cast<const std::function<double()>&>(
+               &AngleLaw::sample_mu, py::const_))
       .def("pdf", &AngleLaw::pdf);
 }
 
 void init_Isotropic(py::module& m) {
   py::class_<Isotropic, AngleLaw, std::shared_ptr<Isotropic>>(m, "Isotropic")
       .def(py::init<>())
-      .def("sample_mu", &Isotropic::sample_mu)
+      .def("sample_mu",
+           py::overload_cast<const std::function<double()>&>(
+               &Isotropic::sample_mu, py::const_))
       .def("pdf", &Isotropic::pdf);
 }
 
@@ -66,7 +70,9 @@ void init_EquiprobableAngleBins(py::module& m) {
              std::shared_ptr<EquiprobableAngleBins>>(m, "EquiprobableAngleBins")
       .def(py::init<const ACE&, size_t>())
       .def(py::init<const std::vector<double>&>())
-      .def("sample_mu", &EquiprobableAngleBins::sample_mu)
+      .def("sample_mu",
+           py::overload_cast<const std::function<double()>&>(
+               &EquiprobableAngleBins::sample_mu, py::const_))
       .def("pdf", &EquiprobableAngleBins::pdf)
       .def("size", &EquiprobableAngleBins::size)
       .def("bin_bounds", &EquiprobableAngleBins::bin_bounds);
@@ -79,7 +85,9 @@ void init_AngleTable(py::module& m) {
                     const std::vector<double>&, Interpolation>())
       .def(py::init<const Legendre&>())
       .def(py::init<const PCTable&>())
-      .def("sample_mu", &AngleTable::sample_mu)
+      .def("sample_mu",
+           py::overload_cast<const std::function<double()>&>(
+               &AngleTable::sample_mu, py::const_))
       .def("size", &AngleTable::size)
       .def("cosines", &AngleTable::cosines)
       .def("pdf", py::overload_cast<>(&AngleTable::pdf, py::const_))
@@ -92,7 +100,9 @@ void init_Legendre(py::module& m) {
   py::class_<Legendre, AngleLaw, std::shared_ptr<Legendre>>(m, "Legendre")
       .def(py::init<>())
       .def(py::init<const std::vector<double>&>())
-      .def("sample_mu", &Legendre::sample_mu)
+      .def("sample_mu",
+           py::overload_cast<const std::function<double()>&>(
+               &Legendre::sample_mu, py::const_))
       .def("pdf", &Legendre::pdf)
       .def("set_moment", &Legendre::set_moment)
       .def("coefficients", &Legendre::coefficients);
@@ -24,6 +24,7 @@
 #include <pybind11/stl.h>
 
 #include <PapillonNDL/cross_section.hpp>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -54,7 +55,10 @@ void init_CrossSection(py::module& m) {
       .def("size", &CrossSection::size)
       .def("index", &CrossSection::index)
       .def("xs", py::overload_cast<size_t>(&CrossSection::xs, py::const_))
-      .def("xs", py::overload_cast<>(&CrossSection::xs, py::const_))
+      .def("xs",
+           [](const CrossSection& xs) {
+             return std::vector<double>(xs.xs().begin(), xs.xs().end());
+           })
       .def("energy",
            py::overload_cast<size_t>(&CrossSection::energy, py::const_))
       .def("energy", py::overload_cast<>(&CrossSection::energy, py::const_))
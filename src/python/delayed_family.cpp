@@ -35,7 +35,12 @@ void init_DelayedFamily(py::module& m) {
       .def("decay_constant", &DelayedFamily::decay_constant)
       .def("probability", &DelayedFamily::probability,
            py::return_value_policy::reference_internal)
-      .def("sample_energy", &DelayedFamily::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &DelayedFamily::sample_energy, py::const_))
+      .def("sample_energy", py::overload_cast<double, RNGStream&>(
+                                &DelayedFamily::sample_energy, py::const_))
+      .def("map_energy_grid", &DelayedFamily::map_energy_grid)
       .def("energy", &DelayedFamily::energy,
            py::return_value_policy::reference_internal);
 }
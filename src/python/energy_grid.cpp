@@ -25,6 +25,7 @@
 
 #include <PapillonNDL/energy_grid.hpp>
 #include <memory>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -35,7 +36,11 @@ void init_EnergyGrid(py::module& m) {
       .def(py::init<const ACE&, uint32_t>())
       .def(py::init<const std::vector<double>&, uint32_t>())
       .def("__getitem__", &EnergyGrid::operator[])
-      .def("grid", &EnergyGrid::grid)
+      .def("grid",
+           [](const EnergyGrid& egrid) {
+             return std::vector<double>(egrid.grid().begin(),
+                                        egrid.grid().end());
+           })
       .def("size", &EnergyGrid::size)
       .def("min_energy", &EnergyGrid::min_energy)
       .def("max_energy", &EnergyGrid::max_energy)
@@ -55,7 +55,9 @@ class PyEnergyLaw : public EnergyLaw {
 void init_EnergyLaw(py::module& m) {
   py::class_<EnergyLaw, PyEnergyLaw, std::shared_ptr<EnergyLaw>>(m, "EnergyLaw")
       .def(py::init<>())
-      .def("sample_energy", &EnergyLaw::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &EnergyLaw::sample_energy, py::const_))
       .def("pdf", &EnergyLaw::pdf);
 }
 
@@ -66,11 +68,16 @@ void init_EquiprobableEnergyBins(py::module& m) {
       .def(py::init<const ACE&, size_t>())
       .def(py::init<const std::vector<double>&,
                     const std::vector<std::vector<double>>&>())
-      .def("sample_energy", &EquiprobableEnergyBins::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &EquiprobableEnergyBins::sample_energy, py::const_))
       .def("pdf", &EquiprobableEnergyBins::pdf)
       .def("size", &EquiprobableEnergyBins::size)
       .def("incoming_energy", &EquiprobableEnergyBins::incoming_energy)
-      .def("bin_bounds", &EquiprobableEnergyBins::bin_bounds);
+      .def("bin_bounds", [](const EquiprobableEnergyBins& bins, std::size_t i) {
+        auto bounds = bins.bin_bounds(i);
+        return std::vector<double>(bounds.begin(), bounds.end());
+      });
 }
 
 void init_DiscretePhoton(py::module& m) {
@@ -78,7 +85,9 @@ void init_DiscretePhoton(py::module& m) {
       m, "DiscretePhoton")
       .def(py::init<const ACE&, size_t>())
       .def(py::init<int, double, double>())
-      .def("sample_energy", &DiscretePhoton::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &DiscretePhoton::sample_energy, py::const_))
       .def("pdf", &DiscretePhoton::pdf)
       .def("primary_indicator", &DiscretePhoton::primary_indicator)
       .def("photon_energy", &DiscretePhoton::photon_energy);
@@ -89,7 +98,9 @@ void init_LevelInelasticScatter(py::module& m) {
              std::shared_ptr<LevelInelasticScatter>>(m, "LevelInelasticScatter")
       .def(py::init<const ACE&, size_t>())
       .def(py::init<double, double>())
-      .def("sample_energy", &LevelInelasticScatter::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &LevelInelasticScatter::sample_energy, py::const_))
       .def("pdf", &LevelInelasticScatter::pdf)
       .def("C1", &LevelInelasticScatter::C1)
       .def("C2", &LevelInelasticScatter::C2);
@@ -100,7 +111,9 @@ void init_TabularEnergy(py::module& m) {
       m, "TabularEnergy")
       .def(py::init<const ACE&, size_t, size_t>())
       .def(py::init<const std::vector<double>&, const std::vector<PCTable>&>())
-      .def("sample_energy", &TabularEnergy::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &TabularEnergy::sample_energy, py::const_))
       .def("pdf", &TabularEnergy::pdf)
       .def("incoming_energy", &TabularEnergy::incoming_energy)
       .def("table", &TabularEnergy::table, py::return_value_policy::copy)
@@ -112,7 +125,9 @@ void init_GeneralEvaporation(py::module& m) {
              std::shared_ptr<GeneralEvaporation>>(m, "GeneralEvaporation")
       .def(py::init<const ACE&, size_t>())
       .def(py::init<std::shared_ptr<Tabulated1D>, const std::vector<double>&>())
-      .def("sample_energy", &GeneralEvaporation::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &GeneralEvaporation::sample_energy, py::const_))
       .def("pdf", &GeneralEvaporation::pdf)
       .def("temperature", &GeneralEvaporation::temperature,
            py::return_value_policy::reference_internal)
@@ -124,11 +139,15 @@ void init_Evaporation(py::module& m) {
       m, "Evaporation")
       .def(py::init<const ACE&, size_t>())
       .def(py::init<std::shared_ptr<Tabulated1D>, double>())
-      .def("sample_energy", &Evaporation::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Evaporation::sample_energy, py::const_))
       .def("pdf", &Evaporation::pdf)
       .def("temperature", &Evaporation::temperature,
            py::return_value_policy::reference_internal)
-      .def("U", &Evaporation::U);
+      .def("U", &Evaporation::U)
+      .def("set_tabulated", &Evaporation::set_tabulated)
+      .def("tabulated", &Evaporation::tabulated);
 }
 
 void init_Maxwellian(py::module& m) {
@@ -136,11 +155,15 @@ void init_Maxwellian(py::module& m) {
                                                                  "Maxwellian")
       .def(py::init<const ACE&, size_t>())
       .def(py::init<std::shared_ptr<Tabulated1D>, double>())
-      .def("sample_energy", &Maxwellian::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Maxwellian::sample_energy, py::const_))
       .def("pdf", &Maxwellian::pdf)
       .def("temperature", &Maxwellian::temperature,
            py::return_value_policy::reference_internal)
-      .def("U", &Maxwellian::U);
+      .def("U", &Maxwellian::U)
+      .def("set_tabulated", &Maxwellian::set_tabulated)
+      .def("tabulated", &Maxwellian::tabulated);
 }
 
 void init_Watt(py::module& m) {
@@ -148,9 +171,13 @@ void init_Watt(py::module& m) {
       .def(py::init<const ACE&, size_t>())
       .def(py::init<std::shared_ptr<Tabulated1D>, std::shared_ptr<Tabulated1D>,
                     double>())
-      .def("sample_energy", &Watt::sample_energy)
+      .def("sample_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &Watt::sample_energy, py::const_))
       .def("pdf", &Watt::pdf)
       .def("a", &Watt::a, py::return_value_policy::reference_internal)
       .def("b", &Watt::b, py::return_value_policy::reference_internal)
-      .def("U", &Watt::U);
+      .def("U", &Watt::U)
+      .def("set_tabulated", &Watt::set_tabulated)
+      .def("tabulated", &Watt::tabulated);
 }
@@ -33,20 +33,40 @@ namespace py = pybind11;
 using namespace pndl;
 
 void init_Fission(py::module& m) {
+  py::class_<FissionNeutron>(m, "FissionNeutron")
+      .def_readwrite("cosine_angle", &FissionNeutron::cosine_angle)
+      .def_readwrite("energy", &FissionNeutron::energy)
+      .def_readwrite("family", &FissionNeutron::family);
+
   py::class_<Fission, std::shared_ptr<Fission>>(m, "Fission")
       .def(py::init<const ACE&, std::shared_ptr<EnergyGrid>>())
       .def(py::init<const ACE&, std::shared_ptr<EnergyGrid>, const Fission&>())
-      .def("nu_total", &Fission::nu_total,
+      .def("nu_total", py::overload_cast<>(&Fission::nu_total, py::const_),
+           py::return_value_policy::reference_internal)
+      .def("nu_total", py::overload_cast<double, std::size_t>(
+                          &Fission::nu_total, py::const_))
+      .def("nu_prompt", py::overload_cast<>(&Fission::nu_prompt, py::const_),
            py::return_value_policy::reference_internal)
-      .def("nu_prompt", &Fission::nu_prompt,
+      .def("nu_prompt", py::overload_cast<double, std::size_t>(
+                          &Fission::nu_prompt, py::const_))
+      .def("nu_delayed", py::overload_cast<>(&Fission::nu_delayed, py::const_),
            py::return_value_policy::reference_internal)
-      .def("nu_delayed", &Fission::nu_delayed,
+      .def("nu_delayed", py::overload_cast<double, std::size_t>(
+                          &Fission::nu_delayed, py::const_))
+      .def("tabulated_nu_total", &Fission::tabulated_nu_total,
            py::return_value_policy::reference_internal)
       .def("prompt_spectrum", &Fission::prompt_spectrum,
            py::return_value_policy::reference_internal)
       .def("n_delayed_families", &Fission::n_delayed_families)
       .def("delayed_family", &Fission::delayed_family)
+      .def("select_delayed_family", &Fission::select_delayed_family)
       .def("mt_list", &Fission::mt_list)
       .def("has_reaction", &Fission::has_reaction)
-      .def("reaction", &Fission::reaction);
+      .def("reaction", &Fission::reaction)
+      .def("sample_fission_neutrons",
+           [](const Fission& f, double E_in, std::size_t n, RNGStream& rng) {
+             std::vector<FissionNeutron> neutrons;
+             f.sample_fission_neutrons(E_in, n, rng, neutrons);
+             return neutrons;
+           });
 }
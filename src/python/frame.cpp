@@ -33,6 +33,13 @@ using namespace pndl;
 void init_Frame(py::module& m) {
   py::enum_<Frame>(m, "Frame").value("Lab", Frame::Lab).value("CM", Frame::CM);
 
+  py::class_<KinematicConstants>(m, "KinematicConstants")
+      .def(py::init<double>())
+      .def_readonly("awr", &KinematicConstants::awr)
+      .def_readonly("awr_p1", &KinematicConstants::awr_p1)
+      .def_readonly("awr_p1_sqr", &KinematicConstants::awr_p1_sqr)
+      .def_readonly("inv_awr_p1", &KinematicConstants::inv_awr_p1);
+
   // Because fundamental types (i.e. float) are imutable in Python, we need
   // to bind a lambda function which returns a tuple for the first transform
   // overload.
@@ -23,6 +23,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/constant.hpp>
 #include <PapillonNDL/difference_1d.hpp>
 #include <PapillonNDL/polynomial_1d.hpp>
@@ -95,6 +96,22 @@ void init_Tabulated1D(py::module& m) {
       .def("linearize", &Tabulated1D::linearize);
 }
 
+void init_CompiledTabulated1D(py::module& m) {
+  py::class_<CompiledTabulated1D, Function1D,
+             std::shared_ptr<CompiledTabulated1D>>(m, "CompiledTabulated1D")
+      .def(py::init<const Tabulated1D&>())
+      .def("__call__", &CompiledTabulated1D::operator())
+      .def("evaluate", &CompiledTabulated1D::evaluate)
+      .def("integrate", &CompiledTabulated1D::integrate)
+      .def("x", &CompiledTabulated1D::x)
+      .def("y", &CompiledTabulated1D::y)
+      .def("interpolation", &CompiledTabulated1D::interpolation)
+      .def("linlin", &CompiledTabulated1D::linlin)
+      .def("hashed", &CompiledTabulated1D::hashed)
+      .def("min_x", &CompiledTabulated1D::min_x)
+      .def("max_x", &CompiledTabulated1D::max_x);
+}
+
 void init_Sum1D(py::module& m) {
   py::class_<Sum1D, Function1D, std::shared_ptr<Sum1D>>(m, "Sum1D")
       .def(py::init<std::shared_ptr<Function1D>, std::shared_ptr<Function1D>>())
@@ -24,6 +24,7 @@
 #include <pybind11/pybind11.h>
 
 #include <PapillonNDL/rng.hpp>
+#include <PapillonNDL/rng_stream.hpp>
 #include <functional>
 #include <random>
 
@@ -34,4 +35,15 @@ void init_PRNG(py::module& m) {
   m.def("rng_seed", &pndl::rng_seed);
   m.def("rng_reset", &pndl::rng_reset);
   m.def("rng_advance", &pndl::rng_advance);
+
+  py::class_<pndl::RNGStream>(m, "RNGStream")
+      .def(py::init<std::uint64_t>(),
+           py::arg("seed") = pndl::RNGStream::default_seed)
+      .def("__call__", &pndl::RNGStream::operator())
+      .def("rng", &pndl::RNGStream::rng)
+      .def("seed", &pndl::RNGStream::seed)
+      .def("advance", &pndl::RNGStream::advance)
+      .def("split", &pndl::RNGStream::split, py::arg("n"),
+           py::arg("stride") = pndl::RNGStream::default_stride)
+      .def("state", &pndl::RNGStream::state);
 }
@@ -35,6 +35,7 @@ extern void init_Function1D(py::module&);
 extern void init_Constant(py::module&);
 extern void init_Polynomial1D(py::module&);
 extern void init_Tabulated1D(py::module&);
+extern void init_CompiledTabulated1D(py::module&);
 extern void init_Sum1D(py::module&);
 extern void init_Difference1D(py::module&);
 extern void init_Linearize(py::module&);
@@ -101,6 +102,7 @@ PYBIND11_MODULE(pyPapillonNDL, m) {
   init_Constant(m);
   init_Polynomial1D(m);
   init_Tabulated1D(m);
+  init_CompiledTabulated1D(m);
   init_Sum1D(m);
   init_Difference1D(m);
   init_Linearize(m);
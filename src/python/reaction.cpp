@@ -35,11 +35,15 @@ void init_ReactionBase(py::module& m) {
   py::class_<ReactionBase>(m, "ReactionBase")
       .def("mt", &ReactionBase::mt)
       .def("q", &ReactionBase::q)
-      .def("multiplicity", &ReactionBase::yield,
+      .def("multiplicity",
+           py::overload_cast<>(&ReactionBase::yield, py::const_),
            py::return_value_policy::reference_internal)
+      .def("multiplicity",
+           py::overload_cast<double>(&ReactionBase::yield, py::const_))
       .def("threshold", &ReactionBase::threshold)
       .def("sample_neutron_angle_energy",
-           &ReactionBase::sample_neutron_angle_energy)
+           py::overload_cast<double, const std::function<double()>&>(
+               &ReactionBase::sample_neutron_angle_energy, py::const_))
       .def("neutron_distribution", &ReactionBase::neutron_distribution,
            py::return_value_policy::reference_internal);
 }
@@ -28,6 +28,7 @@
 
 #include <PapillonNDL/st_neutron.hpp>
 #include <memory>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -41,6 +42,8 @@ void init_STNeutron(py::module& m) {
       .def("awr", &STNeutron::awr)
       .def("fissile", &STNeutron::fissile)
       .def("temperature", &STNeutron::temperature)
+      .def("memory_footprint", &STNeutron::memory_footprint)
+      .def("map_energy_grid", &STNeutron::map_energy_grid)
       .def("energy_grid", &STNeutron::energy_grid)
       .def("total_xs", &STNeutron::total_xs)
       .def("elastic_xs", &STNeutron::elastic_xs)
@@ -61,5 +64,11 @@ void init_STNeutron(py::module& m) {
       .def("evaluate_xs",
            py::overload_cast<double>(&STNeutron::evaluate_xs, py::const_))
       .def("evaluate_xs", py::overload_cast<double, std::size_t>(
-                              &STNeutron::evaluate_xs, py::const_));
+                              &STNeutron::evaluate_xs, py::const_))
+      .def("evaluate_xs",
+           [](const STNeutron& nuclide, const std::vector<double>& Ein) {
+             XSPacketBatch xs(Ein.size());
+             nuclide.evaluate_xs(Ein, xs);
+             return xs;
+           });
 }
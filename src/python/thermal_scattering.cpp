@@ -73,8 +73,13 @@ void init_STCoherentElastic(py::module& m) {
   py::class_<STCoherentElastic, STTSLReaction,
              std::shared_ptr<STCoherentElastic>>(m, "STCoherentElastic")
       .def(py::init<const ACE&>())
-      .def("xs", &STCoherentElastic::xs)
-      .def("sample_angle_energy", &STCoherentElastic::sample_angle_energy)
+      .def("xs", py::overload_cast<double>(&STCoherentElastic::xs, py::const_))
+      .def("xs", py::overload_cast<double, std::size_t>(&STCoherentElastic::xs,
+                                                        py::const_))
+      .def("bragg_index", &STCoherentElastic::bragg_index)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &STCoherentElastic::sample_angle_energy, py::const_))
       .def("bragg_edges", &STCoherentElastic::bragg_edges)
       .def("structure_factor_sum", &STCoherentElastic::structure_factor_sum)
       .def("angle_pdf", &STCoherentElastic::angle_pdf)
@@ -90,9 +95,14 @@ void init_STInoherentElasticACE(py::module& m) {
            py::return_value_policy::reference_internal)
       .def("xs",
            py::overload_cast<double>(&STIncoherentElasticACE::xs, py::const_))
-      .def("sample_angle_energy", &STIncoherentElasticACE::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &STIncoherentElasticACE::sample_angle_energy, py::const_))
       .def("incoming_energy", &STIncoherentElasticACE::incoming_energy)
-      .def("cosines", &STIncoherentElasticACE::cosines)
+      .def("cosines",
+           [](const STIncoherentElasticACE& ie) {
+             return ie.cosines().rows();
+           })
       .def("angle_pdf", &STIncoherentElasticACE::angle_pdf)
       .def("pdf", &STIncoherentElasticACE::pdf);
 }
@@ -105,7 +115,9 @@ void init_STIncoherentInelastic(py::module& m) {
            py::return_value_policy::reference_internal)
       .def("xs",
            py::overload_cast<double>(&STIncoherentInelastic::xs, py::const_))
-      .def("sample_angle_energy", &STIncoherentInelastic::sample_angle_energy)
+      .def("sample_angle_energy",
+           py::overload_cast<double, const std::function<double()>&>(
+               &STIncoherentInelastic::sample_angle_energy, py::const_))
       .def("angle_pdf", &STIncoherentInelastic::angle_pdf)
       .def("pdf", &STIncoherentInelastic::pdf)
       .def("distribution", &STIncoherentInelastic::distribution,
@@ -114,6 +126,17 @@ void init_STIncoherentInelastic(py::module& m) {
 }
 
 void init_STThermalScatteringLaw(py::module& m) {
+  py::enum_<TSLChannel>(m, "TSLChannel")
+      .value("IncoherentInelastic", TSLChannel::IncoherentInelastic)
+      .value("IncoherentElastic", TSLChannel::IncoherentElastic)
+      .value("CoherentElastic", TSLChannel::CoherentElastic);
+
+  // The reaction is obtained from the law with the channel, so that Python
+  // never holds a bare pointer to it.
+  py::class_<TSLSelection>(m, "TSLSelection")
+      .def_readonly("xs", &TSLSelection::xs)
+      .def_readonly("channel", &TSLSelection::channel);
+
   py::class_<STThermalScatteringLaw, std::shared_ptr<STThermalScatteringLaw>>(
       m, "STThermalScatteringLaw")
       .def(py::init<const ACE&, bool>(), py::arg("ace"),
@@ -123,6 +146,7 @@ void init_STThermalScatteringLaw(py::module& m) {
       .def("temperature", &STThermalScatteringLaw::temperature)
       .def("max_energy", &STThermalScatteringLaw::max_energy)
       .def("xs", &STThermalScatteringLaw::xs)
+      .def("evaluate_and_select", &STThermalScatteringLaw::evaluate_and_select)
       .def("has_coherent_elastic",
            &STThermalScatteringLaw::has_coherent_elastic)
       .def("has_incoherent_elastic",
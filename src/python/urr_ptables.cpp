@@ -47,7 +47,7 @@ void init_URRPtable(py::module& m) {
       .def(py::init<const ACE&, const CrossSection&, const CrossSection&,
                     const CrossSection&, const CrossSection&,
                     const CrossSection&, const CrossSection&,
-                    const std::vector<STReaction>&>())
+                    const std::vector<STReaction>&, const CrossSection&>())
       .def("is_valid", &URRPTables::is_valid)
       .def("evaluate_xs", py::overload_cast<double, std::size_t, double>(
                               &URRPTables::evaluate_xs, py::const_))
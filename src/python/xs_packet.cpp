@@ -21,8 +21,11 @@
  *
  * */
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include <PapillonNDL/xs_packet.hpp>
+#include <PapillonNDL/xs_packet_batch.hpp>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -38,6 +41,7 @@ void init_XSPacket(py::module& m) {
       .def_readwrite("capture", &XSPacket::capture)
       .def_readwrite("fission", &XSPacket::fission)
       .def_readwrite("heating", &XSPacket::heating)
+      .def_readwrite("nu_fission", &XSPacket::nu_fission)
       .def("__add__",
            py::overload_cast<const XSPacket&>(&XSPacket::operator+, py::const_))
       .def("__sub__",
@@ -50,4 +54,28 @@ void init_XSPacket(py::module& m) {
       .def("__itruediv__", &XSPacket::operator/=)
       .def("__pos__", py::overload_cast<>(&XSPacket::operator+, py::const_))
       .def("__neg__", py::overload_cast<>(&XSPacket::operator-, py::const_));
+
+  py::class_<XSPacketBatch>(m, "XSPacketBatch")
+      .def(py::init<std::size_t>(), py::arg("size") = 0)
+      .def("size", &XSPacketBatch::size)
+      .def("__len__", &XSPacketBatch::size)
+      .def("resize", &XSPacketBatch::resize)
+      .def("zero", &XSPacketBatch::zero)
+      .def("get", &XSPacketBatch::get)
+      .def("set", &XSPacketBatch::set)
+      .def("__iadd__", &XSPacketBatch::operator+=)
+      .def("__isub__", &XSPacketBatch::operator-=)
+      .def("__imul__", &XSPacketBatch::operator*=)
+      .def("__itruediv__", &XSPacketBatch::operator/=)
+      .def("scale",
+           [](XSPacketBatch& batch, const std::vector<double>& factors) {
+             batch.scale(factors);
+           })
+      .def("accumulate", py::overload_cast<const XSPacketBatch&, double>(
+                             &XSPacketBatch::accumulate))
+      .def("accumulate",
+           [](XSPacketBatch& batch, const XSPacketBatch& micro,
+              const std::vector<double>& densities) {
+             batch.accumulate(micro, densities);
+           });
 }
@@ -24,6 +24,8 @@
 #include <PapillonNDL/reaction.hpp>
 #include <memory>
 
+#include "memory.hpp"
+
 /**
  * @file
  * @author Hunter Belanger
@@ -31,14 +33,16 @@
 
 namespace pndl {
 
-Reaction<CrossSection>::Reaction(const ACE& ace, std::size_t indx,
-                                 std::shared_ptr<EnergyGrid> egrid)
+Reaction<CrossSection>::Reaction(
+    const ACE& ace, std::size_t indx, std::shared_ptr<EnergyGrid> egrid,
+    std::shared_ptr<std::pmr::memory_resource> memory)
     : ReactionBase(ace, indx), xs_(nullptr) {
   try {
     uint32_t loca =
         ace.xss<uint32_t>(static_cast<std::size_t>(ace.LSIG()) + indx);
-    xs_ = std::make_shared<CrossSection>(
-        ace, static_cast<std::size_t>(ace.SIG()) + loca - 1, egrid);
+    xs_ = detail::make_shared<CrossSection>(
+        memory, ace, static_cast<std::size_t>(ace.SIG()) + loca - 1, egrid,
+        true, false, memory);
     threshold_ = xs_->energy(0);
   } catch (PNDLException& error) {
     std::string mssg = "Could not create cross section for MT = " +
@@ -48,9 +52,9 @@ Reaction<CrossSection>::Reaction(const ACE& ace, std::size_t indx,
   }
 }
 
-Reaction<CrossSection>::Reaction(const ACE& ace, std::size_t indx,
-                                 std::shared_ptr<EnergyGrid> egrid,
-                                 const Reaction& reac)
+Reaction<CrossSection>::Reaction(
+    const ACE& ace, std::size_t indx, std::shared_ptr<EnergyGrid> egrid,
+    const Reaction& reac, std::shared_ptr<std::pmr::memory_resource> memory)
     : ReactionBase(reac), xs_(nullptr) {
   // make sure the MT values agree
   if (this->mt() != reac.mt()) {
@@ -62,8 +66,9 @@ Reaction<CrossSection>::Reaction(const ACE& ace, std::size_t indx,
   try {
     uint32_t loca =
         ace.xss<uint32_t>(static_cast<std::size_t>(ace.LSIG()) + indx);
-    xs_ = std::make_shared<CrossSection>(
-        ace, static_cast<std::size_t>(ace.SIG()) + loca - 1, egrid);
+    xs_ = detail::make_shared<CrossSection>(
+        memory, ace, static_cast<std::size_t>(ace.SIG()) + loca - 1, egrid,
+        true, false, memory);
     threshold_ = xs_->energy(0);
   } catch (PNDLException& error) {
     std::string mssg =
@@ -23,6 +23,7 @@
 #include <PapillonNDL/absorption.hpp>
 #include <PapillonNDL/angle_distribution.hpp>
 #include <PapillonNDL/cm_distribution.hpp>
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/constant.hpp>
 #include <PapillonNDL/discrete_photon.hpp>
 #include <PapillonNDL/equiprobable_energy_bins.hpp>
@@ -52,7 +53,8 @@ ReactionBase::ReactionBase(const ACE& ace, std::size_t indx)
       awr_(),
       threshold_(),
       yield_(nullptr),
-      neutron_distribution_(nullptr) {
+      neutron_distribution_(nullptr),
+      compiled_yield_(nullptr) {
   // Get MT, Q, and AWR
   mt_ = ace.xss<uint32_t>(static_cast<std::size_t>(ace.MTR()) + indx);
   q_ = ace.xss(static_cast<std::size_t>(ace.LQR()) + indx);
@@ -96,6 +98,10 @@ ReactionBase::ReactionBase(const ACE& ace, std::size_t indx)
     throw error;
   }
 
+  if (auto tab = std::dynamic_pointer_cast<Tabulated1D>(yield_)) {
+    compiled_yield_ = std::make_shared<CompiledTabulated1D>(*tab);
+  }
+
   // Here, we set the threshold to zero, just so it has a value, but this should
   // be initalized by the daughter class after initialization.
   threshold_ = 0.;
@@ -145,7 +151,8 @@ ReactionBase::ReactionBase(uint32_t mt, double q, double awr, double threshold,
       awr_(awr),
       threshold_(threshold),
       yield_(yield),
-      neutron_distribution_(neutron_distribution) {
+      neutron_distribution_(neutron_distribution),
+      compiled_yield_(nullptr) {
   // Make sure the threshold is >= 0
   if (threshold_ < 0.) {
     std::string mssg =
@@ -157,6 +164,10 @@ ReactionBase::ReactionBase(uint32_t mt, double q, double awr, double threshold,
     std::string mssg = "Atomic weight ratio must be greater than zero.";
     throw PNDLException(mssg);
   }
+
+  if (auto tab = std::dynamic_pointer_cast<Tabulated1D>(yield_)) {
+    compiled_yield_ = std::make_shared<CompiledTabulated1D>(*tab);
+  }
 }
 
 void ReactionBase::load_neutron_distributions(
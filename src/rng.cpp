@@ -21,22 +21,38 @@
  *
  * */
 #include <PapillonNDL/rng.hpp>
-#include <random>
+#include <PapillonNDL/rng_stream.hpp>
+#include <atomic>
+#include <cstdint>
 
 namespace pndl {
 
-using LCG = std::linear_congruential_engine<uint64_t, 2806196910506780709ULL, 1,
-                                            0x8000000000000000>;
+// Each thread has its own stream, so that rng may be called from multiple
+// threads without any data races. Threads are numbered in the order in which
+// they first use rng, and each thread's stream starts in its own block of
+// rng_thread_stride random numbers after the seed.
+static std::atomic<std::uint64_t> thread_count{0};
 
-static LCG lcg;
-static std::uniform_real_distribution<double> unit_dist;
+static RNGStream thread_start(std::uint64_t seed, std::uint64_t thread) {
+  return RNGStream(seed).split(thread, rng_thread_stride);
+}
 
-double rng() { return unit_dist(lcg); }
+static thread_local const std::uint64_t thread_index = thread_count++;
+static thread_local RNGStream thread_stream =
+    thread_start(RNGStream::default_seed, thread_index);
 
-void rng_reset() { lcg.seed(lcg.default_seed); }
+double rng() { return thread_stream(); }
 
-void rng_seed(std::uint64_t seed) { lcg.seed(seed); }
+RNGStream& rng_stream() { return thread_stream; }
 
-void rng_advance(std::uint64_t n) { lcg.discard(n); }
+void rng_reset() {
+  thread_stream = thread_start(RNGStream::default_seed, thread_index);
+}
+
+void rng_seed(std::uint64_t seed) {
+  thread_stream = thread_start(seed, thread_index);
+}
+
+void rng_advance(std::uint64_t n) { thread_stream.advance(n); }
 
 }  // namespace pndl
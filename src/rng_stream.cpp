@@ -0,0 +1,57 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <PapillonNDL/rng_stream.hpp>
+
+namespace pndl {
+
+void RNGStream::advance(std::uint64_t n) {
+  // Uses the algorithm from [1] to compute the multiplier and increment
+  // which take the generator n steps forward in a single step. All of the
+  // arithmetic is done modulo 2^64, which is a multiple of the modulus 2^63,
+  // so the mask only needs to be applied at the end.
+  std::uint64_t g = MULT;
+  std::uint64_t c = INC;
+  std::uint64_t g_new = 1;
+  std::uint64_t c_new = 0;
+
+  while (n > 0) {
+    if (n & 1) {
+      g_new *= g;
+      c_new = c_new * g + c;
+    }
+    c *= (g + 1);
+    g *= g;
+    n >>= 1;
+  }
+
+  state_ = (g_new * state_ + c_new) & MASK;
+}
+
+}  // namespace pndl
+
+/*
+ * REFERENCES
+ *
+ * [1] F. B. Brown, “Random number generation with arbitrary strides,” Trans.
+ * Am. Nucl. Soc., vol. 71, pp. 202–203, 1994.
+ */
@@ -0,0 +1,90 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#include <cmath>
+
+#include "constants.hpp"
+#include "spectrum_table.hpp"
+
+namespace pndl {
+namespace detail {
+
+SpectrumTable::SpectrumTable(double (*cdf)(double), double (*pdf)(double))
+    : x_(NBINS, 0.), cdf_(cdf), pdf_(pdf) {
+  for (std::size_t j = 1; j < NBINS; j++) {
+    const double t = static_cast<double>(j) / static_cast<double>(NBINS);
+    x_[j] = invert(t * t, x_[j - 1]);
+  }
+}
+
+double SpectrumTable::invert(double P, double x_low) const {
+  // Newton's method, safeguarded by bisection. The CDF of all spectra is 1
+  // to machine precision at x = 50.
+  double x_hi = 50.;
+  double x = x_low;
+
+  for (std::size_t iter = 0; iter < 100; iter++) {
+    const double F = cdf_(x) - P;
+    if (F < 0.)
+      x_low = x;
+    else
+      x_hi = x;
+
+    const double f = pdf_(x);
+    double x_new = f > 0. ? x - F / f : 0.5 * (x_low + x_hi);
+    if (x_new <= x_low || x_new >= x_hi) x_new = 0.5 * (x_low + x_hi);
+
+    const bool converged = std::abs(x_new - x) <= 1.E-14 * x_new;
+    x = x_new;
+    if (converged) break;
+  }
+
+  return x;
+}
+
+namespace {
+double maxwellian_cdf(double x) {
+  const double sqrt_x = std::sqrt(x);
+  return std::erf(sqrt_x) - (2. / std::sqrt(PI)) * sqrt_x * std::exp(-x);
+}
+
+double maxwellian_pdf(double x) {
+  return (2. / std::sqrt(PI)) * std::sqrt(x) * std::exp(-x);
+}
+
+double evaporation_cdf(double x) { return 1. - (1. + x) * std::exp(-x); }
+
+double evaporation_pdf(double x) { return x * std::exp(-x); }
+}  // namespace
+
+const SpectrumTable& maxwellian_spectrum_table() {
+  static const SpectrumTable table(maxwellian_cdf, maxwellian_pdf);
+  return table;
+}
+
+const SpectrumTable& evaporation_spectrum_table() {
+  static const SpectrumTable table(evaporation_cdf, evaporation_pdf);
+  return table;
+}
+
+}  // namespace detail
+}  // namespace pndl
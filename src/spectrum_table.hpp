@@ -0,0 +1,115 @@
+/*
+ * Papillon Nuclear Data Library
+ * Copyright 2021-2023, Hunter Belanger
+ *
+ * hunter.belanger@gmail.com
+ *
+ * This file is part of the Papillon Nuclear Data Library (PapillonNDL).
+ *
+ * PapillonNDL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PapillonNDL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PapillonNDL. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * */
+#ifndef PAPILLON_NDL_SPECTRUM_TABLE_H
+#define PAPILLON_NDL_SPECTRUM_TABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace pndl {
+namespace detail {
+
+// Tabulated inverse CDF of a spectrum in a reduced variable x = E / T, on the
+// interval [0, inf). The spectra all behave as a power of x near zero, so
+// that the CDF behaves as x^n, with 3/2 <= n <= 2. The inverse CDF is
+// therefore tabulated at NBINS equally spaced points of t = sqrt(P), where x
+// is nearly linear in t, and is linearly interpolated, so that sampling
+// requires a single random number and no search. The last bin extends to
+// infinity, and is sampled by inverting the exact CDF. The reduced spectra
+// are independent of the temperature, so a single table is shared by all
+// instances of a law.
+class SpectrumTable {
+ public:
+  // The CDF and PDF must be the exact CDF and PDF of the reduced spectrum.
+  SpectrumTable(double (*cdf)(double), double (*pdf)(double));
+
+  // Returns the probability of sampling a value in [0, x_max], for x_max
+  // below the last bin.
+  double probability(double x_max) const {
+    if (x_max <= 0.) return 0.;
+    return x_max < x_.back() ? cdf_(x_max) : 1.;
+  }
+
+  // Samples x from the spectrum, restricted to the interval [0, x_max].
+  template <class RNG>
+  double sample(RNG& rng,
+                double x_max = std::numeric_limits<double>::infinity()) const {
+    return this->sample(rng, x_max, this->probability(x_max));
+  }
+
+  // Samples x from the spectrum, restricted to the interval [0, x_max], with
+  // P_max = probability(x_max) already evaluated, so that repeated samples
+  // with the same restriction only evaluate the CDF once.
+  template <class RNG>
+  double sample(RNG& rng, double x_max, double P_max) const {
+    if (x_max <= 0.) return 0.;
+
+    if (x_max < x_.back()) {
+      // Restrict xi to the probability of [0, x_max], which never reaches
+      // the last bin. Round off in the interpolation may push x slightly
+      // above x_max, so the result is clamped.
+      return std::min(interpolate(std::sqrt(rng() * P_max)), x_max);
+    }
+
+    // Values above x_max can only be sampled in the last bin, so rejection
+    // is very rare.
+    while (true) {
+      const double xi = rng();
+      const double t = std::sqrt(xi);
+      const double x = t < T_LAST ? interpolate(t) : invert(xi, x_.back());
+      if (x <= x_max) return x;
+    }
+  }
+
+ private:
+  static constexpr std::size_t NBINS = 4096;
+  static constexpr double T_LAST =
+      static_cast<double>(NBINS - 1) / static_cast<double>(NBINS);
+  std::vector<double> x_;
+  double (*cdf_)(double);
+  double (*pdf_)(double);
+
+  double interpolate(double t) const {
+    const double s = t * static_cast<double>(NBINS);
+    const std::size_t j = std::min(static_cast<std::size_t>(s), NBINS - 2);
+    const double f = s - static_cast<double>(j);
+    return x_[j] + f * (x_[j + 1] - x_[j]);
+  }
+
+  // Solves cdf(x) = P for x >= x_low.
+  double invert(double P, double x_low) const;
+};
+
+// Reduced Maxwellian spectrum, sqrt(x) exp(-x).
+const SpectrumTable& maxwellian_spectrum_table();
+
+// Reduced evaporation spectrum, x exp(-x).
+const SpectrumTable& evaporation_spectrum_table();
+
+}  // namespace detail
+}  // namespace pndl
+
+#endif  // PAPILLON_NDL_SPECTRUM_TABLE_H
@@ -28,7 +28,11 @@
 namespace pndl {
 
 STCoherentElastic::STCoherentElastic(const ACE& ace)
-    : bragg_edges_(), structure_factor_sum_() {
+    : bragg_edges_(),
+      structure_factor_sum_(),
+      structure_factor_cdf_(),
+      guide_(),
+      hash_() {
   // Fist make sure ACE file does indeed give coherent elastic scattering
   int32_t elastic_mode = ace.nxs(4);
   if (elastic_mode == 4) {
@@ -48,6 +52,21 @@ STCoherentElastic::STCoherentElastic(const ACE& ace)
       std::string mssg = "Negative Bragg edges found.";
       throw PNDLException(mssg);
     }
+
+    if (!std::is_sorted(structure_factor_sum_.begin(),
+                        structure_factor_sum_.end())) {
+      std::string mssg = "Structure factor sums are not sorted.";
+      throw PNDLException(mssg);
+    }
+
+    // Normalized structure factor sums, for sampling the Bragg edge
+    structure_factor_cdf_ = structure_factor_sum_;
+    if (structure_factor_sum_.back() > 0.) {
+      for (auto& S : structure_factor_cdf_) S /= structure_factor_sum_.back();
+    }
+    guide_ = GuideTable(structure_factor_cdf_);
+
+    hash_ = LogHashTable(bragg_edges_);
   }
 }
 
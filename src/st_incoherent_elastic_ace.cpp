@@ -26,7 +26,11 @@
 namespace pndl {
 
 STIncoherentElasticACE::STIncoherentElasticACE(const ACE& ace)
-    : xs_(nullptr), Nmu(0), incoming_energy_(), cosines_() {
+    : xs_(nullptr),
+      compiled_xs_(nullptr),
+      Nmu(0),
+      incoming_energy_(),
+      cosines_() {
   // Fist make sure ACE file does indeed give coherent elastic scattering
   int32_t elastic_mode = ace.nxs(4);
   if (elastic_mode == 4 || ace.jxs(3) == 0) {
@@ -85,6 +89,8 @@ STIncoherentElasticACE::STIncoherentElasticACE(const ACE& ace)
       cosines_.push_back(cosines_for_ie);
     }  // For all incoming energies
   }
+
+  compiled_xs_ = std::make_shared<CompiledTabulated1D>(*xs_);
 }
 
 }  // namespace pndl
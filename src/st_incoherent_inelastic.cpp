@@ -29,7 +29,7 @@ namespace pndl {
 
 STIncoherentInelastic::STIncoherentInelastic(const ACE& ace,
                                              bool unit_based_interpolation)
-    : xs_(nullptr), angle_energy_(nullptr) {
+    : xs_(nullptr), compiled_xs_(nullptr), angle_energy_(nullptr) {
   // Read the XS
   try {
     std::size_t S = static_cast<std::size_t>(ace.jxs(0) - 1);
@@ -37,6 +37,7 @@ STIncoherentInelastic::STIncoherentInelastic(const ACE& ace,
     std::vector<double> energy = ace.xss(S + 1, Ne);
     std::vector<double> xs = ace.xss(S + 1 + Ne, Ne);
     xs_ = std::make_shared<Tabulated1D>(Interpolation::LinLin, energy, xs);
+    compiled_xs_ = std::make_shared<CompiledTabulated1D>(*xs_);
   } catch (PNDLException& err) {
     std::string mssg = "Could not construct cross section.";
     err.add_to_exception(mssg);
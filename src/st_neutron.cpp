@@ -21,17 +21,58 @@
  *
  * */
 #include <PapillonNDL/elastic_svt.hpp>
+#include <PapillonNDL/memory_arena.hpp>
 #include <PapillonNDL/pndl_exception.hpp>
 #include <PapillonNDL/st_neutron.hpp>
 #include <algorithm>
+#include <span>
+#include <vector>
+
+#include "memory.hpp"
 
 namespace pndl {
 
-STNeutron::STNeutron(const ACE& ace)
+namespace {
+
+// Estimates the number of bytes required to store the energy grid and all of
+// the cross sections of a nuclide, so that its MemoryArena is able to hold
+// all of the cross section data in a single block.
+std::size_t cross_section_bytes(const ACE& ace) {
+  const std::size_t NE = static_cast<std::size_t>(ace.nxs(2));
+  const std::size_t NMT = static_cast<std::size_t>(ace.nxs(3));
+
+  // The energy grid, the four cross sections of the ESZ block, the photon
+  // production and summed fission cross sections, and the hash bins.
+  std::size_t bytes = 7 * NE * sizeof(double) + 8193 * sizeof(uint32_t);
+
+  for (std::size_t indx = 0; indx < NMT; indx++) {
+    const std::size_t loca =
+        ace.xss<std::size_t>(static_cast<std::size_t>(ace.LSIG()) + indx);
+    bytes += ace.xss<std::size_t>(static_cast<std::size_t>(ace.SIG()) + loca) *
+             sizeof(double);
+  }
+
+  // Space for the objects and control blocks of all cross sections
+  bytes += (NMT + 8) * 256;
+
+  return bytes;
+}
+
+std::shared_ptr<std::pmr::memory_resource> nuclide_memory(
+    const ACE& ace, std::shared_ptr<std::pmr::memory_resource> memory) {
+  if (memory) return memory;
+  return std::make_shared<MemoryArena>(cross_section_bytes(ace));
+}
+
+}  // namespace
+
+STNeutron::STNeutron(const ACE& ace,
+                     std::shared_ptr<std::pmr::memory_resource> memory)
     : zaid_(ace.zaid()),
       awr_(ace.awr()),
       fissile_(ace.fissile()),
       temperature_(ace.temperature()),
+      memory_(nuclide_memory(ace, memory)),
       energy_grid_(nullptr),
       total_xs_(nullptr),
       disappearance_xs_(nullptr),
@@ -46,26 +87,30 @@ STNeutron::STNeutron(const ACE& ace)
       reaction_indices_(),
       reactions_() {
   // Construct energy grid
-  energy_grid_ = std::make_shared<EnergyGrid>(ace);
+  energy_grid_ = detail::make_shared<EnergyGrid>(memory_, ace, 8192, memory_);
 
   // Number of energy points
   uint32_t NE = static_cast<uint32_t>(ace.nxs(2));
-  total_xs_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + NE, energy_grid_, false);
-  disappearance_xs_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + 2 * NE, energy_grid_, false);
-  elastic_xs_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + 3 * NE, energy_grid_, false);
-  heating_number_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + 4 * NE, energy_grid_, false,
-      true);
+  total_xs_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + NE, energy_grid_,
+      false, false, memory_);
+  disappearance_xs_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + 2 * NE, energy_grid_,
+      false, false, memory_);
+  elastic_xs_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + 3 * NE, energy_grid_,
+      false, false, memory_);
+  heating_number_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + 4 * NE, energy_grid_,
+      false, true, memory_);
 
   // Get photon production XS if present
   if (ace.jxs(11) != 0) {
-    photon_production_xs_ =
-        std::make_shared<CrossSection>(ace, ace.GPD(), energy_grid_, false);
+    photon_production_xs_ = detail::make_shared<CrossSection>(
+        memory_, ace, ace.GPD(), energy_grid_, false, false, memory_);
   } else {
-    photon_production_xs_ = std::make_shared<CrossSection>(0., energy_grid_);
+    photon_production_xs_ =
+        detail::make_shared<CrossSection>(memory_, 0., energy_grid_, memory_);
   }
 
   // Read all reactions
@@ -78,7 +123,7 @@ STNeutron::STNeutron(const ACE& ace)
     uint32_t MT = ace.xss<uint32_t>(static_cast<std::size_t>(ace.MTR()) + indx);
     if (MT != 18 && MT != 19 && MT != 20 && MT != 21 && MT != 38) {
       mt_list_.push_back(MT);
-      reactions_.emplace_back(ace, indx, energy_grid_);
+      reactions_.emplace_back(ace, indx, energy_grid_, memory_);
       reaction_indices_[MT] = current_reaction_index;
       current_reaction_index++;
     }
@@ -99,7 +144,7 @@ STNeutron::STNeutron(const ACE& ace)
 
   // Make fission info
   try {
-    fission_ = std::make_shared<Fission>(ace, energy_grid_);
+    fission_ = std::make_shared<Fission>(ace, energy_grid_, memory_);
   } catch (PNDLException& err) {
     std::string mssg = "Could not create Fission instance.";
     err.add_to_exception(mssg);
@@ -115,15 +160,18 @@ STNeutron::STNeutron(const ACE& ace)
   // Make the PTables. Grab reference to MT 102
   std::shared_ptr<CrossSection> capture_xs_ = nullptr;
   if (this->has_reaction(102) == false) {
-    capture_xs_ = std::make_shared<CrossSection>(0., energy_grid_);
+    capture_xs_ =
+        detail::make_shared<CrossSection>(memory_, 0., energy_grid_, memory_);
   } else {
-    capture_xs_ = std::make_shared<CrossSection>(this->reaction(102).xs());
+    capture_xs_ =
+        detail::make_shared<CrossSection>(memory_, this->reaction(102).xs());
   }
 
   try {
     urr_ptables_ = std::make_shared<URRPTables>(
         ace, *total_xs_, *disappearance_xs_, *elastic_xs_, *capture_xs_,
-        *fission_xs_, *heating_number_, reactions_);
+        *fission_xs_, *heating_number_, reactions_,
+        fission_->tabulated_nu_total());
   } catch (PNDLException& error) {
     std::string mssg = "Could not construct URRPTables for nuclide data.";
     error.add_to_exception(mssg);
@@ -131,11 +179,13 @@ STNeutron::STNeutron(const ACE& ace)
   }
 }
 
-STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide)
+STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide,
+                     std::shared_ptr<std::pmr::memory_resource> memory)
     : zaid_(nuclide.zaid_),
       awr_(nuclide.awr_),
       fissile_(nuclide.fissile_),
       temperature_(ace.temperature()),
+      memory_(nuclide_memory(ace, memory)),
       energy_grid_(nullptr),
       total_xs_(nullptr),
       disappearance_xs_(nullptr),
@@ -150,26 +200,30 @@ STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide)
       reaction_indices_(),
       reactions_() {
   // Construct energy grid
-  energy_grid_ = std::make_shared<EnergyGrid>(ace);
+  energy_grid_ = detail::make_shared<EnergyGrid>(memory_, ace, 8192, memory_);
 
   // Number of energy points
   uint32_t NE = static_cast<uint32_t>(ace.nxs(2));
-  total_xs_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + NE, energy_grid_, false);
-  disappearance_xs_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + 2 * NE, energy_grid_, false);
-  elastic_xs_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + 3 * NE, energy_grid_, false);
-  heating_number_ = std::make_shared<CrossSection>(
-      ace, static_cast<std::size_t>(ace.ESZ()) + 4 * NE, energy_grid_, false,
-      true);
+  total_xs_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + NE, energy_grid_,
+      false, false, memory_);
+  disappearance_xs_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + 2 * NE, energy_grid_,
+      false, false, memory_);
+  elastic_xs_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + 3 * NE, energy_grid_,
+      false, false, memory_);
+  heating_number_ = detail::make_shared<CrossSection>(
+      memory_, ace, static_cast<std::size_t>(ace.ESZ()) + 4 * NE, energy_grid_,
+      false, true, memory_);
 
   // Get photon production XS if present
   if (ace.jxs(11) != 0) {
-    photon_production_xs_ =
-        std::make_shared<CrossSection>(ace, ace.GPD(), energy_grid_, false);
+    photon_production_xs_ = detail::make_shared<CrossSection>(
+        memory_, ace, ace.GPD(), energy_grid_, false, false, memory_);
   } else {
-    photon_production_xs_ = std::make_shared<CrossSection>(0., energy_grid_);
+    photon_production_xs_ =
+        detail::make_shared<CrossSection>(memory_, 0., energy_grid_, memory_);
   }
 
   // Read all reactions
@@ -184,7 +238,8 @@ STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide)
       mt_list_.push_back(MT);
       reactions_.emplace_back(ace, indx, energy_grid_,
                               nuclide.reactions_[static_cast<std::size_t>(
-                                  nuclide.reaction_indices_[MT])]);
+                                  nuclide.reaction_indices_[MT])],
+                              memory_);
       reaction_indices_[MT] = current_reaction_index;
       current_reaction_index++;
     }
@@ -202,7 +257,8 @@ STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide)
 
   // Make fission info
   try {
-    fission_ = std::make_shared<Fission>(ace, energy_grid_, *nuclide.fission_);
+    fission_ = std::make_shared<Fission>(ace, energy_grid_, *nuclide.fission_,
+                                         memory_);
   } catch (PNDLException& err) {
     std::string mssg = "Could not create Fission instance.";
     err.add_to_exception(mssg);
@@ -218,15 +274,18 @@ STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide)
   // Make the PTables. Grab reference to MT 102
   std::shared_ptr<CrossSection> capture_xs_ = nullptr;
   if (this->has_reaction(102) == false) {
-    capture_xs_ = std::make_shared<CrossSection>(0., energy_grid_);
+    capture_xs_ =
+        detail::make_shared<CrossSection>(memory_, 0., energy_grid_, memory_);
   } else {
-    capture_xs_ = std::make_shared<CrossSection>(this->reaction(102).xs());
+    capture_xs_ =
+        detail::make_shared<CrossSection>(memory_, this->reaction(102).xs());
   }
 
   try {
     urr_ptables_ = std::make_shared<URRPTables>(
         ace, *total_xs_, *disappearance_xs_, *elastic_xs_, *capture_xs_,
-        *fission_xs_, *heating_number_, reactions_);
+        *fission_xs_, *heating_number_, reactions_,
+        fission_->tabulated_nu_total());
   } catch (PNDLException& error) {
     std::string mssg = "Could not construct URRPTables for nuclide data.";
     error.add_to_exception(mssg);
@@ -234,13 +293,63 @@ STNeutron::STNeutron(const ACE& ace, const STNeutron& nuclide)
   }
 }
 
+std::size_t STNeutron::memory_footprint() const {
+  const MemoryArena* arena = dynamic_cast<const MemoryArena*>(memory_.get());
+  if (arena == nullptr) return 0;
+  return arena->footprint();
+}
+
+void STNeutron::map_energy_grid() {
+  elastic_->map_energy_grid(*energy_grid_);
+  fission_->map_energy_grid(*energy_grid_);
+  for (auto& reaction : reactions_) reaction.map_energy_grid(*energy_grid_);
+}
+
+void STNeutron::evaluate_xs(std::span<const double> Ein,
+                            XSPacketBatch& xs) const {
+  if (xs.size() != Ein.size()) xs.resize(Ein.size());
+
+  std::vector<std::size_t> i(Ein.size());
+  for (std::size_t j = 0; j < Ein.size(); j++)
+    i[j] = energy_grid_->get_lower_index(Ein[j]);
+
+  // Each cross section is evaluated over the whole batch, directly into
+  // its channel of the batch.
+  total_xs_->evaluate(Ein, i, xs.total());
+  elastic_xs_->evaluate(Ein, i, xs.elastic());
+  fission_xs_->evaluate(Ein, i, xs.fission());
+  heating_number_->evaluate(Ein, i, xs.heating());
+  disappearance_xs_->evaluate(Ein, i, xs.absorption());
+  fission_->tabulated_nu_total().evaluate(Ein, i, xs.nu_fission());
+  if (this->has_reaction(102)) {
+    this->reaction(102).xs().evaluate(Ein, i, xs.capture());
+  } else {
+    std::fill(xs.capture().begin(), xs.capture().end(), 0.);
+  }
+
+  std::span<double> total = xs.total();
+  std::span<double> elastic = xs.elastic();
+  std::span<double> inelastic = xs.inelastic();
+  std::span<double> absorption = xs.absorption();
+  std::span<double> fission = xs.fission();
+  std::span<double> nu_fission = xs.nu_fission();
+  for (std::size_t j = 0; j < Ein.size(); j++) {
+    nu_fission[j] = fission[j] * nu_fission[j];
+    absorption[j] += fission[j];
+    inelastic[j] = total[j] - elastic[j] - absorption[j];
+    if (inelastic[j] < 0.) inelastic[j] = 0.;
+  }
+}
+
 std::shared_ptr<CrossSection> STNeutron::compute_fission_xs() {
   if (!fissile_) {
-    return std::make_shared<CrossSection>(0., energy_grid_);
+    return detail::make_shared<CrossSection>(memory_, 0., energy_grid_,
+                                             memory_);
   }
 
   if (fission_->has_reaction(18)) {
-    return std::make_shared<CrossSection>(fission_->reaction(18).xs());
+    return detail::make_shared<CrossSection>(memory_,
+                                             fission_->reaction(18).xs());
   }
 
   // Life is difficult. We need to sum the products.
@@ -290,7 +399,8 @@ std::shared_ptr<CrossSection> STNeutron::compute_fission_xs() {
     }
   }
 
-  return std::make_shared<CrossSection>(fiss_xs, energy_grid_, lowest_index);
+  return detail::make_shared<CrossSection>(memory_, fiss_xs, energy_grid_,
+                                           lowest_index, memory_);
 }
 
 }  // namespace pndl
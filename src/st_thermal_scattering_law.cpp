@@ -35,7 +35,9 @@ STThermalScatteringLaw::STThermalScatteringLaw(const ACE& ace,
       has_incoherent_elastic_(false),
       coherent_elastic_(nullptr),
       incoherent_elastic_(nullptr),
-      incoherent_inelastic_(nullptr) {
+      incoherent_inelastic_(nullptr),
+      energy_(),
+      table_() {
   // First try to read Incoherent Inelastic data, as all thermal scattering
   // laws have this
   try {
@@ -82,5 +84,39 @@ STThermalScatteringLaw::STThermalScatteringLaw(const ACE& ace,
     incoherent_elastic_ = std::make_shared<STIncoherentElasticACE>(ace);
     coherent_elastic_ = std::make_shared<STCoherentElastic>(ace);
   }
+
+  tabulate_union_grid();
+}
+
+void STThermalScatteringLaw::tabulate_union_grid() {
+  const auto& inelastic = incoherent_inelastic_->xs();
+  const auto& elastic =
+      static_cast<const STIncoherentElasticACE&>(*incoherent_elastic_).xs();
+  const auto& coherent =
+      static_cast<const STCoherentElastic&>(*coherent_elastic_);
+  const auto& edges = coherent.bragg_edges();
+  const auto& S = coherent.structure_factor_sum();
+
+  energy_.clear();
+  energy_.insert(energy_.end(), inelastic.x().begin(), inelastic.x().end());
+  energy_.insert(energy_.end(), elastic.x().begin(), elastic.x().end());
+  energy_.insert(energy_.end(), edges.begin(), edges.end());
+  std::sort(energy_.begin(), energy_.end());
+  energy_.erase(std::unique(energy_.begin(), energy_.end()), energy_.end());
+
+  table_.assign(3 * energy_.size(), 0.);
+  std::size_t l = 0;
+  for (std::size_t k = 0; k < energy_.size(); k++) {
+    const double E = energy_[k];
+    double* row = table_.data() + 3 * k;
+    row[0] = incoherent_inelastic_->xs(E);
+    row[1] = row[0] + incoherent_elastic_->xs(E);
+
+    // Structure factor sum of the last Bragg edge which is not greater
+    // than E, which applies to all energies above E up to the next point.
+    while (l < edges.size() && edges[l] <= E) l++;
+    row[2] = l > 0 ? S[l - 1] : 0.;
+  }
 }
+
 }  // namespace pndl
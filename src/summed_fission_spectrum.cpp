@@ -31,7 +31,7 @@ SummedFissionSpectrum::SummedFissionSpectrum(std::shared_ptr<STReaction> mt19,
                                              std::shared_ptr<STReaction> mt20,
                                              std::shared_ptr<STReaction> mt21,
                                              std::shared_ptr<STReaction> mt38)
-    : reactions_{mt19, mt20, mt21, mt38} {
+    : reactions_{mt19, mt20, mt21, mt38}, grid_(nullptr), table_() {
   if (mt19 == nullptr) {
     std::string mssg = "Reaction for MT=19 was nullptr.";
     throw PNDLException(mssg);
@@ -45,6 +45,34 @@ SummedFissionSpectrum::SummedFissionSpectrum(std::shared_ptr<STReaction> mt19,
     std::string mssg = "Reaction for MT=38 was nullptr.";
     throw PNDLException(mssg);
   }
+
+  grid_ = &mt19->xs().energy_grid();
+  for (const auto& reaction : reactions_) {
+    if (&reaction->xs().energy_grid() != grid_) {
+      std::string mssg =
+          "Reactions for MT=19, 20, 21, and 38 must share an energy grid.";
+      throw PNDLException(mssg);
+    }
+  }
+
+  // The values at both ends of each interval are found in the same way as
+  // in CrossSection::operator()(E, i), so that the thresholds are treated
+  // identically.
+  const std::size_t NE = grid_->size();
+  table_.assign(8 * NE, 0.);
+  for (std::size_t i = 0; i < NE; i++) {
+    double* row = table_.data() + 8 * i;
+    const double E_low = (*grid_)[i];
+    const double E_hi = i < NE - 1 ? (*grid_)[i + 1] : E_low;
+    double low = 0.;
+    double hi = 0.;
+    for (std::size_t r = 0; r < 4; r++) {
+      low += reactions_[r]->xs()(E_low, i);
+      hi += reactions_[r]->xs()(E_hi, i);
+      row[2 * r] = low;
+      row[2 * r + 1] = i < NE - 1 ? hi - low : 0.;
+    }
+  }
 }
 
 inline void SummedFissionSpectrum::compute_probabilities(
@@ -68,25 +96,43 @@ inline void SummedFissionSpectrum::compute_probabilities(
   probs[3] = xs[3] / xs_tot;
 }
 
-AngleEnergyPacket SummedFissionSpectrum::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
-  // Get probabilities
+std::size_t SummedFissionSpectrum::select_reaction_direct(double E_in,
+                                                          double xi) const {
   std::array<double, 4> probs{0., 0., 0., 0.};
   this->compute_probabilities(probs, E_in);
-  std::array<double, 3> cumul{probs[0], probs[0] + probs[1],
-                              probs[0] + probs[1] + probs[2]};
+  if (xi < probs[0]) return 0;
+  if (xi < probs[0] + probs[1]) return 1;
+  if (xi < probs[0] + probs[1] + probs[2]) return 2;
+  return 3;
+}
 
+template <class RNG>
+AngleEnergyPacket SummedFissionSpectrum::sample_angle_energy_impl(
+    double E_in, RNG& rng) const {
   // Sample the distribution to use
-  const double xi = rng();
-  if (xi < cumul[0]) {
-    return reactions_[0]->neutron_distribution().sample_angle_energy(E_in, rng);
-  } else if (xi < cumul[1]) {
-    return reactions_[1]->neutron_distribution().sample_angle_energy(E_in, rng);
-  } else if (xi < cumul[2]) {
-    return reactions_[2]->neutron_distribution().sample_angle_energy(E_in, rng);
-  } else {
-    return reactions_[3]->neutron_distribution().sample_angle_energy(E_in, rng);
-  }
+  const std::size_t i = grid_->get_lower_index(E_in);
+  const std::size_t r = this->select_reaction(E_in, i, rng());
+  return reactions_[r]->neutron_distribution().sample_angle_energy(E_in, rng);
+}
+
+AngleEnergyPacket SummedFissionSpectrum::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket SummedFissionSpectrum::sample_angle_energy(
+    double E_in, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket SummedFissionSpectrum::sample_angle_energy(
+    double E_in, const EnergyGrid& grid, std::size_t i, RNGStream& rng) const {
+  // The index may only be used with the table if it is for the grid of the
+  // nuclide.
+  const std::size_t j = &grid == grid_ ? i : grid_->get_lower_index(E_in);
+  const std::size_t r = this->select_reaction(E_in, j, rng());
+  return reactions_[r]->neutron_distribution().sample_angle_energy(E_in, grid,
+                                                                   i, rng);
 }
 
 std::optional<double> SummedFissionSpectrum::angle_pdf(double E_in,
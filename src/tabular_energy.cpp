@@ -72,51 +72,6 @@ TabularEnergy::TabularEnergy(const std::vector<double>& incoming_energy,
   }
 }
 
-double TabularEnergy::sample_energy(double E_in,
-                                    const std::function<double()>& rng) const {
-  // Determine the index of the bounding tabulated incoming energies
-  std::size_t l;
-  double f;  // Interpolation factor
-  auto in_E_it =
-      std::lower_bound(incoming_energy_.begin(), incoming_energy_.end(), E_in);
-  if (in_E_it == incoming_energy_.begin()) {
-    l = 0;
-    f = 0.;
-  } else if (in_E_it == incoming_energy_.end()) {
-    l = incoming_energy_.size() - 2;
-    f = 1.;
-  } else {
-    l = static_cast<std::size_t>(
-        std::distance(incoming_energy_.begin(), in_E_it) - 1);
-    f = (E_in - incoming_energy_[l]) /
-        (incoming_energy_[l + 1] - incoming_energy_[l]);
-  }
-  // Determine the index of the bounding tabulated incoming energies
-
-  double E_i_1 = tables_[l].min_value();
-  double E_i_M = tables_[l].max_value();
-  double E_i_1_1 = tables_[l + 1].min_value();
-  double E_i_1_M = tables_[l + 1].max_value();
-  double Emin = E_i_1 + f * (E_i_1_1 - E_i_1);
-  double Emax = E_i_M + f * (E_i_1_M - E_i_M);
-
-  double E_hat = E_in;
-  double E_l_1, E_l_M;
-  if (rng() > f) {
-    E_hat = tables_[l].sample_value(rng());
-    E_l_1 = E_i_1;
-    E_l_M = E_i_M;
-  } else {
-    E_hat = tables_[l + 1].sample_value(rng());
-    E_l_1 = E_i_1_1;
-    E_l_M = E_i_1_M;
-  }
-
-  double E_out = Emin + ((E_hat - E_l_1) / (E_l_M - E_l_1)) * (Emax - Emin);
-
-  return E_out;
-}
-
 std::optional<double> TabularEnergy::pdf(double E_in, double E_out) const {
   // Determine the index of the bounding tabulated incoming energies
   std::size_t l;
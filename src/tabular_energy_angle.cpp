@@ -62,6 +62,8 @@ TabularEnergyAngle::TabularEnergyAngle(const ACE& ace, std::size_t i,
       throw error;
     }
   }
+
+  EnergyAngleTable::pack(tables_);
 }
 
 TabularEnergyAngle::TabularEnergyAngle(
@@ -79,24 +81,24 @@ TabularEnergyAngle::TabularEnergyAngle(
         "there are KalbachTables for the outgoing energy and angle.";
     throw PNDLException(mssg);
   }
+
+  EnergyAngleTable::pack(tables_);
 }
 
-AngleEnergyPacket TabularEnergyAngle::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket TabularEnergyAngle::sample_angle_energy_impl(
+    double E_in, std::size_t indx, RNG& rng) const {
   // Determine the index of the bounding tabulated incoming energies
   std::size_t l;
   double f;  // Interpolation factor
-  auto in_E_it =
-      std::lower_bound(incoming_energy_.begin(), incoming_energy_.end(), E_in);
-  if (in_E_it == incoming_energy_.begin()) {
+  if (indx == 0) {
     l = 0;
     f = 0.;
-  } else if (in_E_it == incoming_energy_.end()) {
+  } else if (indx == incoming_energy_.size()) {
     l = incoming_energy_.size() - 2;
     f = 1.;
   } else {
-    l = static_cast<std::size_t>(
-        std::distance(incoming_energy_.begin(), in_E_it) - 1);
+    l = indx - 1;
     f = (E_in - incoming_energy_[l]) /
         (incoming_energy_[l + 1] - incoming_energy_[l]);
   }
@@ -133,6 +135,24 @@ AngleEnergyPacket TabularEnergyAngle::sample_angle_energy(
   return {mu, E_out};
 }
 
+AngleEnergyPacket TabularEnergyAngle::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(
+      E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+}
+
+AngleEnergyPacket TabularEnergyAngle::sample_angle_energy(
+    double E_in, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(
+      E_in, EnergyGridMap::lower_bound(incoming_energy_, E_in), rng);
+}
+
+AngleEnergyPacket TabularEnergyAngle::sample_angle_energy(
+    double E_in, const EnergyGrid& grid, std::size_t i, RNGStream& rng) const {
+  return this->sample_angle_energy_impl(
+      E_in, grid_map_.lower_bound(incoming_energy_, E_in, grid, i), rng);
+}
+
 std::optional<double> TabularEnergyAngle::angle_pdf(double E_in,
                                                     double mu) const {
   // Determine the index of the bounding tabulated incoming energies
@@ -34,13 +34,33 @@ Uncorrelated::Uncorrelated(const AngleDistribution& angle,
   }
 }
 
-AngleEnergyPacket Uncorrelated::sample_angle_energy(
-    double E_in, const std::function<double()>& rng) const {
+template <class RNG>
+AngleEnergyPacket Uncorrelated::sample_angle_energy_impl(double E_in,
+                                                         RNG& rng) const {
   double mu = angle_.sample_angle(E_in, rng);
   double E_out = energy_->sample_energy(E_in, rng);
   return {mu, E_out};
 }
 
+AngleEnergyPacket Uncorrelated::sample_angle_energy(
+    double E_in, const std::function<double()>& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket Uncorrelated::sample_angle_energy(double E_in,
+                                                    RNGStream& rng) const {
+  return this->sample_angle_energy_impl(E_in, rng);
+}
+
+AngleEnergyPacket Uncorrelated::sample_angle_energy(double E_in,
+                                                    const EnergyGrid& grid,
+                                                    std::size_t i,
+                                                    RNGStream& rng) const {
+  double mu = angle_.sample_angle(E_in, grid, i, rng);
+  double E_out = energy_->sample_energy(E_in, grid, i, rng);
+  return {mu, E_out};
+}
+
 std::optional<double> Uncorrelated::angle_pdf(double E_in, double mu) const {
   return angle_.pdf(E_in, mu);
 }
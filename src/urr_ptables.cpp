@@ -39,7 +39,8 @@ URRPTables::URRPTables(const ACE& ace, const CrossSection& total,
                        const CrossSection& disappearance,
                        const CrossSection& elastic, const CrossSection& capture,
                        const CrossSection& fission, const CrossSection& heating,
-                       const std::vector<STReaction>& reactions)
+                       const std::vector<STReaction>& reactions,
+                       const CrossSection& nu_total)
     : interp_(Interpolation::LinLin),
       factors_(false),
       total_(total),
@@ -48,6 +49,7 @@ URRPTables::URRPTables(const ACE& ace, const CrossSection& total,
       capture_(capture),
       fission_(fission),
       heating_(heating),
+      nu_total_(nu_total),
       inelastic_(nullptr),
       absorption_(nullptr),
       energy_(nullptr),
@@ -23,6 +23,7 @@
 #ifndef PAPILLON_NDL_VECTOR_H
 #define PAPILLON_NDL_VECTOR_H
 
+#include <PapillonNDL/direction.hpp>
 #include <array>
 #include <cmath>
 
@@ -55,36 +56,8 @@ struct Vector {
   double magnitude() const { return std::sqrt(x * x + y * y + z * z); }
 
   Vector rotate(double mu, double phi) const {
-    if (mu < -1.)
-      mu = -1.;
-    else if (mu > 1.)
-      mu = 1.;
-
-    if (phi < 0.)
-      phi = 0.;
-    else if (phi > 2. * PI)
-      phi = 2. * PI;
-
-    double xo, yo, zo;
-    const double c = std::cos(phi);
-    const double s = std::sin(phi);
-    const double C = std::sqrt(1. - mu * mu);
-
-    if (std::abs(1. - z * z) > 1.E-10) {
-      const double denom = std::sqrt(1. - z * z);
-
-      xo = x * mu + C * (c * x * z - s * y) / denom;
-      yo = y * mu + C * (c * y * z + s * x) / denom;
-      zo = z * mu - c * C * denom;
-    } else {
-      const double denom = std::sqrt(1. - y * y);
-
-      xo = x * mu + C * (c * x * y + s * z) / denom;
-      yo = y * mu - c * C * denom;
-      zo = z * mu + C * (c * y * z - s * x) / denom;
-    }
-
-    return {xo, yo, zo};
+    const Direction u = Direction{x, y, z}.rotate(mu, phi);
+    return {u.x, u.y, u.z};
   }
 };
 }  // namespace pndl
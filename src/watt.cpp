@@ -25,10 +25,17 @@
 #include <cmath>
 
 #include "constants.hpp"
+#include "spectrum_table.hpp"
 
 namespace pndl {
 
-Watt::Watt(const ACE& ace, std::size_t i) : a_(), b_(), restriction_energy_() {
+Watt::Watt(const ACE& ace, std::size_t i)
+    : a_(),
+      b_(),
+      compiled_a_(),
+      compiled_b_(),
+      restriction_energy_(),
+      tabulated_(false) {
   std::size_t original_i = i;
   uint32_t NR = ace.xss<uint32_t>(i);
   uint32_t NE = ace.xss<uint32_t>(i + 1 + 2 * NR);
@@ -50,6 +57,7 @@ Watt::Watt(const ACE& ace, std::size_t i) : a_(), b_(), restriction_energy_() {
   // Create Function1D pointer
   try {
     a_ = std::make_shared<Tabulated1D>(NBT_a, INT_a, energy_a, a);
+    compiled_a_ = std::make_shared<CompiledTabulated1D>(*a_);
   } catch (PNDLException& error) {
     std::string mssg =
         "Could not construct Tabulated1D for the 'a'. Index in the XSS block "
@@ -83,6 +91,7 @@ Watt::Watt(const ACE& ace, std::size_t i) : a_(), b_(), restriction_energy_() {
   // Create Function1D pointer
   try {
     b_ = std::make_shared<Tabulated1D>(NBT_b, INT_b, energy_b, b);
+    compiled_b_ = std::make_shared<CompiledTabulated1D>(*b_);
   } catch (PNDLException& error) {
     std::string mssg =
         "Could not construct Tabulated1D for the 'b'. Index in the XSS block "
@@ -99,12 +108,25 @@ Watt::Watt(const ACE& ace, std::size_t i) : a_(), b_(), restriction_energy_() {
 
 Watt::Watt(std::shared_ptr<Tabulated1D> a, std::shared_ptr<Tabulated1D> b,
            double restriction_energy)
-    : a_(a), b_(b), restriction_energy_(restriction_energy) {}
+    : a_(a),
+      b_(b),
+      compiled_a_(std::make_shared<CompiledTabulated1D>(*a_)),
+      compiled_b_(std::make_shared<CompiledTabulated1D>(*b_)),
+      restriction_energy_(restriction_energy),
+      tabulated_(false) {}
+
+void Watt::set_tabulated(bool tabulated) {
+  if (tabulated) detail::maxwellian_spectrum_table();
+  tabulated_ = tabulated;
+}
+
+template <class RNG>
+double Watt::sample_energy_impl(double E_in, RNG& rng) const {
+  double a = (*compiled_a_)(E_in);
+  double b = (*compiled_b_)(E_in);
+
+  if (tabulated_) return this->sample_tabulated(E_in, a, b, rng);
 
-double Watt::sample_energy(double E_in,
-                           const std::function<double()>& rng) const {
-  double a = (*a_)(E_in);
-  double b = (*b_)(E_in);
   double w = 0.;
   double xi1 = 0.;
   double xi2 = 0.;
@@ -130,12 +152,44 @@ double Watt::sample_energy(double E_in,
   return E_out;
 }
 
+template <class RNG>
+double Watt::sample_tabulated(double E_in, double a, double b,
+                              RNG& rng) const {
+  const detail::SpectrumTable& maxwellian = detail::maxwellian_spectrum_table();
+  const double E_max = E_in - restriction_energy_;
+
+  // The Watt spectrum is sampled from a Maxwellian spectrum with temperature
+  // a. The restriction energy can only be applied after the transformation,
+  // so samples above it must still be rejected. Values of w for which all
+  // outgoing energies are above the restriction energy are never sampled.
+  // The probability of these values is only evaluated once.
+  const double sqrt_w_max = std::sqrt(E_max) + 0.5 * a * std::sqrt(b);
+  const double x_max = sqrt_w_max * sqrt_w_max / a;
+  const double P_max = maxwellian.probability(x_max);
+  const double ab = a * a * b;
+
+  while (true) {
+    const double w = a * maxwellian.sample(rng, x_max, P_max);
+    const double E_out = w + 0.25 * ab + (2. * rng() - 1.) * std::sqrt(ab * w);
+    if (E_out >= 0. && E_out <= E_max) return E_out;
+  }
+}
+
+double Watt::sample_energy(double E_in,
+                           const std::function<double()>& rng) const {
+  return this->sample_energy_impl(E_in, rng);
+}
+
+double Watt::sample_energy(double E_in, RNGStream& rng) const {
+  return this->sample_energy_impl(E_in, rng);
+}
+
 std::optional<double> Watt::pdf(double E_in, double E_out) const {
   double du = E_in - restriction_energy_;
   if (E_out < 0. || E_out > du) return 0.;
 
-  double a = (*a_)(E_in);
-  double b = (*b_)(E_in);
+  double a = (*compiled_a_)(E_in);
+  double b = (*compiled_b_)(E_in);
   double I = 0.5 * std::sqrt(PI * a * a * a * b / 4.) * std::exp(a * b / 4.);
   I *= std::erf(std::sqrt(du / a) - std::sqrt(a * b / 4.)) +
        std::erf(std::sqrt(du / a) + std::sqrt(a * b / 4.));
@@ -0,0 +1,383 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/energy_angle_table.hpp>
+#include <PapillonNDL/frame.hpp>
+#include <PapillonNDL/kalbach.hpp>
+#include <PapillonNDL/kalbach_table.hpp>
+#include <PapillonNDL/multiple_distribution.hpp>
+#include <PapillonNDL/nbody.hpp>
+#include <PapillonNDL/pctable.hpp>
+#include <PapillonNDL/reaction.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/summed_fission_spectrum.hpp>
+#include <PapillonNDL/tabular_energy_angle.hpp>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+const std::vector<double> energy{0., 1., 2., 3., 4.};
+const std::vector<double> pdf{0.1, 0.3, 0.3, 0.2, 0.1};
+const std::vector<double> R{0.1, 0.2, 0.3, 0.4, 0.5};
+const std::vector<double> A{1., 1.5, 2., 2.5, 3.};
+
+// Integral of the PDF above over the ith outgoing energy bin
+double bin_integral(std::size_t i, Interpolation interp) {
+  const double dE = energy[i + 1] - energy[i];
+  if (interp == Interpolation::Histogram) return pdf[i] * dE;
+  return 0.5 * (pdf[i] + pdf[i + 1]) * dE;
+}
+
+double norm(Interpolation interp) {
+  double n = 0.;
+  for (std::size_t i = 0; i + 1 < energy.size(); i++)
+    n += bin_integral(i, interp);
+  return n;
+}
+
+std::vector<double> normalized_pdf(Interpolation interp) {
+  std::vector<double> p = pdf;
+  for (auto& v : p) v /= norm(interp);
+  return p;
+}
+
+std::vector<double> normalized_cdf(Interpolation interp) {
+  std::vector<double> c(energy.size(), 0.);
+  for (std::size_t i = 1; i < energy.size(); i++)
+    c[i] = c[i - 1] + bin_integral(i - 1, interp) / norm(interp);
+  c.back() = 1.;
+  return c;
+}
+
+template <class Column>
+void expect_column(const Column& column, const std::vector<double>& values) {
+  ASSERT_EQ(column.size(), values.size());
+  for (std::size_t i = 0; i < values.size(); i++) {
+    EXPECT_EQ(column[i], values[i]);
+  }
+}
+
+//==============================================================================
+// KalbachTable Tests
+TEST(KalbachTable, Views) {
+  const std::vector<double> p = normalized_pdf(Interpolation::LinLin);
+  const std::vector<double> c = normalized_cdf(Interpolation::LinLin);
+  const KalbachTable table(energy, p, c, R, A, Interpolation::LinLin);
+
+  EXPECT_EQ(table.size(), energy.size());
+  expect_column(table.energy(), energy);
+  expect_column(table.pdf(), p);
+  expect_column(table.cdf(), c);
+  expect_column(table.R(), R);
+  expect_column(table.A(), A);
+  EXPECT_EQ(table.min_energy(), 0.);
+  EXPECT_EQ(table.max_energy(), 4.);
+
+  // All values of a point are stored together
+  const auto points = table.points();
+  EXPECT_EQ(points[2].energy, energy[2]);
+  EXPECT_EQ(points[2].pdf, p[2]);
+  EXPECT_EQ(points[2].cdf, c[2]);
+  EXPECT_EQ(points[2].R, R[2]);
+  EXPECT_EQ(points[2].A, A[2]);
+}
+
+TEST(KalbachTable, Sample) {
+  for (const auto interp : {Interpolation::Histogram, Interpolation::LinLin}) {
+    const std::vector<double> p = normalized_pdf(interp);
+    const std::vector<double> c = normalized_cdf(interp);
+    const KalbachTable table(energy, p, c, R, A, interp);
+
+    for (std::size_t i = 0; i < 200; i++) {
+      const double xi = (static_cast<double>(i) + 0.5) / 200.;
+      const KalbachTable::Sample smpl = table.sample(xi);
+      EXPECT_EQ(smpl.energy, table.sample_energy(xi));
+      EXPECT_NEAR(smpl.R, table.R(smpl.energy), 1.E-14);
+      EXPECT_NEAR(smpl.A, table.A(smpl.energy), 1.E-14);
+    }
+  }
+}
+
+//==============================================================================
+// Kalbach Tests
+TEST(Kalbach, SharedArena) {
+  const std::vector<double> p = normalized_pdf(Interpolation::LinLin);
+  const std::vector<double> c = normalized_cdf(Interpolation::LinLin);
+  std::vector<double> E2 = energy;
+  for (auto& E : E2) E *= 2.;
+  const std::vector<KalbachTable> tables{
+      KalbachTable(energy, p, c, R, A, Interpolation::LinLin),
+      KalbachTable(E2, p, c, R, A, Interpolation::LinLin),
+      KalbachTable(energy, p, c, R, A, Interpolation::Histogram)};
+  const Kalbach kalbach({1., 2., 3.}, tables);
+
+  // The tables of the distribution follow one another in a single arena
+  for (std::size_t i = 1; i < kalbach.size(); i++) {
+    EXPECT_EQ(kalbach.table(i).points().data(),
+              kalbach.table(i - 1).points().data() +
+                  kalbach.table(i - 1).size());
+  }
+  expect_column(kalbach.table(1).energy(), E2);
+  EXPECT_EQ(kalbach.table(2).interpolation(), Interpolation::Histogram);
+
+  // The original tables are not modified
+  EXPECT_NE(tables[0].points().data(), kalbach.table(0).points().data());
+  expect_column(tables[1].energy(), E2);
+
+  // Copies share the same arena, and sample identically
+  const Kalbach copy = kalbach;
+  EXPECT_EQ(copy.table(0).points().data(), kalbach.table(0).points().data());
+  RNGStream rng1(23);
+  RNGStream rng2(23);
+  for (std::size_t i = 0; i < 100; i++) {
+    const AngleEnergyPacket a = kalbach.sample_angle_energy(1.5, rng1);
+    const AngleEnergyPacket b = copy.sample_angle_energy(1.5, rng2);
+    EXPECT_EQ(a.cosine_angle, b.cosine_angle);
+    EXPECT_EQ(a.energy, b.energy);
+    EXPECT_GE(a.energy, 0.);
+    EXPECT_LE(a.energy, 6.);
+    EXPECT_LE(std::abs(a.cosine_angle), 1.);
+  }
+}
+
+//==============================================================================
+// TabularEnergyAngle Tests
+TEST(TabularEnergyAngle, SharedArena) {
+  const std::vector<double> p = normalized_pdf(Interpolation::LinLin);
+  const std::vector<double> c = normalized_cdf(Interpolation::LinLin);
+  const PCTable angle({-1., 1.}, {0.5, 0.5}, {0., 1.}, Interpolation::LinLin);
+  const std::vector<PCTable> angles(energy.size(), angle);
+  const std::vector<EnergyAngleTable> tables{
+      EnergyAngleTable(energy, p, c, angles, Interpolation::LinLin),
+      EnergyAngleTable(energy, p, c, angles, Interpolation::Histogram)};
+  const TabularEnergyAngle tab({1., 2.}, tables);
+
+  EXPECT_EQ(tab.table(1).points().data(),
+            tab.table(0).points().data() + tab.table(0).size());
+  expect_column(tab.table(0).energy(), energy);
+  expect_column(tab.table(1).pdf(), p);
+  expect_column(tab.table(1).cdf(), c);
+  EXPECT_EQ(tab.table(1).min_energy(), 0.);
+  EXPECT_EQ(tab.table(1).max_energy(), 4.);
+}
+
+//==============================================================================
+// MultipleDistribution Tests
+
+// Index of the distribution selected by evaluating every probability
+std::size_t reference_selection(const MultipleDistribution& mult, double E_in,
+                                double xi) {
+  double sum = 0.;
+  for (std::size_t d = 0; d + 1 < mult.size(); d++) {
+    sum += mult.probability(d)(E_in);
+    if (xi < sum) return d;
+  }
+  return mult.size() - 1;
+}
+
+void expect_selection(const MultipleDistribution& mult) {
+  for (std::size_t i = 0; i <= 300; i++) {
+    const double E_in = 25. * static_cast<double>(i) / 300. - 1.;
+    for (std::size_t j = 0; j < 50; j++) {
+      const double xi = (static_cast<double>(j) + 0.5) / 50.;
+      EXPECT_EQ(mult.select_distribution(E_in, xi),
+                reference_selection(mult, E_in, xi));
+    }
+  }
+}
+
+TEST(MultipleDistribution, Selection) {
+  auto nbody = std::make_shared<NBody>(3, 2.9991, 1.9968, -2.2246);
+  const std::vector<std::shared_ptr<AngleEnergy>> dists(3, nbody);
+
+  // Probabilities on different grids, with histogram and linear regions
+  auto p1 = std::make_shared<Tabulated1D>(
+      std::vector<uint32_t>{3, 5},
+      std::vector<Interpolation>{Interpolation::Histogram,
+                                 Interpolation::LinLin},
+      std::vector<double>{0.1, 2.05, 6.05, 10.05, 20.},
+      std::vector<double>{0.5, 0.3, 0.1, 0.1, 0.3});
+  auto p2 = std::make_shared<Tabulated1D>(
+      Interpolation::LinLin, std::vector<double>{1.01, 7.01, 7.01, 15.01},
+      std::vector<double>{0.2, 0.4, 0.1, 0.3});
+  auto p3 = std::make_shared<Tabulated1D>(Interpolation::Histogram,
+                                          std::vector<double>{0.1, 20.},
+                                          std::vector<double>{0.4, 0.4});
+  const MultipleDistribution mult(dists, {p1, p2, p3});
+  expect_selection(mult);
+
+  // Probabilities which must be evaluated directly
+  auto p4 = std::make_shared<Tabulated1D>(
+      Interpolation::LogLog, std::vector<double>{0.1, 20.},
+      std::vector<double>{0.3, 0.6});
+  const MultipleDistribution log_mult(dists, {p4, p2, p3});
+  expect_selection(log_mult);
+}
+
+TEST(CMToLab, Transform) {
+  for (const double A : {0.99917, 1.9968, 15.8575, 236.0058}) {
+    const KinematicConstants k(A);
+    RNGStream rng(11);
+
+    std::vector<double> Ein;
+    std::vector<AngleEnergyPacket> cm;
+    for (std::size_t i = 0; i < 200; i++) {
+      const double E = 20. * rng() + 1.E-5;
+      Ein.push_back(E);
+      cm.push_back({2. * rng() - 1., E * rng() + 1.E-6});
+    }
+
+    // The transformation with the constants agrees with the original
+    // formulation in terms of A
+    std::vector<AngleEnergyPacket> lab = cm;
+    for (std::size_t i = 0; i < cm.size(); i++) {
+      const double E = Ein[i];
+      const double mu = cm[i].cosine_angle;
+      const double Eout = cm[i].energy;
+      const double Eout_lab =
+          Eout + (E + 2. * mu * (A + 1.) * std::sqrt(E * Eout)) /
+                     std::pow(A + 1., 2.);
+      const double mu_lab = mu * std::sqrt(Eout / Eout_lab) +
+                            (1. / (A + 1.)) * std::sqrt(E / Eout_lab);
+
+      CMToLab::transform(E, A, lab[i]);
+      EXPECT_NEAR(lab[i].energy, Eout_lab, 1.E-13 * Eout_lab);
+      EXPECT_NEAR(lab[i].cosine_angle, mu_lab, 1.E-13);
+    }
+
+    // Batched transformations are identical to the single transformation
+    std::vector<AngleEnergyPacket> batch = cm;
+    CMToLab::transform(Ein, k, batch);
+    for (std::size_t i = 0; i < cm.size(); i++) {
+      EXPECT_EQ(batch[i].cosine_angle, lab[i].cosine_angle);
+      EXPECT_EQ(batch[i].energy, lab[i].energy);
+    }
+
+    std::vector<AngleEnergyPacket> same = cm;
+    CMToLab::transform(Ein.front(), k, same);
+    AngleEnergyPacket first = cm.back();
+    CMToLab::transform(Ein.front(), k, first);
+    EXPECT_EQ(same.back().cosine_angle, first.cosine_angle);
+    EXPECT_EQ(same.back().energy, first.energy);
+
+    // Transforming back to the CM frame recovers the original values
+    LabToCM::transform(Ein, k, batch);
+    for (std::size_t i = 0; i < cm.size(); i++) {
+      EXPECT_NEAR(batch[i].cosine_angle, cm[i].cosine_angle, 1.E-8);
+      EXPECT_NEAR(batch[i].energy, cm[i].energy, 1.E-8 * cm[i].energy);
+    }
+
+    // Batched Jacobians are identical to the single Jacobians
+    std::vector<double> jac(cm.size(), 0.);
+    CMToLab::angle_jacobian(Ein, k, lab, jac);
+    for (std::size_t i = 0; i < cm.size(); i++) {
+      EXPECT_EQ(jac[i], CMToLab::angle_jacobian(Ein[i], A, lab[i]));
+    }
+
+    std::vector<double> Eout, Eout_cm;
+    for (std::size_t i = 0; i < cm.size(); i++) {
+      Eout.push_back(lab[i].energy);
+      Eout_cm.push_back(cm[i].energy);
+    }
+    CMToLab::jacobian(Eout, Eout_cm, jac);
+    for (std::size_t i = 0; i < cm.size(); i++) {
+      EXPECT_EQ(jac[i], CMToLab::jacobian(Eout[i], Eout_cm[i]));
+    }
+  }
+}
+
+TEST(CMToLab, BatchSizes) {
+  const KinematicConstants k(15.8575);
+  const std::vector<double> Ein(10, 1.);
+  std::vector<AngleEnergyPacket> ae(9, {0.5, 0.5});
+  std::vector<double> jac(10, 0.);
+
+  EXPECT_THROW(CMToLab::transform(Ein, k, ae), PNDLException);
+  EXPECT_THROW(LabToCM::transform(Ein, k, ae), PNDLException);
+  EXPECT_THROW(CMToLab::angle_jacobian(Ein, k, ae, jac), PNDLException);
+  EXPECT_THROW(CMToLab::jacobian(Ein, std::span(Ein).first(9), jac),
+               PNDLException);
+
+  ae.push_back({0.5, 0.5});
+  EXPECT_NO_THROW(CMToLab::angle_jacobian(Ein, k, ae, jac));
+  EXPECT_THROW(
+      CMToLab::angle_jacobian(Ein, k, ae, std::span(jac).first(9)),
+      PNDLException);
+}
+
+TEST(SummedFissionSpectrum, Selection) {
+  std::vector<double> energy;
+  for (std::size_t i = 0; i < 200; i++) {
+    energy.push_back(1.E-11 * std::pow(2.E12, static_cast<double>(i) / 199.));
+  }
+  auto grid = std::make_shared<EnergyGrid>(energy);
+
+  // Second, third, and fourth chance fission have thresholds inside of the
+  // grid. The cross sections at the thresholds are not zero, so that the
+  // treatment of the interval below each threshold is tested.
+  auto reaction = [&](uint32_t mt, std::size_t index, double scale) {
+    std::vector<double> xs;
+    for (std::size_t i = index; i < energy.size(); i++) {
+      xs.push_back(scale * (1. + 0.5 * std::sin(static_cast<double>(i))));
+    }
+    return std::make_shared<STReaction>(
+        CrossSection(xs, grid, index), mt, 180., 233.025, energy[index],
+        nullptr, std::make_shared<NBody>(3, 1., 233.025, -2. * mt));
+  };
+  const std::array<std::shared_ptr<STReaction>, 4> reactions{
+      reaction(19, 0, 1.), reaction(20, 150, 0.3), reaction(21, 170, 0.2),
+      reaction(38, 185, 0.1)};
+  const SummedFissionSpectrum spectrum(reactions[0], reactions[1],
+                                       reactions[2], reactions[3]);
+
+  // The selection agrees with the ratios of the partial cross sections,
+  // except for random numbers which are on a boundary to within round off.
+  RNGStream rng(23);
+  for (std::size_t n = 0; n < 5000; n++) {
+    const double E = 1.E-11 * std::pow(2.1E12, rng());
+    const std::size_t i = grid->get_lower_index(E);
+    const double xi = rng();
+
+    std::array<double, 4> cumul{0., 0., 0., 0.};
+    double sum = 0.;
+    for (std::size_t r = 0; r < 4; r++) {
+      sum += reactions[r]->xs()(E, i);
+      cumul[r] = sum;
+    }
+    std::size_t expected = 3;
+    bool boundary = false;
+    for (std::size_t r = 0; r < 4; r++) {
+      boundary |= std::abs(xi * sum - cumul[r]) < 1.E-10 * sum;
+    }
+    for (std::size_t r = 0; r < 3; r++) {
+      if (xi * sum < cumul[r]) {
+        expected = r;
+        break;
+      }
+    }
+
+    const std::size_t r = spectrum.select_reaction(E, i, xi);
+    if (!boundary) EXPECT_EQ(r, expected);
+    if (E < energy[150]) EXPECT_EQ(r, 0);
+  }
+
+  // Sampling with the grid index gives exactly the same result as without
+  for (const double E : {1.E-6, 1., 3., 10., 15., 19.9, 25.}) {
+    const std::size_t i = grid->get_lower_index(E);
+    RNGStream rng1(31);
+    RNGStream rng2(31);
+    for (std::size_t n = 0; n < 100; n++) {
+      const AngleEnergyPacket a = spectrum.sample_angle_energy(E, rng1);
+      const AngleEnergyPacket b =
+          spectrum.sample_angle_energy(E, *grid, i, rng2);
+      EXPECT_EQ(a.cosine_angle, b.cosine_angle);
+      EXPECT_EQ(a.energy, b.energy);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace pndl
@@ -3,6 +3,10 @@
 #include <PapillonNDL/angle_table.hpp>
 #include <PapillonNDL/equiprobable_angle_bins.hpp>
 #include <PapillonNDL/isotropic.hpp>
+#include <PapillonNDL/legendre.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <cmath>
+#include <functional>
 #include <vector>
 
 namespace pndl {
@@ -24,6 +28,19 @@ TEST(Isotropic, SampleMu) {
   EXPECT_DOUBLE_EQ(iso.sample_mu(rng), 1.);
 }
 
+TEST(Isotropic, SampleMuStream) {
+  Isotropic iso;
+
+  RNGStream stream(17);
+  RNGStream func_stream(17);
+  const std::function<double()> rng = std::ref(func_stream);
+
+  for (std::size_t i = 0; i < 100; i++) {
+    EXPECT_EQ(iso.sample_mu(stream), iso.sample_mu(rng));
+  }
+  EXPECT_EQ(stream.state(), func_stream.state());
+}
+
 TEST(Isotropic, PDF) {
   Isotropic iso;
 
@@ -139,6 +156,22 @@ TEST(AngleTable, SampleMu) {
   EXPECT_DOUBLE_EQ(tab.sample_mu(rng), 1.);
 }
 
+TEST(AngleTable, SampleMuStream) {
+  std::vector<double> vals{-1., 0., 1.};
+  std::vector<double> pdf{0.25, 0.5, 0.75};
+  std::vector<double> cdf{0., 0.375, 1.};
+  AngleTable tab(vals, pdf, cdf, Interpolation::LinLin);
+
+  RNGStream stream(17);
+  RNGStream func_stream(17);
+  const std::function<double()> rng = std::ref(func_stream);
+
+  for (std::size_t i = 0; i < 100; i++) {
+    EXPECT_EQ(tab.sample_mu(stream), tab.sample_mu(rng));
+  }
+  EXPECT_EQ(stream.state(), func_stream.state());
+}
+
 TEST(AngleTable, PDF) {
   std::vector<double> vals{-1., 0., 1.};
   std::vector<double> pdf{0.5, 0.5, 0.5};
@@ -218,5 +251,119 @@ TEST(AngleTable, Interpolation) {
   EXPECT_EQ(Interpolation::Histogram, hist.interpolation());
 }
 
+//==============================================================================
+// Legendre Tests
+
+// Moments of a truncated Henyey-Greenstein distribution, which is strongly
+// forward peaked, and positive over [-1,1].
+std::vector<double> forward_peaked_moments() {
+  constexpr double g = 0.5;
+  constexpr std::size_t L = 20;
+  std::vector<double> a(L, 0.);
+  for (std::size_t l = 0; l < L; l++) a[l] = std::pow(g, l + 1);
+  return a;
+}
+
+// Reference evaluation of a Legendre series, which evaluates each polynomial
+// independently.
+double legendre_series(const std::vector<double>& a, double mu) {
+  double pdf = 0.5;
+  for (unsigned l = 1; l <= a.size(); l++) {
+    pdf += 0.5 * (2. * l + 1.) * a[l - 1] * std::legendre(l, mu);
+  }
+  return pdf;
+}
+
+// Exact integral of a Legendre series over [-1,mu].
+double legendre_cdf(const std::vector<double>& a, double mu) {
+  double cdf = 0.5 * (mu + 1.);
+  for (unsigned l = 1; l <= a.size(); l++) {
+    cdf += 0.5 * a[l - 1] *
+           (std::legendre(l + 1, mu) - std::legendre(l - 1, mu));
+  }
+  return cdf;
+}
+
+TEST(Legendre, Construction) {
+  EXPECT_THROW(Legendre(std::vector<double>{1.}), PNDLException);
+  EXPECT_NO_THROW(Legendre(std::vector<double>{0.2, 0.1}));
+
+  Legendre leg;
+  EXPECT_THROW(leg.set_moment(0, 1.), PNDLException);
+  EXPECT_THROW(leg.set_moment(1, 1.), PNDLException);
+}
+
+TEST(Legendre, PDF) {
+  const std::vector<double> a = forward_peaked_moments();
+  Legendre leg(a);
+
+  for (std::size_t i = 0; i <= 200; i++) {
+    const double mu = -1. + 0.01 * static_cast<double>(i);
+    const double ref = legendre_series(a, mu);
+    EXPECT_NEAR(leg.pdf(mu), ref, 1.E-12 * std::abs(ref));
+  }
+
+  Legendre iso;
+  EXPECT_DOUBLE_EQ(iso.pdf(-1.), 0.5);
+  EXPECT_DOUBLE_EQ(iso.pdf(0.), 0.5);
+  EXPECT_DOUBLE_EQ(iso.pdf(1.), 0.5);
+}
+
+TEST(Legendre, SampleMu) {
+  // Chi-squared test of the sampled cosines, against the exact probability of
+  // each cosine bin.
+  const std::vector<double> a = forward_peaked_moments();
+  Legendre leg(a);
+
+  constexpr std::size_t NBINS = 40;
+  constexpr std::size_t NSAMPLES = 200000;
+  std::vector<double> counts(NBINS, 0.);
+  std::vector<double> moments(a.size(), 0.);
+  RNGStream rng(23);
+  for (std::size_t i = 0; i < NSAMPLES; i++) {
+    const double mu = leg.sample_mu(rng);
+    ASSERT_GE(mu, -1.);
+    ASSERT_LE(mu, 1.);
+    std::size_t b = static_cast<std::size_t>(0.5 * (mu + 1.) * NBINS);
+    if (b == NBINS) b--;
+    counts[b] += 1.;
+    for (unsigned l = 1; l <= a.size(); l++) {
+      moments[l - 1] += std::legendre(l, mu);
+    }
+  }
+
+  double chi_sqrd = 0.;
+  for (std::size_t b = 0; b < NBINS; b++) {
+    const double mu_low = -1. + 2. * static_cast<double>(b) / NBINS;
+    const double mu_hi = -1. + 2. * static_cast<double>(b + 1) / NBINS;
+    const double expected =
+        NSAMPLES * (legendre_cdf(a, mu_hi) - legendre_cdf(a, mu_low));
+    chi_sqrd += (counts[b] - expected) * (counts[b] - expected) / expected;
+  }
+
+  // 99.9th percentile of the chi-squared distribution with 39 degrees of
+  // freedom.
+  EXPECT_LT(chi_sqrd, 72.1);
+
+  // The mean of P_l(mu) is the lth moment. The variance of P_l(mu) is at
+  // most 1, so the moments must agree within a few standard deviations.
+  for (std::size_t l = 0; l < a.size(); l++) {
+    EXPECT_NEAR(moments[l] / NSAMPLES, a[l], 5. / std::sqrt(NSAMPLES));
+  }
+}
+
+TEST(Legendre, SampleMuStream) {
+  Legendre leg(forward_peaked_moments());
+
+  RNGStream stream(17);
+  RNGStream func_stream(17);
+  const std::function<double()> rng = std::ref(func_stream);
+
+  for (std::size_t i = 0; i < 100; i++) {
+    EXPECT_EQ(leg.sample_mu(stream), leg.sample_mu(rng));
+  }
+  EXPECT_EQ(stream.state(), func_stream.state());
+}
+
 }  // namespace
 }  // namespace pndl
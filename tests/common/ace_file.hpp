@@ -0,0 +1,64 @@
+#ifndef PAPILLON_NDL_TESTS_ACE_FILE_H
+#define PAPILLON_NDL_TESTS_ACE_FILE_H
+
+#include <PapillonNDL/ace.hpp>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace pndl {
+namespace synthetic {
+
+//==============================================================================
+// No ACE files are distributed with the library, so the tests and benchmarks
+// build synthetic evaluations in memory. They are written to a temporary
+// ASCII ACE file with a unique name, which is removed once it has been read.
+inline ACE make_ace(const std::string& zaid_line, const std::string& comment,
+                    const std::string& mat,
+                    const std::array<int32_t, 16>& nxs,
+                    const std::array<int32_t, 32>& jxs,
+                    const std::vector<double>& xss) {
+  std::random_device rd;
+  std::ostringstream name;
+  name << "pndl_" << std::hex << rd() << rd() << ".ace";
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / name.str();
+
+  {
+    std::ofstream file(path);
+    file << zaid_line << "\n";
+    file << std::left << std::setw(70) << comment << std::setw(10) << mat
+         << "\n";
+    for (std::size_t i = 0; i < 16; i++) file << "0 0. ";
+    file << "\n";
+    for (const auto n : nxs) file << n << " ";
+    file << "\n";
+    for (const auto j : jxs) file << j << " ";
+    file << "\n";
+    file << std::scientific << std::setprecision(14);
+    for (std::size_t i = 0; i < xss.size(); i++) {
+      file << xss[i] << ((i % 4 == 3) ? "\n" : " ");
+    }
+    file << "\n";
+  }
+
+  try {
+    ACE ace(path.string());
+    std::filesystem::remove(path);
+    return ace;
+  } catch (...) {
+    std::filesystem::remove(path);
+    throw;
+  }
+}
+
+}  // namespace synthetic
+}  // namespace pndl
+
+#endif
@@ -0,0 +1,196 @@
+#ifndef PAPILLON_NDL_TESTS_FISSILE_ACE_H
+#define PAPILLON_NDL_TESTS_FISSILE_ACE_H
+
+#include <PapillonNDL/ace.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "ace_file.hpp"
+
+namespace pndl {
+namespace synthetic {
+
+//==============================================================================
+// A synthetic fissile nuclide. It has an energy grid of NES points, with
+// fission (MT 18) and radiative capture (MT 102) cross sections, tabulated
+// prompt and delayed nu, and six delayed families. The family probabilities
+// are PROBABILITY at 1.E-11 MeV, the reverse of PROBABILITY scaled by 1.6 at
+// 1 MeV, and 0.08 for all families at 20 MeV, so that they only sum to one
+// at the lowest energy. The first family has an additional point at 5 MeV.
+// The prompt and delayed spectra are Maxwellians. Probability tables of
+// cross section factors are given between 1 keV and 100 keV.
+inline constexpr std::array<double, 6> DECAY{0.0133, 0.0327, 0.121,
+                                             0.303,  0.850,  2.86};
+inline constexpr std::array<double, 6> PROBABILITY{0.035, 0.180, 0.172,
+                                                   0.387, 0.159, 0.067};
+
+// Interpolation of the delayed family probabilities, or no delayed data
+enum class Families { LinLin, Histogram, None };
+
+// Logarithmically spaced energies from 1.E-11 to 20 MeV
+inline std::vector<double> log_grid(std::size_t N) {
+  std::vector<double> E(N, 0.);
+  for (std::size_t i = 0; i < N; i++) {
+    const double f = static_cast<double>(i) / static_cast<double>(N - 1);
+    E[i] = 1.E-11 * std::pow(2.E12, f);
+  }
+  E.back() = 20.;
+  return E;
+}
+
+inline double fission_xs(double E) { return 1. + 1.E-3 / std::sqrt(E); }
+inline double capture_xs(double E) { return 0.1 + 2.E-4 / std::sqrt(E); }
+inline double elastic_xs(double E) { return 4. + 0.1 * std::log(E + 1.); }
+
+// Appends a single law block, with a probability of one at all energies.
+// The law data is assumed to follow immediately after the block.
+inline void law_block(std::vector<double>& xss, std::size_t start, int law) {
+  xss.push_back(0.);
+  xss.push_back(static_cast<double>(law));
+  xss.push_back(static_cast<double>(xss.size() - start + 8));
+  for (const double v : {0., 2., 1.E-11, 20., 1., 1.}) xss.push_back(v);
+}
+
+// Appends a Maxwellian with a temperature which increases with the incident
+// energy.
+inline void maxwellian(std::vector<double>& xss, std::size_t NE, double T) {
+  const std::vector<double> E = log_grid(NE);
+  xss.push_back(0.);
+  xss.push_back(static_cast<double>(NE));
+  for (const double e : E) xss.push_back(e);
+  for (const double e : E) xss.push_back(T * (1. + 0.02 * e));
+  xss.push_back(-20.);
+}
+
+// Appends a tabulated nu, with LNU = 2
+inline void tabular_nu(std::vector<double>& xss, std::size_t NE, double nu0,
+                       double slope) {
+  const std::vector<double> E = log_grid(NE);
+  xss.push_back(2.);
+  xss.push_back(0.);
+  xss.push_back(static_cast<double>(NE));
+  for (const double e : E) xss.push_back(e);
+  for (const double e : E) xss.push_back(nu0 + slope * e);
+}
+
+inline ACE fissile_ace(std::size_t NES,
+                       Families families = Families::LinLin) {
+  std::array<int32_t, 16> nxs{};
+  std::array<int32_t, 32> jxs{};
+  std::vector<double> xss;
+
+  // Energy grid, followed by the total, disappearance, and elastic cross
+  // sections, and the heating numbers
+  const std::vector<double> energy = log_grid(NES);
+  jxs[0] = static_cast<int32_t>(xss.size() + 1);
+  for (const double e : energy) xss.push_back(e);
+  for (const double e : energy)
+    xss.push_back(elastic_xs(e) + fission_xs(e) + capture_xs(e) + 0.5);
+  for (const double e : energy) xss.push_back(capture_xs(e));
+  for (const double e : energy) xss.push_back(elastic_xs(e));
+  for (const double e : energy) xss.push_back(2. + e);
+
+  // Prompt nu
+  jxs[1] = static_cast<int32_t>(xss.size() + 1);
+  tabular_nu(xss, 80, 2.41, 0.13);
+
+  // Reaction data for MT 18 and MT 102. Only fission emits neutrons.
+  jxs[2] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(18.);
+  xss.push_back(102.);
+  jxs[3] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(180.);
+  xss.push_back(6.5);
+  jxs[4] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(19.);
+  xss.push_back(0.);
+  jxs[5] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(1.);
+  xss.push_back(static_cast<double>(NES + 3));
+  jxs[6] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(1.);
+  xss.push_back(static_cast<double>(NES));
+  for (const double e : energy) xss.push_back(fission_xs(e));
+  xss.push_back(1.);
+  xss.push_back(static_cast<double>(NES));
+  for (const double e : energy) xss.push_back(capture_xs(e));
+
+  // Isotropic angular distributions for elastic and MT 18
+  jxs[7] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(0.);
+  xss.push_back(0.);
+  jxs[8] = static_cast<int32_t>(xss.size() + 1);
+
+  // Prompt spectrum
+  jxs[9] = static_cast<int32_t>(xss.size() + 1);
+  xss.push_back(1.);
+  jxs[10] = static_cast<int32_t>(xss.size() + 1);
+  law_block(xss, xss.size(), 7);
+  maxwellian(xss, 20, 1.3);
+
+  // URR probability tables, with two bands of factors at each energy
+  jxs[22] = static_cast<int32_t>(xss.size() + 1);
+  for (const double v : {3., 2., 2., 0., 0., 1., 1.E-3, 1.E-2, 0.1})
+    xss.push_back(v);
+  for (std::size_t ie = 0; ie < 3; ie++) {
+    for (const double v : {0.4, 1.}) xss.push_back(v);
+    for (const double v : {1., 1.}) xss.push_back(v);
+    for (const double v : {0.9, 1.1}) xss.push_back(v);
+    for (const double v : {0.8, 1.3}) xss.push_back(v);
+    for (const double v : {0.7, 1.45}) xss.push_back(v);
+    for (const double v : {1., 1.}) xss.push_back(v);
+  }
+
+  if (families != Families::None) {
+    // Delayed nu
+    jxs[23] = static_cast<int32_t>(xss.size() + 1);
+    tabular_nu(xss, 3, 0.0167, -0.0003);
+
+    // Delayed family decay constants (in inverse shakes) and probabilities
+    const double INT = families == Families::Histogram ? 1. : 2.;
+    jxs[24] = static_cast<int32_t>(xss.size() + 1);
+    for (std::size_t g = 0; g < DECAY.size(); g++) {
+      std::vector<double> E{1.E-11, 1., 20.};
+      std::vector<double> P{PROBABILITY[g],
+                            1.6 * PROBABILITY[DECAY.size() - 1 - g], 0.08};
+      if (g == 0) {
+        E.insert(E.begin() + 2, 5.);
+        P.insert(P.begin() + 2, P[1] + (P[2] - P[1]) * 4. / 19.);
+      }
+      const double NE = static_cast<double>(E.size());
+      for (const double v : {DECAY[g] * 1.E-8, 1., NE, INT, NE})
+        xss.push_back(v);
+      xss.insert(xss.end(), E.begin(), E.end());
+      xss.insert(xss.end(), P.begin(), P.end());
+    }
+
+    // Delayed family spectra
+    jxs[25] = static_cast<int32_t>(xss.size() + 1);
+    xss.resize(xss.size() + DECAY.size(), 0.);
+    jxs[26] = static_cast<int32_t>(xss.size() + 1);
+    const std::size_t DNED = xss.size();
+    for (std::size_t g = 0; g < DECAY.size(); g++) {
+      xss[DNED - DECAY.size() + g] =
+          static_cast<double>(xss.size() - DNED + 1);
+      law_block(xss, DNED, 7);
+      maxwellian(xss, 2, 0.3 + 0.05 * static_cast<double>(g));
+    }
+  }
+
+  nxs[0] = static_cast<int32_t>(xss.size());
+  nxs[1] = 92235;
+  nxs[2] = static_cast<int32_t>(NES);
+  nxs[3] = 2;
+  nxs[4] = 1;
+  nxs[7] = families == Families::None ? 0 : static_cast<int32_t>(DECAY.size());
+
+  return make_ace(" 92235.80c  233.024800  2.5301E-08 01/01/2023",
+                  "synthetic fissile nuclide", "   mat9228", nxs, jxs, xss);
+}
+
+}  // namespace synthetic
+}  // namespace pndl
+
+#endif
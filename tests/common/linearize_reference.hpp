@@ -0,0 +1,45 @@
+#ifndef PAPILLON_NDL_TESTS_LINEARIZE_REFERENCE_H
+#define PAPILLON_NDL_TESTS_LINEARIZE_REFERENCE_H
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace pndl {
+namespace synthetic {
+
+//==============================================================================
+// The original linearization, which inserts each mid-point in place. The
+// linearize function must give the same points, with the same calls to f.
+inline void linearize_reference(std::vector<double>& x, std::vector<double>& y,
+                                const std::function<double(double)>& f,
+                                double tolerance) {
+  std::size_t i = 0;
+  while (i + 1 < x.size()) {
+    if (std::nextafter(x[i], x[i + 1]) == x[i + 1]) {
+      i++;
+      continue;
+    }
+    const double x_mid = 0.5 * (x[i] + x[i + 1]);
+    const double f_real = f(x_mid);
+    if (std::abs((0.5 * (y[i] + y[i + 1]) - f_real) / f_real) > tolerance) {
+      x.insert(x.begin() + static_cast<std::ptrdiff_t>(i) + 1, x_mid);
+      y.insert(y.begin() + static_cast<std::ptrdiff_t>(i) + 1, f_real);
+    } else {
+      i++;
+    }
+  }
+}
+
+// Maxwellian spectrum with a temperature of 1.3 MeV
+inline double maxwellian(double E) {
+  constexpr double T = 1.3;
+  return 2. * std::sqrt(E / 3.14159265358979323846) * std::exp(-E / T) /
+         std::pow(T, 1.5);
+}
+
+}  // namespace synthetic
+}  // namespace pndl
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef PAPILLON_NDL_TESTS_TSL_ACE_H
+#define PAPILLON_NDL_TESTS_TSL_ACE_H
+
+#include <PapillonNDL/ace.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "ace_file.hpp"
+
+namespace pndl {
+namespace synthetic {
+
+//==============================================================================
+// A synthetic thermal scattering law. The incoherent inelastic data has Ne
+// incident energies, each with Noe outgoing energies and Nmu discrete
+// cosines, given either as discrete energies or as a continuous spectrum.
+// The incoherent file also has incoherent elastic scattering, on a grid
+// which is offset from the inelastic one. The coherent file instead has
+// NBRAGG Bragg edges. The values are not physical.
+struct SyntheticTSL {
+  std::size_t Ne;
+  std::size_t Noe;
+  std::size_t Nmu;
+  std::size_t NBRAGG;
+
+  // Incident energies are logarithmically spaced from 1.E-11 to 4.E-6 MeV
+  double incident_energy(std::size_t ie) const {
+    const double du = std::log(4.E-6 / 1.E-11) / static_cast<double>(Ne - 1);
+    return 1.E-11 * std::exp(du * static_cast<double>(ie));
+  }
+
+  // Incoherent elastic energies fall between the inelastic ones
+  double elastic_energy(std::size_t ie) const {
+    return std::sqrt(incident_energy(ie) * incident_energy(ie + 1));
+  }
+
+  static double inelastic_xs(double E) {
+    return 20. + 3. * std::log10(E / 1.E-11);
+  }
+
+  static double elastic_xs(double E) { return 5. / (1. + 1.E7 * E); }
+
+  // Bragg edges from 2.E-9 to 4.E-6 MeV, which become denser with energy
+  double bragg_edge(std::size_t b) const {
+    const double x = static_cast<double>(b) / static_cast<double>(NBRAGG - 1);
+    return 2.E-9 + (4.E-6 - 2.E-9) * std::pow(x, 2. / 3.);
+  }
+
+  // Equally spaced cosines, which narrow as the outgoing energy increases
+  std::vector<double> cosines(std::size_t ie, std::size_t oe) const {
+    std::vector<double> mu(Nmu, 0.);
+    const double width = 1. - 0.5 * static_cast<double>(oe + ie % 3) /
+                                  static_cast<double>(Noe + 3);
+    for (std::size_t m = 0; m < Nmu; m++) {
+      mu[m] = width * (-1. + (2. * static_cast<double>(m) + 1.) /
+                                 static_cast<double>(Nmu));
+    }
+    return mu;
+  }
+
+  ACE ace(bool continuous, bool coherent) const {
+    std::array<int32_t, 16> nxs{};
+    std::array<int32_t, 32> jxs{};
+    std::vector<double> xss;
+
+    // Incoherent inelastic cross section
+    jxs[0] = static_cast<int32_t>(xss.size() + 1);
+    xss.push_back(static_cast<double>(Ne));
+    for (std::size_t ie = 0; ie < Ne; ie++) xss.push_back(incident_energy(ie));
+    for (std::size_t ie = 0; ie < Ne; ie++)
+      xss.push_back(inelastic_xs(incident_energy(ie)));
+
+    // Incoherent inelastic secondary distribution
+    jxs[2] = static_cast<int32_t>(xss.size() + 1);
+    if (continuous) {
+      nxs[2] = static_cast<int32_t>(Nmu + 1);
+      nxs[6] = 2;
+
+      // Locators, followed by the number of outgoing energies
+      const std::size_t loc_start = xss.size();
+      xss.resize(xss.size() + 2 * Ne, 0.);
+      for (std::size_t ie = 0; ie < Ne; ie++) {
+        xss[loc_start + ie] = static_cast<double>(xss.size());
+        xss[loc_start + Ne + ie] = static_cast<double>(Noe);
+
+        // The spectrum is a linear pdf, p(E) = 2 E / E_max^2
+        const double E_max = 2. * incident_energy(ie) + 1.E-7;
+        for (std::size_t oe = 0; oe < Noe; oe++) {
+          const double x =
+              static_cast<double>(oe) / static_cast<double>(Noe - 1);
+          xss.push_back(x * E_max);
+          xss.push_back(2. * x / E_max);
+          xss.push_back(x * x);
+          for (const double mu : cosines(ie, oe)) xss.push_back(mu);
+        }
+      }
+    } else {
+      nxs[2] = static_cast<int32_t>(Nmu - 1);
+      nxs[3] = static_cast<int32_t>(Noe);
+      nxs[6] = 0;
+      for (std::size_t ie = 0; ie < Ne; ie++) {
+        for (std::size_t oe = 0; oe < Noe; oe++) {
+          xss.push_back(incident_energy(ie) * static_cast<double>(oe + 1) /
+                        static_cast<double>(Noe));
+          for (const double mu : cosines(ie, oe)) xss.push_back(mu);
+        }
+      }
+    }
+
+    if (coherent) {
+      // Bragg edges and cumulative structure factors
+      nxs[4] = 4;
+      jxs[3] = static_cast<int32_t>(xss.size() + 1);
+      xss.push_back(static_cast<double>(NBRAGG));
+      for (std::size_t b = 0; b < NBRAGG; b++) xss.push_back(bragg_edge(b));
+      double S = 0.;
+      for (std::size_t b = 0; b < NBRAGG; b++) {
+        S += 1.E-9 * (1. + static_cast<double>(b % 7));
+        xss.push_back(S);
+      }
+    } else {
+      // Incoherent elastic cross section and cosines
+      nxs[4] = 3;
+      nxs[5] = static_cast<int32_t>(Nmu - 1);
+      jxs[3] = static_cast<int32_t>(xss.size() + 1);
+      xss.push_back(static_cast<double>(Ne - 1));
+      for (std::size_t ie = 0; ie + 1 < Ne; ie++)
+        xss.push_back(elastic_energy(ie));
+      for (std::size_t ie = 0; ie + 1 < Ne; ie++)
+        xss.push_back(elastic_xs(elastic_energy(ie)));
+      jxs[5] = static_cast<int32_t>(xss.size() + 1);
+      for (std::size_t ie = 0; ie + 1 < Ne; ie++)
+        for (const double mu : cosines(ie, 0)) xss.push_back(mu);
+    }
+
+    nxs[0] = static_cast<int32_t>(xss.size());
+    nxs[1] = 1001;
+
+    return make_ace("  lwtr.20t    18.0000  2.5301E-08 01/01/2023",
+                    "synthetic thermal scattering law", "   mat1001", nxs,
+                    jxs, xss);
+  }
+};
+
+}  // namespace synthetic
+}  // namespace pndl
+
+#endif
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/angle_distribution.hpp>
+#include <PapillonNDL/angle_table.hpp>
+#include <PapillonNDL/cm_distribution.hpp>
+#include <PapillonNDL/compiled_angle_energy.hpp>
+#include <PapillonNDL/compiled_angle_law.hpp>
+#include <PapillonNDL/compiled_energy_law.hpp>
+#include <PapillonNDL/evaporation.hpp>
+#include <PapillonNDL/isotropic.hpp>
+#include <PapillonNDL/legendre.hpp>
+#include <PapillonNDL/level_inelastic_scatter.hpp>
+#include <PapillonNDL/maxwellian.hpp>
+#include <PapillonNDL/multiple_distribution.hpp>
+#include <PapillonNDL/nbody.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/tabulated_1d.hpp>
+#include <PapillonNDL/uncorrelated.hpp>
+#include <PapillonNDL/watt.hpp>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+// An angle law which is not known to CompiledAngleLaw
+class ForwardPeaked : public AngleLaw {
+ public:
+  double sample_mu(const std::function<double()>& rng) const override final {
+    return std::sqrt(rng()) * 2. - 1.;
+  }
+
+  double pdf(double mu) const override final { return 0.5 * (mu + 1.); }
+};
+
+std::shared_ptr<Tabulated1D> constant_function(double value) {
+  return std::make_shared<Tabulated1D>(Interpolation::LinLin,
+                                       std::vector<double>{1.E-11, 20.},
+                                       std::vector<double>{value, value});
+}
+
+std::shared_ptr<Tabulated1D> linear_function(double y1, double y2) {
+  return std::make_shared<Tabulated1D>(Interpolation::LinLin,
+                                       std::vector<double>{1.E-11, 20.},
+                                       std::vector<double>{y1, y2});
+}
+
+// Neutron distribution of an inelastic reaction with two laws in the center
+// of mass frame, as it would be built by ReactionBase.
+std::shared_ptr<AngleEnergy> inelastic_distribution() {
+  AngleDistribution angle(
+      {1.E-11, 5., 20.},
+      {std::make_shared<Isotropic>(),
+       std::make_shared<Legendre>(std::vector<double>{0.2, 0.05}),
+       std::make_shared<Legendre>(std::vector<double>{0.5, 0.2})});
+  auto watt = std::make_shared<Watt>(constant_function(0.988),
+                                     constant_function(2.249), -20.);
+  auto uncorr = std::make_shared<Uncorrelated>(angle, watt);
+  auto nbody = std::make_shared<NBody>(3, 2.9991, 1.9968, -2.2246);
+
+  auto mult = std::make_shared<MultipleDistribution>(
+      std::vector<std::shared_ptr<AngleEnergy>>{uncorr, nbody},
+      std::vector<std::shared_ptr<Tabulated1D>>{linear_function(0.8, 0.3),
+                                                linear_function(0.2, 0.7)});
+
+  return std::make_shared<CMDistribution>(1.9968, -2.2246, mult);
+}
+
+//==============================================================================
+// CompiledAngleLaw Tests
+TEST(CompiledAngleLaw, MatchesAngleLaw) {
+  std::vector<std::shared_ptr<AngleLaw>> laws{
+      std::make_shared<Isotropic>(),
+      std::make_shared<Legendre>(std::vector<double>{0.3, 0.1}),
+      std::make_shared<AngleTable>(Legendre(std::vector<double>{0.3, 0.1})),
+      std::make_shared<ForwardPeaked>()};
+
+  for (const auto& law : laws) {
+    const CompiledAngleLaw compiled(*law);
+    RNGStream stream(7);
+    RNGStream compiled_stream(7);
+
+    for (std::size_t i = 0; i < 100; i++) {
+      EXPECT_EQ(compiled.sample_mu(compiled_stream), law->sample_mu(stream));
+    }
+    EXPECT_EQ(compiled_stream.state(), stream.state());
+    EXPECT_DOUBLE_EQ(compiled.pdf(0.3), law->pdf(0.3));
+  }
+}
+
+TEST(CompiledAngleLaw, Compiled) {
+  EXPECT_TRUE(CompiledAngleLaw(Isotropic()).compiled());
+  EXPECT_TRUE(CompiledAngleLaw(Legendre()).compiled());
+
+  auto fwd = std::make_shared<ForwardPeaked>();
+  EXPECT_FALSE(CompiledAngleLaw(*fwd).compiled());
+
+  // Unknown laws must be managed by a shared_ptr
+  ForwardPeaked fwd_local;
+  EXPECT_THROW(CompiledAngleLaw{fwd_local}, PNDLException);
+}
+
+//==============================================================================
+// CompiledEnergyLaw Tests
+TEST(CompiledEnergyLaw, MatchesEnergyLaw) {
+  std::vector<std::shared_ptr<EnergyLaw>> laws{
+      std::make_shared<Watt>(constant_function(0.988),
+                             constant_function(2.249), -20.),
+      std::make_shared<Maxwellian>(constant_function(1.3), -20.),
+      std::make_shared<Evaporation>(constant_function(1.3), -20.),
+      std::make_shared<LevelInelasticScatter>(-1.5, 11.8969)};
+
+  for (const auto& law : laws) {
+    const CompiledEnergyLaw compiled(*law);
+    EXPECT_TRUE(compiled.compiled());
+    RNGStream stream(11);
+    RNGStream compiled_stream(11);
+
+    for (std::size_t i = 0; i < 100; i++) {
+      EXPECT_EQ(compiled.sample_energy(3., compiled_stream),
+                law->sample_energy(3., stream));
+    }
+    EXPECT_EQ(compiled_stream.state(), stream.state());
+  }
+}
+
+//==============================================================================
+// CompiledAngleEnergy Tests
+TEST(CompiledAngleEnergy, Construction) {
+  const auto dist = inelastic_distribution();
+  const CompiledAngleEnergy compiled(*dist);
+
+  EXPECT_TRUE(compiled.center_of_mass());
+  EXPECT_EQ(compiled.size(), 2);
+  EXPECT_TRUE(compiled.compiled());
+}
+
+TEST(CompiledAngleEnergy, MatchesAngleEnergy) {
+  const auto dist = inelastic_distribution();
+  const CompiledAngleEnergy compiled(*dist);
+
+  for (double E_in : {5., 8., 15.}) {
+    RNGStream stream(13);
+    RNGStream compiled_stream(13);
+    const std::function<double()> compiled_rng = std::ref(compiled_stream);
+
+    for (std::size_t i = 0; i < 1000; i++) {
+      const AngleEnergyPacket ref = dist->sample_angle_energy(E_in, stream);
+      const AngleEnergyPacket out = (i % 2 == 0)
+                                        ? compiled.sample_angle_energy(
+                                              E_in, compiled_stream)
+                                        : compiled.sample_angle_energy(
+                                              E_in, compiled_rng);
+      EXPECT_EQ(out.cosine_angle, ref.cosine_angle);
+      EXPECT_EQ(out.energy, ref.energy);
+    }
+    EXPECT_EQ(compiled_stream.state(), stream.state());
+  }
+}
+
+TEST(CompiledAngleEnergy, UnknownLaw) {
+  AngleDistribution angle({1.E-11, 20.}, {std::make_shared<ForwardPeaked>(),
+                                          std::make_shared<ForwardPeaked>()});
+  auto dist = std::make_shared<Uncorrelated>(
+      angle, std::make_shared<LevelInelasticScatter>(-1.5, 11.8969));
+  const CompiledAngleEnergy compiled(*dist);
+
+  EXPECT_FALSE(compiled.center_of_mass());
+  EXPECT_EQ(compiled.size(), 1);
+  EXPECT_FALSE(compiled.compiled());
+
+  RNGStream stream(5);
+  RNGStream compiled_stream(5);
+  for (std::size_t i = 0; i < 100; i++) {
+    const AngleEnergyPacket ref = dist->sample_angle_energy(2., stream);
+    const AngleEnergyPacket out =
+        compiled.sample_angle_energy(2., compiled_stream);
+    EXPECT_EQ(out.cosine_angle, ref.cosine_angle);
+    EXPECT_EQ(out.energy, ref.energy);
+  }
+}
+
+}  // namespace
+}  // namespace pndl
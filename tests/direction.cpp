@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/direction.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+// Directions which are isotropic, along with directions at and near the
+// poles, where the rotation must be carried out about the y axis.
+std::vector<Direction> directions(RNGStream& rng) {
+  std::vector<Direction> u{{0., 0., 1.},
+                           {0., 0., -1.},
+                           {1.E-6, 0., std::sqrt(1. - 1.E-12)},
+                           {0., 1., 0.},
+                           {1., 0., 0.}};
+  for (std::size_t i = 0; i < 500; i++) {
+    const double mu = 2. * rng() - 1.;
+    const double phi = 2. * std::numbers::pi * rng();
+    const double s = std::sqrt(1. - mu * mu);
+    u.push_back({s * std::cos(phi), s * std::sin(phi), mu});
+  }
+  return u;
+}
+
+TEST(Direction, Rotate) {
+  RNGStream rng(5);
+  for (const auto& u : directions(rng)) {
+    const double mu = 2. * rng() - 1.;
+    const double phi = 2. * std::numbers::pi * rng();
+    const Direction v = u.rotate(mu, phi);
+
+    // The rotated direction is a unit vector at an angle of mu to the
+    // original direction
+    EXPECT_NEAR(v.x * v.x + v.y * v.y + v.z * v.z, 1., 1.E-12);
+    EXPECT_NEAR(u.x * v.x + u.y * v.y + u.z * v.z, mu, 1.E-9);
+  }
+
+  // Scattering cosines outside of [-1, 1] are clamped
+  const Direction u{0.6, 0., 0.8};
+  const Direction f = u.rotate(1.5, 1.);
+  EXPECT_DOUBLE_EQ(f.x, u.x);
+  EXPECT_DOUBLE_EQ(f.y, u.y);
+  EXPECT_DOUBLE_EQ(f.z, u.z);
+  const Direction b = u.rotate(-1.5, 1.);
+  EXPECT_DOUBLE_EQ(b.x, -u.x);
+  EXPECT_DOUBLE_EQ(b.y, -u.y);
+  EXPECT_DOUBLE_EQ(b.z, -u.z);
+}
+
+TEST(Direction, Batch) {
+  RNGStream rng(9);
+  const std::vector<Direction> u = directions(rng);
+
+  std::vector<double> x, y, z, mu, phi;
+  for (const auto& d : u) {
+    x.push_back(d.x);
+    y.push_back(d.y);
+    z.push_back(d.z);
+    mu.push_back(2. * rng() - 1.);
+    phi.push_back(2. * std::numbers::pi * rng());
+  }
+
+  // Batched rotation with the azimuthal angles given
+  std::vector<double> bx = x, by = y, bz = z;
+  Direction::rotate(bx, by, bz, mu, phi);
+  for (std::size_t i = 0; i < u.size(); i++) {
+    const Direction v = u[i].rotate(mu[i], phi[i]);
+    EXPECT_EQ(bx[i], v.x);
+    EXPECT_EQ(by[i], v.y);
+    EXPECT_EQ(bz[i], v.z);
+  }
+
+  // Batched rotation with the azimuthal angles sampled, which spans more
+  // than one block of random numbers
+  RNGStream rng1(13);
+  RNGStream rng2(13);
+  bx = x;
+  by = y;
+  bz = z;
+  Direction::rotate(bx, by, bz, mu, rng1);
+  for (std::size_t i = 0; i < u.size(); i++) {
+    const Direction v = u[i].rotate(mu[i], rng2);
+    EXPECT_EQ(bx[i], v.x);
+    EXPECT_EQ(by[i], v.y);
+    EXPECT_EQ(bz[i], v.z);
+  }
+  EXPECT_EQ(rng1(), rng2());
+}
+
+TEST(Direction, BatchSizes) {
+  std::vector<double> x(4, 0.), y(4, 0.), z(4, 1.), mu(4, 0.5), phi(4, 1.);
+  std::vector<double> short_y(3, 0.), short_mu(3, 0.5), short_phi(3, 1.);
+  RNGStream rng(17);
+
+  EXPECT_NO_THROW(Direction::rotate(x, y, z, mu, phi));
+  EXPECT_THROW(Direction::rotate(x, short_y, z, mu, phi), PNDLException);
+  EXPECT_THROW(Direction::rotate(x, y, z, short_mu, phi), PNDLException);
+  EXPECT_THROW(Direction::rotate(x, y, z, mu, short_phi), PNDLException);
+
+  EXPECT_NO_THROW(Direction::rotate(x, y, z, mu, rng));
+  EXPECT_THROW(Direction::rotate(x, short_y, z, mu, rng), PNDLException);
+  EXPECT_THROW(Direction::rotate(x, y, z, short_mu, rng), PNDLException);
+}
+
+}  // namespace
+}  // namespace pndl
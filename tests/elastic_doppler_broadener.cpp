@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/cross_section.hpp>
+#include <PapillonNDL/elastic_dbrc.hpp>
+#include <PapillonNDL/elastic_rvs.hpp>
+#include <PapillonNDL/elastic_svt.hpp>
+#include <PapillonNDL/energy_grid.hpp>
+#include <PapillonNDL/rng.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+// Mean and variance of a set of samples
+struct Moments {
+  double mean;
+  double var;
+};
+
+Moments moments(const std::vector<double>& x) {
+  double sum = 0.;
+  double sum_sqrd = 0.;
+  for (const auto& v : x) {
+    sum += v;
+    sum_sqrd += v * v;
+  }
+  const double N = static_cast<double>(x.size());
+  return {sum / N, sum_sqrd / N - (sum / N) * (sum / N)};
+}
+
+// Checks that the means of two sets of samples agree within 5 standard
+// deviations.
+void expect_same_mean(const std::vector<double>& x1,
+                      const std::vector<double>& x2) {
+  const Moments m1 = moments(x1);
+  const Moments m2 = moments(x2);
+  const double sigma = std::sqrt(m1.var / static_cast<double>(x1.size()) +
+                                 m2.var / static_cast<double>(x2.size()));
+  EXPECT_NEAR(m1.mean, m2.mean, 5. * sigma);
+}
+
+// Samples target velocities with the batched method, and with the scalar
+// reference, and compares the first two moments of the velocity components
+// along and perpendicular to the incident direction.
+void compare_batch_to_scalar(const ElasticDopplerBroadener& broadener,
+                             double Ein, double kT, double awr,
+                             std::size_t N = 50000) {
+  const std::function<double()> rng_func = rng;
+  rng_reset();
+
+  const std::vector<double> E(N, Ein);
+  std::vector<std::array<double, 3>> vt_batch(N);
+  broadener.sample_target_velocities(E, kT, awr, rng_func, vt_batch);
+
+  std::vector<double> vz_batch(N, 0.), vz_scalar(N, 0.);
+  std::vector<double> vz2_batch(N, 0.), vz2_scalar(N, 0.);
+  std::vector<double> vp2_batch(N, 0.), vp2_scalar(N, 0.);
+  for (std::size_t i = 0; i < N; i++) {
+    const auto vt_scalar =
+        broadener.sample_target_velocity(Ein, kT, awr, rng_func);
+
+    vz_batch[i] = vt_batch[i][2];
+    vz2_batch[i] = vt_batch[i][2] * vt_batch[i][2];
+    vp2_batch[i] =
+        vt_batch[i][0] * vt_batch[i][0] + vt_batch[i][1] * vt_batch[i][1];
+
+    vz_scalar[i] = vt_scalar[2];
+    vz2_scalar[i] = vt_scalar[2] * vt_scalar[2];
+    vp2_scalar[i] =
+        vt_scalar[0] * vt_scalar[0] + vt_scalar[1] * vt_scalar[1];
+  }
+
+  expect_same_mean(vz_batch, vz_scalar);
+  expect_same_mean(vz2_batch, vz2_scalar);
+  expect_same_mean(vp2_batch, vp2_scalar);
+}
+
+// Two sample Kolmogorov-Smirnov test, which checks that the samples are
+// drawn from the same distribution at a significance level of 0.001.
+void expect_same_distribution(std::vector<double> x1, std::vector<double> x2) {
+  std::sort(x1.begin(), x1.end());
+  std::sort(x2.begin(), x2.end());
+  const double N1 = static_cast<double>(x1.size());
+  const double N2 = static_cast<double>(x2.size());
+
+  double D = 0.;
+  std::size_t i1 = 0, i2 = 0;
+  while (i1 < x1.size() && i2 < x2.size()) {
+    const double x = std::min(x1[i1], x2[i2]);
+    while (i1 < x1.size() && x1[i1] <= x) i1++;
+    while (i2 < x2.size() && x2[i2] <= x) i2++;
+    D = std::max(D, std::abs(static_cast<double>(i1) / N1 -
+                             static_cast<double>(i2) / N2));
+  }
+
+  const double D_crit = 1.949 * std::sqrt((N1 + N2) / (N1 * N2));
+  EXPECT_LT(D, D_crit);
+}
+
+// Small 0K cross section with a single large resonance at 6.67 eV
+CrossSection resonant_xs() {
+  constexpr std::size_t NE = 5000;
+  const double Emin = 1.E-6;
+  const double Emax = 1.E-5;
+  std::vector<double> energy(NE, 0.);
+  std::vector<double> xs(NE, 0.);
+  for (std::size_t i = 0; i < NE; i++) {
+    const double f = static_cast<double>(i) / static_cast<double>(NE - 1);
+    energy[i] = Emin + (Emax - Emin) * f;
+    const double x = 2. * (energy[i] - 6.674E-6) / 25.E-9;
+    xs[i] = 9. + 1.E3 / (1. + x * x);
+  }
+  return CrossSection(xs, std::make_shared<EnergyGrid>(energy), 0);
+}
+
+// Checks that sampling with an RNGStream gives exactly the same velocities as
+// sampling with a std::function which wraps an identical stream.
+void compare_stream_to_function(const ElasticDopplerBroadener& broadener,
+                                double Ein, double kT, double awr) {
+  constexpr std::size_t N = 1000;
+  RNGStream stream(23);
+  RNGStream func_stream(23);
+  const std::function<double()> rng_func = std::ref(func_stream);
+
+  for (std::size_t i = 0; i < N; i++) {
+    EXPECT_EQ(broadener.sample_target_velocity(Ein, kT, awr, stream),
+              broadener.sample_target_velocity(Ein, kT, awr, rng_func));
+  }
+
+  const std::vector<double> E(N, Ein);
+  std::vector<std::array<double, 3>> vt_stream(N);
+  std::vector<std::array<double, 3>> vt_func(N);
+  broadener.sample_target_velocities(E, kT, awr, stream, vt_stream);
+  broadener.sample_target_velocities(E, kT, awr, rng_func, vt_func);
+  EXPECT_EQ(vt_stream, vt_func);
+  EXPECT_EQ(stream.state(), func_stream.state());
+}
+
+//==============================================================================
+// ElasticSVT Tests
+TEST(ElasticSVT, BatchMatchesScalar) {
+  ElasticSVT svt;
+  const double kT = 2.53E-8;
+
+  compare_batch_to_scalar(svt, 1.E-8, kT, 236.0058);
+  compare_batch_to_scalar(svt, 1.E-6, kT, 236.0058);
+  compare_batch_to_scalar(svt, 1.E-7, kT, 0.999167);
+}
+
+TEST(ElasticSVT, StreamMatchesFunction) {
+  ElasticSVT svt;
+  compare_stream_to_function(svt, 1.E-6, 2.53E-8, 236.0058);
+  compare_stream_to_function(svt, 1.E-7, 2.53E-8, 0.999167);
+}
+
+TEST(ElasticSVT, BatchSizeMismatch) {
+  ElasticSVT svt;
+  const std::function<double()> rng_func = rng;
+  const std::vector<double> E(3, 1.E-6);
+  std::vector<std::array<double, 3>> vt(2);
+
+  EXPECT_THROW(svt.sample_target_velocities(E, 2.53E-8, 1., rng_func, vt),
+               PNDLException);
+}
+
+//==============================================================================
+// ElasticRVS Tests
+
+// Samples target velocities with RVS and with DBRC, which are both exact,
+// and compares the distributions of the relative energy, and of the target
+// velocity along the incident direction.
+void compare_rvs_to_dbrc(double Ein, double kT, double awr) {
+  constexpr std::size_t N = 20000;
+  const CrossSection xs = resonant_xs();
+  const ElasticRVS rvs(xs);
+  const ElasticDBRC dbrc(xs);
+  RNGStream rvs_stream(41);
+  RNGStream dbrc_stream(43);
+
+  std::vector<double> Er_rvs(N, 0.), Er_dbrc(N, 0.);
+  std::vector<double> vz_rvs(N, 0.), vz_dbrc(N, 0.);
+  const double vn = std::sqrt(Ein);
+  for (std::size_t i = 0; i < N; i++) {
+    const auto vt_rvs = rvs.sample_target_velocity(Ein, kT, awr, rvs_stream);
+    const auto vt_dbrc =
+        dbrc.sample_target_velocity(Ein, kT, awr, dbrc_stream);
+
+    vz_rvs[i] = vt_rvs[2];
+    Er_rvs[i] = vt_rvs[0] * vt_rvs[0] + vt_rvs[1] * vt_rvs[1] +
+                (vn - vt_rvs[2]) * (vn - vt_rvs[2]);
+    vz_dbrc[i] = vt_dbrc[2];
+    Er_dbrc[i] = vt_dbrc[0] * vt_dbrc[0] + vt_dbrc[1] * vt_dbrc[1] +
+                 (vn - vt_dbrc[2]) * (vn - vt_dbrc[2]);
+  }
+
+  expect_same_distribution(Er_rvs, Er_dbrc);
+  expect_same_distribution(vz_rvs, vz_dbrc);
+  expect_same_mean(vz_rvs, vz_dbrc);
+}
+
+TEST(ElasticRVS, MatchesDBRC) {
+  const double kT = 1.034E-7;
+
+  // Below, on, and above the resonance
+  compare_rvs_to_dbrc(6.5E-6, kT, 236.0058);
+  compare_rvs_to_dbrc(6.674E-6, kT, 236.0058);
+  compare_rvs_to_dbrc(7.0E-6, kT, 236.0058);
+}
+
+TEST(ElasticRVS, StreamMatchesFunction) {
+  ElasticRVS rvs(resonant_xs());
+  compare_stream_to_function(rvs, 6.6E-6, 1.034E-7, 236.0058);
+}
+
+//==============================================================================
+// ElasticDBRC Tests
+TEST(ElasticDBRC, BatchMatchesScalar) {
+  ElasticDBRC dbrc(resonant_xs());
+  const double kT = 1.034E-7;
+
+  compare_batch_to_scalar(dbrc, 6.6E-6, kT, 236.0058, 20000);
+  compare_batch_to_scalar(dbrc, 7.0E-6, kT, 236.0058, 20000);
+}
+
+TEST(ElasticDBRC, MaxXSValue) {
+  const CrossSection xs = resonant_xs();
+  ElasticDBRC dbrc(xs);
+  const EnergyGrid& grid = xs.energy_grid();
+
+  // Random ranges of all widths, including ranges within a single interval
+  // and ranges which extend past the ends of the grid.
+  RNGStream stream(31);
+  for (std::size_t n = 0; n < 20000; n++) {
+    double Emin = 0.9E-6 + 9.2E-6 * stream();
+    double Emax = 0.9E-6 + 9.2E-6 * stream();
+    if (n % 4 == 0) Emax = Emin + 5.E-9 * stream();
+    if (Emax < Emin) std::swap(Emin, Emax);
+
+    const std::size_t i_min = grid.get_lower_index(Emin);
+    const std::size_t i_max = grid.get_lower_index(Emax);
+    double xs_max = std::max(xs(Emin, i_min), xs(Emax, i_max));
+    for (std::size_t i = i_min + 1; i <= i_max; i++)
+      xs_max = std::max(xs_max, xs[i]);
+
+    EXPECT_EQ(dbrc.max_xs_value(Emin, Emax), xs_max);
+  }
+
+  // The majorant includes the peak of the resonance
+  EXPECT_GT(dbrc.max_xs_value(6.6E-6, 6.7E-6), 1.E3);
+}
+
+TEST(ElasticDBRC, StreamMatchesFunction) {
+  ElasticDBRC dbrc(resonant_xs());
+  compare_stream_to_function(dbrc, 6.6E-6, 1.034E-7, 236.0058);
+}
+
+}  // namespace
+}  // namespace pndl
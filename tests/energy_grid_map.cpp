@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/energy_grid.hpp>
+#include <PapillonNDL/energy_grid_map.hpp>
+#include <PapillonNDL/kalbach.hpp>
+#include <PapillonNDL/kalbach_table.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+// Energies which are hits of the grid, of the distribution, and which lie
+// between points of both, including values outside of either grid.
+std::vector<double> test_energies(const std::vector<double>& a,
+                                  const std::vector<double>& b) {
+  std::vector<double> E{1.E-12, 25.};
+  for (const auto& grid : {a, b}) {
+    for (std::size_t i = 0; i < grid.size(); i++) {
+      E.push_back(grid[i]);
+      if (i + 1 < grid.size()) E.push_back(0.5 * (grid[i] + grid[i + 1]));
+    }
+  }
+  for (std::size_t i = 0; i < 1000; i++) {
+    E.push_back(1.E-11 * std::pow(2.E12, static_cast<double>(i) / 999.));
+  }
+  return E;
+}
+
+TEST(EnergyGridMap, LowerBound) {
+  std::vector<double> grid_energy;
+  for (std::size_t i = 0; i < 500; i++) {
+    const double x = static_cast<double>(i) / 499.;
+    grid_energy.push_back(1.E-11 * std::pow(2.E12, x));
+  }
+  const EnergyGrid grid(grid_energy);
+
+  // Distributions which are inside the grid, which are coarser and finer
+  // than the grid, and which have repeated incident energies.
+  const std::vector<std::vector<double>> incident{
+      {1.E-5, 1., 2., 20.},
+      {1.E-11, 1.E-10, 1.E-9, 1.E-8, 1.E-7, 1.E-6, 1.E-5, 1.E-4, 1.E-3, 1.E-2,
+       0.1, 1., 2., 3., 4., 5., 6., 7., 8., 9., 10., 20.},
+      {0.5, 0.50001, 0.50002, 0.50003, 0.6},
+      {1., 2., 2., 3.}};
+
+  for (const auto& energy : incident) {
+    EnergyGridMap map;
+    EXPECT_FALSE(map.has(grid));
+    for (const double E : test_energies(grid_energy, energy)) {
+      const std::size_t i = grid.get_lower_index(E);
+      const std::size_t l = EnergyGridMap::lower_bound(energy, E);
+      EXPECT_EQ(l, static_cast<std::size_t>(
+                       std::lower_bound(energy.begin(), energy.end(), E) -
+                       energy.begin()));
+
+      // Without a map, the result is found with a search
+      EXPECT_EQ(map.lower_bound(energy, E, grid, i), l);
+    }
+
+    map.add(grid, energy);
+    map.add(grid, energy);
+    EXPECT_TRUE(map.has(grid));
+    EXPECT_EQ(map.size(), 1);
+    for (const double E : test_energies(grid_energy, energy)) {
+      const std::size_t i = grid.get_lower_index(E);
+      EXPECT_EQ(map.lower_bound(energy, E, grid, i),
+                EnergyGridMap::lower_bound(energy, E));
+    }
+  }
+}
+
+TEST(EnergyGridMap, Kalbach) {
+  const std::vector<double> energy{0., 1., 2., 3., 4.};
+  const std::vector<double> pdf{0.25, 0.25, 0.25, 0.25, 0.25};
+  const std::vector<double> cdf{0., 0.25, 0.5, 0.75, 1.};
+  const std::vector<double> R{0.1, 0.2, 0.3, 0.4, 0.5};
+  const std::vector<double> A{1., 1.5, 2., 2.5, 3.};
+  const std::vector<KalbachTable> tables{
+      KalbachTable(energy, pdf, cdf, R, A, Interpolation::LinLin),
+      KalbachTable(energy, pdf, cdf, R, A, Interpolation::Histogram),
+      KalbachTable(energy, pdf, cdf, R, A, Interpolation::LinLin)};
+  Kalbach kalbach({1., 2., 3.}, tables);
+
+  const EnergyGrid grid({0.5, 1., 1.2, 1.7, 2., 2.5, 4.});
+  const std::vector<double> incident{0.7, 1., 1.1, 1.5, 2., 2.2, 3., 3.5};
+
+  // Sampling with the grid index gives exactly the same result as the
+  // search, both before and after the grid is mapped.
+  for (const bool mapped : {false, true}) {
+    if (mapped) kalbach.map_energy_grid(grid);
+    for (const double E : incident) {
+      const std::size_t i = grid.get_lower_index(E);
+      RNGStream rng1(7);
+      RNGStream rng2(7);
+      for (std::size_t j = 0; j < 50; j++) {
+        const AngleEnergyPacket a = kalbach.sample_angle_energy(E, rng1);
+        const AngleEnergyPacket b =
+            kalbach.sample_angle_energy(E, grid, i, rng2);
+        EXPECT_EQ(a.cosine_angle, b.cosine_angle);
+        EXPECT_EQ(a.energy, b.energy);
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace pndl
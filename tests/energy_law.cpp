@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/equiprobable_energy_bins.hpp>
+#include <PapillonNDL/evaporation.hpp>
+#include <PapillonNDL/maxwellian.hpp>
+#include <PapillonNDL/nbody.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/tabulated_1d.hpp>
+#include <PapillonNDL/watt.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+std::shared_ptr<Tabulated1D> constant_function(double value) {
+  return std::make_shared<Tabulated1D>(Interpolation::LinLin,
+                                       std::vector<double>{1.E-11, 20.},
+                                       std::vector<double>{value, value});
+}
+
+// Simpson's rule integration of f over [a,b].
+double integrate(const std::function<double(double)>& f, double a, double b) {
+  constexpr std::size_t N = 2000;
+  const double h = (b - a) / static_cast<double>(N);
+  double sum = f(a) + f(b);
+  for (std::size_t i = 1; i < N; i++) {
+    const double x = a + h * static_cast<double>(i);
+    sum += (i % 2 == 1 ? 4. : 2.) * f(x);
+  }
+  return sum * h / 3.;
+}
+
+// Checks samples of a distribution on [0, x_max] with a chi-squared test,
+// against the (not necessarily normalized) PDF pdf. The samples are tallied
+// in 40 equal bins, and bins with few expected counts are merged with their
+// neighbors.
+void chi_squared_test(const std::function<double()>& sample,
+                      const std::function<double(double)>& pdf,
+                      double x_max) {
+  constexpr std::size_t NBINS = 40;
+  constexpr std::size_t NSAMPLES = 200000;
+  const double dx = x_max / static_cast<double>(NBINS);
+
+  std::vector<double> counts(NBINS, 0.);
+  for (std::size_t i = 0; i < NSAMPLES; i++) {
+    const double x = sample();
+    EXPECT_GE(x, 0.);
+    EXPECT_LE(x, x_max);
+    std::size_t b = static_cast<std::size_t>(x / dx);
+    if (b >= NBINS) b = NBINS - 1;
+    counts[b] += 1.;
+  }
+
+  std::vector<double> P(NBINS, 0.);
+  double norm = 0.;
+  for (std::size_t b = 0; b < NBINS; b++) {
+    P[b] = integrate(pdf, dx * static_cast<double>(b),
+                     dx * static_cast<double>(b + 1));
+    norm += P[b];
+  }
+
+  double chi_sqrd = 0.;
+  double observed = 0.;
+  double expected = 0.;
+  std::size_t groups = 0;
+  for (std::size_t b = 0; b < NBINS; b++) {
+    observed += counts[b];
+    expected += NSAMPLES * P[b] / norm;
+    if (expected >= 10. || b == NBINS - 1) {
+      chi_sqrd += (observed - expected) * (observed - expected) / expected;
+      observed = 0.;
+      expected = 0.;
+      groups++;
+    }
+  }
+
+  // 99.9th percentile of the chi-squared distribution, with the
+  // Wilson-Hilferty approximation.
+  const double k = static_cast<double>(groups - 1);
+  const double h = 2. / (9. * k);
+  const double limit = k * std::pow(1. - h + 3.09 * std::sqrt(h), 3.);
+  EXPECT_LT(chi_sqrd, limit);
+}
+
+// Two sample Kolmogorov-Smirnov test, which checks that the two samplers
+// draw from the same distribution at a significance level of 0.001.
+void ks_test(const std::function<double()>& sample1,
+             const std::function<double()>& sample2) {
+  constexpr std::size_t NSAMPLES = 50000;
+  std::vector<double> x1(NSAMPLES, 0.), x2(NSAMPLES, 0.);
+  for (auto& x : x1) x = sample1();
+  for (auto& x : x2) x = sample2();
+  std::sort(x1.begin(), x1.end());
+  std::sort(x2.begin(), x2.end());
+
+  double D = 0.;
+  std::size_t i1 = 0, i2 = 0;
+  while (i1 < NSAMPLES && i2 < NSAMPLES) {
+    const double x = std::min(x1[i1], x2[i2]);
+    while (i1 < NSAMPLES && x1[i1] <= x) i1++;
+    while (i2 < NSAMPLES && x2[i2] <= x) i2++;
+    D = std::max(D, std::abs(static_cast<double>(i1) -
+                             static_cast<double>(i2)) /
+                        static_cast<double>(NSAMPLES));
+  }
+
+  EXPECT_LT(D, 1.949 * std::sqrt(2. / static_cast<double>(NSAMPLES)));
+}
+
+// Checks that the analytic and tabulated samplers of an energy law agree,
+// far from the restriction energy (E_in = 2 MeV) and near it.
+template <class Law>
+void compare_tabulated(Law analytic, double E_threshold) {
+  Law tabulated = analytic;
+  tabulated.set_tabulated(true);
+  EXPECT_FALSE(analytic.tabulated());
+  EXPECT_TRUE(tabulated.tabulated());
+
+  RNGStream rng1(53);
+  RNGStream rng2(59);
+  for (const double E_in : {2., E_threshold}) {
+    ks_test([&]() { return analytic.sample_energy(E_in, rng1); },
+            [&]() { return tabulated.sample_energy(E_in, rng2); });
+  }
+}
+
+//==============================================================================
+// EquiprobableEnergyBins Tests
+TEST(EquiprobableEnergyBins, SampleEnergy) {
+  const std::vector<std::vector<double>> bounds{{0., 1., 3., 6.},
+                                                {0., 2., 4., 8.}};
+  const EquiprobableEnergyBins law({1., 2.}, bounds);
+
+  ASSERT_EQ(law.size(), 2);
+  ASSERT_EQ(law.bin_bounds(1).size(), 4);
+  EXPECT_EQ(law.bin_bounds(1)[3], 8.);
+
+  // Each of the three bins of the first set has a probability of 1/3
+  RNGStream rng(43);
+  std::vector<double> counts(3, 0.);
+  constexpr std::size_t NSAMPLES = 30000;
+  for (std::size_t i = 0; i < NSAMPLES; i++) {
+    const double E = law.sample_energy(0.5, rng);
+    ASSERT_GE(E, 0.);
+    ASSERT_LE(E, 6.);
+    counts[E < 1. ? 0 : (E < 3. ? 1 : 2)] += 1.;
+  }
+  for (const double c : counts) EXPECT_NEAR(c / NSAMPLES, 1. / 3., 0.015);
+
+  EXPECT_DOUBLE_EQ(*law.pdf(0.5, 2.), 1. / 6.);
+}
+
+//==============================================================================
+// Maxwellian Tests
+TEST(Maxwellian, SampleEnergy) {
+  constexpr double T = 1.3;
+  Maxwellian law(constant_function(T), -20.);
+  RNGStream rng(29);
+  auto pdf = [](double E) { return std::sqrt(E) * std::exp(-E / T); };
+
+  // The spectrum is restricted to E_in + 20 MeV, which is far in the tail
+  // for E_in = 2 MeV, and is in the peak of the spectrum for E_in = -19 MeV.
+  // Both the analytic and the tabulated samplers are checked.
+  for (const bool tabulated : {false, true}) {
+    law.set_tabulated(tabulated);
+    for (const double E_in : {2., -19.}) {
+      auto sample = [&]() { return law.sample_energy(E_in, rng); };
+      chi_squared_test(sample, pdf, E_in + 20.);
+    }
+  }
+}
+
+TEST(Maxwellian, TabulatedMatchesAnalytic) {
+  compare_tabulated(Maxwellian(constant_function(1.3), -20.), -19.);
+}
+
+//==============================================================================
+// Evaporation Tests
+TEST(Evaporation, SampleEnergy) {
+  constexpr double T = 0.8;
+  Evaporation law(constant_function(T), -20.);
+  RNGStream rng(31);
+  auto pdf = [](double E) { return E * std::exp(-E / T); };
+
+  for (const bool tabulated : {false, true}) {
+    law.set_tabulated(tabulated);
+    for (const double E_in : {2., -19.5}) {
+      auto sample = [&]() { return law.sample_energy(E_in, rng); };
+      chi_squared_test(sample, pdf, E_in + 20.);
+    }
+  }
+}
+
+TEST(Evaporation, TabulatedMatchesAnalytic) {
+  compare_tabulated(Evaporation(constant_function(0.8), -20.), -19.5);
+}
+
+//==============================================================================
+// Watt Tests
+TEST(Watt, SampleEnergy) {
+  constexpr double a = 0.988;
+  constexpr double b = 2.249;
+  Watt law(constant_function(a), constant_function(b), -20.);
+  RNGStream rng(37);
+  auto pdf = [](double E) {
+    return std::exp(-E / a) * std::sinh(std::sqrt(b * E));
+  };
+
+  for (const bool tabulated : {false, true}) {
+    law.set_tabulated(tabulated);
+    for (const double E_in : {2., -19.}) {
+      auto sample = [&]() { return law.sample_energy(E_in, rng); };
+      chi_squared_test(sample, pdf, E_in + 20.);
+    }
+  }
+}
+
+TEST(Watt, TabulatedMatchesAnalytic) {
+  compare_tabulated(
+      Watt(constant_function(0.988), constant_function(2.249), -20.), -19.);
+}
+
+//==============================================================================
+// NBody Tests
+TEST(NBody, SampleEnergy) {
+  constexpr double E_in = 8.;
+  for (const uint16_t n : {3, 4, 5}) {
+    NBody law(n, 2.9991, 1.9968, -2.2246);
+    const double E_max = ((law.Ap() - 1.) / law.Ap()) *
+                         ((law.A() / (law.A() + 1.)) * E_in + law.Q());
+    RNGStream rng(41);
+    auto pdf = [&](double E) {
+      const double p = 1.5 * static_cast<double>(n) - 4.;
+      return std::sqrt(E) * std::pow(std::max(E_max - E, 0.), p);
+    };
+
+    for (const bool tabulated : {false, true}) {
+      law.set_tabulated(tabulated);
+      auto sample = [&]() {
+        return law.sample_angle_energy(E_in, rng).energy;
+      };
+      chi_squared_test(sample, pdf, E_max);
+    }
+  }
+}
+
+TEST(NBody, TabulatedMatchesAnalytic) {
+  constexpr double E_in = 8.;
+  for (const uint16_t n : {3, 5}) {
+    const NBody analytic(n, 2.9991, 1.9968, -2.2246);
+    NBody tabulated = analytic;
+    tabulated.set_tabulated(true);
+
+    RNGStream rng1(61);
+    RNGStream rng2(67);
+    ks_test([&]() { return analytic.sample_angle_energy(E_in, rng1).energy; },
+            [&]() { return tabulated.sample_angle_energy(E_in, rng2).energy; });
+  }
+}
+
+}  // namespace
+}  // namespace pndl
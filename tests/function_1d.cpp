@@ -1,12 +1,18 @@
 #include <gtest/gtest.h>
 
+#include <PapillonNDL/compiled_tabulated_1d.hpp>
 #include <PapillonNDL/difference_1d.hpp>
+#include <PapillonNDL/linearize.hpp>
 #include <PapillonNDL/polynomial_1d.hpp>
 #include <PapillonNDL/sum_1d.hpp>
 #include <PapillonNDL/tabulated_1d.hpp>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "common/linearize_reference.hpp"
+
 namespace pndl {
 namespace {
 
@@ -289,6 +295,143 @@ TEST(Tabulated1D, XY) {
   }
 }
 
+//==============================================================================
+// CompiledTabulated1D
+// Evaluates the Tabulated1D and the CompiledTabulated1D at every point of
+// the grid, half way between points, and at random points.
+void expect_compiled(const Tabulated1D& tab) {
+  const CompiledTabulated1D compiled(tab);
+  const auto& x = tab.x();
+  std::vector<double> x_test{x.front() - 1., x.back() + 1.};
+  for (std::size_t i = 0; i < x.size(); i++) {
+    x_test.push_back(x[i]);
+    if (i + 1 < x.size()) x_test.push_back(0.5 * (x[i] + x[i + 1]));
+  }
+  for (std::size_t i = 0; i < 2000; i++) {
+    const double f = static_cast<double>(i) / 1999.;
+    x_test.push_back(x.front() + f * (x.back() - x.front()));
+  }
+
+  for (const double xi : x_test) {
+    EXPECT_EQ(compiled(xi), tab(xi));
+  }
+
+  // Tabulated1D can't integrate over a discontinuity which is inside of a
+  // region, so these integrals are only compared where it is defined.
+  for (std::size_t i = 0; i + 1 < x_test.size(); i += 7) {
+    const double integral = tab.integrate(x_test[i], x_test[i + 1]);
+    if (std::isnan(integral)) continue;
+    EXPECT_NEAR(compiled.integrate(x_test[i], x_test[i + 1]), integral,
+                1.E-12);
+  }
+}
+
+TEST(CompiledTabulated1D, SingleRegion) {
+  const Tabulated1D tab(Interpolation::LinLin, {1., 2., 3., 3., 4., 5.},
+                        {1., 2., 3., 6., 8., 10.});
+  const CompiledTabulated1D compiled(tab);
+  EXPECT_TRUE(compiled.linlin());
+  EXPECT_FALSE(compiled.hashed());
+  expect_compiled(tab);
+  EXPECT_DOUBLE_EQ(compiled.integrate(1., 5.), 20.);
+  EXPECT_DOUBLE_EQ(compiled.integrate(5., 1.), -20.);
+
+  const Tabulated1D log_tab(Interpolation::LogLog, {1., 2., 3., 4., 5., 6.},
+                            {1., 4., 3., 5., 5., 1.});
+  EXPECT_FALSE(CompiledTabulated1D(log_tab).linlin());
+  expect_compiled(log_tab);
+}
+
+TEST(CompiledTabulated1D, MultipleRegions) {
+  const Tabulated1D tab(
+      {2, 4, 7, 9},
+      {Interpolation::LinLin, Interpolation::Histogram, Interpolation::LogLog,
+       Interpolation::LinLog},
+      {1., 2., 2., 6., 8., 9., 10., 12., 15.},
+      {0., 1., 2., 6., 3., 5., 20., 4., 7.});
+  const CompiledTabulated1D compiled(tab);
+  EXPECT_FALSE(compiled.linlin());
+  EXPECT_EQ(compiled.interpolation(0), Interpolation::LinLin);
+  EXPECT_EQ(compiled.interpolation(2), Interpolation::Histogram);
+  EXPECT_EQ(compiled.interpolation(4), Interpolation::LogLog);
+  EXPECT_EQ(compiled.interpolation(7), Interpolation::LinLog);
+  expect_compiled(tab);
+
+  const Tabulated1D lin_tab({2, 3, 4},
+                            {Interpolation::LinLin, Interpolation::LinLin,
+                             Interpolation::LinLin},
+                            {0., 2., 4., 6.}, {1., 1., 3., 2.});
+  expect_compiled(lin_tab);
+  EXPECT_DOUBLE_EQ(CompiledTabulated1D(lin_tab).integrate(3., 5.), 5.25);
+}
+
+TEST(CompiledTabulated1D, Hash) {
+  std::vector<double> x, y;
+  for (std::size_t i = 0; i < 500; i++) {
+    const double f = static_cast<double>(i) / 499.;
+    x.push_back(1.E-11 * std::pow(2.E12, f));
+    y.push_back(1. + std::sin(10. * f));
+    if (i == 200) {
+      x.push_back(x.back());
+      y.push_back(0.5);
+    }
+  }
+  const Tabulated1D tab(Interpolation::LinLin, x, y);
+  EXPECT_TRUE(CompiledTabulated1D(tab).hashed());
+  expect_compiled(tab);
+
+  const Tabulated1D log_tab(Interpolation::LogLin, x, y);
+  EXPECT_TRUE(CompiledTabulated1D(log_tab).hashed());
+  expect_compiled(log_tab);
+}
+
+//==============================================================================
+// Linearize
+// The reference linearization and Maxwellian of linearize_reference.hpp
+using synthetic::linearize_reference;
+using synthetic::maxwellian;
+
+TEST(Linearize, Reference) {
+  auto step = [](double x) { return x < 1. ? 1. + x * x : 0.5 + x; };
+
+  struct Case {
+    std::vector<double> x, y;
+    std::function<double(double)> f;
+    double tolerance;
+  };
+  const std::vector<Case> cases{
+      {{1.E-5, 20.}, {maxwellian(1.E-5), maxwellian(20.)}, maxwellian, 0.001},
+      {{1.E-5, 20.}, {maxwellian(1.E-5), maxwellian(20.)}, maxwellian, 1.E-6},
+      {{0., 1., 1., 3.}, {step(0.), 2., step(1.), step(3.)}, step, 1.E-5},
+      {{-1., 1.}, {1.5, 2.5}, [](double mu) { return 2. + 0.5 * mu; }, 0.001},
+      {{2.}, {4.}, [](double x) { return x * x; }, 0.001}};
+
+  for (const auto& c : cases) {
+    std::vector<double> x = c.x;
+    std::vector<double> y = c.y;
+    std::vector<double> ref_calls, calls;
+    linearize_reference(
+        x, y,
+        [&](double v) {
+          ref_calls.push_back(v);
+          return c.f(v);
+        },
+        c.tolerance);
+
+    const Tabulated1D lin = linearize(
+        c.x, c.y,
+        [&](double v) {
+          calls.push_back(v);
+          return c.f(v);
+        },
+        c.tolerance);
+
+    EXPECT_EQ(lin.x(), x);
+    EXPECT_EQ(lin.y(), y);
+    EXPECT_EQ(calls, ref_calls);
+  }
+}
+
 //==============================================================================
 // Polynomial1D
 TEST(Polynomial1D, Order) {
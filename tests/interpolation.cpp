@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <PapillonNDL/interpolation.hpp>
+#include <PapillonNDL/rng_stream.hpp>
 #include <vector>
 
 namespace pndl {
@@ -597,5 +598,121 @@ TEST(Interpolator, VerifyYGrid) {
   EXPECT_NO_THROW(interp.verify_y_grid(y2.begin(), y2.end()));
 }
 
+//==============================================================================
+// Batch Tests
+
+// Random intervals with positive x and y, so that every rule is defined
+struct Batch {
+  std::vector<double> x, x1, y1, x2, y2, y, x_low, x_hi;
+};
+
+Batch random_batch(std::size_t N) {
+  Batch b;
+  RNGStream rng(17);
+  for (std::size_t i = 0; i < N; i++) {
+    const double x1 = 0.1 + 10. * rng();
+    const double x2 = x1 * (1.001 + 3. * rng());
+    const double y1 = 0.1 + 5. * rng();
+    const double y2 = 0.1 + 5. * rng();
+    const double f = rng();
+    b.x1.push_back(x1);
+    b.x2.push_back(x2);
+    b.y1.push_back(y1);
+    b.y2.push_back(y2);
+    b.x.push_back(x1 + f * (x2 - x1));
+    b.y.push_back(y1 + f * (y2 - y1));
+    b.x_low.push_back(x1 + 0.5 * f * (x2 - x1));
+    b.x_hi.push_back(x2 - 0.25 * f * (x2 - x1));
+  }
+  return b;
+}
+
+template <class Rule>
+void expect_batch() {
+  const Batch b = random_batch(1000);
+  std::vector<double> out(b.x.size(), 0.);
+
+  InterpolationBatch<Rule>::interpolate_batch(b.x, b.x1, b.y1, b.x2, b.y2, out);
+  for (std::size_t i = 0; i < out.size(); i++) {
+    EXPECT_DOUBLE_EQ(out[i],
+                     Rule::interpolate(b.x[i], b.x1[i], b.y1[i], b.x2[i],
+                                       b.y2[i]));
+  }
+
+  InterpolationBatch<Rule>::invert_batch(b.y, b.x1, b.y1, b.x2, b.y2, out);
+  for (std::size_t i = 0; i < out.size(); i++) {
+    EXPECT_DOUBLE_EQ(out[i], Rule::invert(b.y[i], b.x1[i], b.y1[i], b.x2[i],
+                                          b.y2[i]));
+  }
+
+  InterpolationBatch<Rule>::integrate_batch(b.x_low, b.x_hi, b.x1, b.y1, b.x2,
+                                            b.y2, out);
+  for (std::size_t i = 0; i < out.size(); i++) {
+    EXPECT_DOUBLE_EQ(out[i], Rule::integrate(b.x_low[i], b.x_hi[i], b.x1[i],
+                                             b.y1[i], b.x2[i], b.y2[i]));
+  }
+}
+
+TEST(Histogram, Batch) { expect_batch<Histogram>(); }
+
+TEST(LinLin, Batch) { expect_batch<LinLin>(); }
+
+TEST(LinLog, Batch) { expect_batch<LinLog>(); }
+
+TEST(LogLin, Batch) { expect_batch<LogLin>(); }
+
+TEST(LogLog, Batch) { expect_batch<LogLog>(); }
+
+TEST(Interpolator, Batch) {
+  const Batch b = random_batch(100);
+  std::vector<double> out(b.x.size(), 0.);
+
+  for (const auto rule :
+       {Interpolation::Histogram, Interpolation::LinLin, Interpolation::LinLog,
+        Interpolation::LogLin, Interpolation::LogLog}) {
+    const Interpolator interp(rule);
+
+    interp.interpolate(b.x, b.x1, b.y1, b.x2, b.y2, out);
+    for (std::size_t i = 0; i < out.size(); i++) {
+      EXPECT_DOUBLE_EQ(out[i], interp.interpolate(b.x[i], b.x1[i], b.y1[i],
+                                                  b.x2[i], b.y2[i]));
+    }
+
+    interp.invert(b.y, b.x1, b.y1, b.x2, b.y2, out);
+    for (std::size_t i = 0; i < out.size(); i++) {
+      EXPECT_DOUBLE_EQ(out[i], interp.invert(b.y[i], b.x1[i], b.y1[i],
+                                             b.x2[i], b.y2[i]));
+    }
+
+    interp.integrate(b.x_low, b.x_hi, b.x1, b.y1, b.x2, b.y2, out);
+    for (std::size_t i = 0; i < out.size(); i++) {
+      EXPECT_DOUBLE_EQ(out[i],
+                       interp.integrate(b.x_low[i], b.x_hi[i], b.x1[i],
+                                        b.y1[i], b.x2[i], b.y2[i]));
+    }
+  }
+}
+
+TEST(Interpolator, BatchSizes) {
+  const Batch b = random_batch(100);
+  const std::vector<double> short_x(b.x.begin(), b.x.end() - 1);
+  std::vector<double> out(b.x.size(), 0.);
+  std::vector<double> short_out(b.x.size() - 1, 0.);
+  const Interpolator interp(Interpolation::LinLin);
+
+  EXPECT_THROW(interp.interpolate(short_x, b.x1, b.y1, b.x2, b.y2, out),
+               PNDLException);
+  EXPECT_THROW(interp.interpolate(b.x, b.x1, b.y1, b.x2, b.y2, short_out),
+               PNDLException);
+  EXPECT_THROW(interp.invert(b.y, short_x, b.y1, b.x2, b.y2, out),
+               PNDLException);
+  EXPECT_THROW(interp.integrate(b.x_low, b.x_hi, b.x1, b.y1, short_x, b.y2,
+                                out),
+               PNDLException);
+  EXPECT_THROW(InterpolationBatch<LogLog>::interpolate_batch(
+                   b.x, b.x1, short_x, b.x2, b.y2, out),
+               PNDLException);
+}
+
 }  // namespace
 }  // namespace pndl
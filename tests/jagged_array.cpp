@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/jagged_array.hpp>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+TEST(JaggedArray, Empty) {
+  const JaggedArray<double> array;
+  EXPECT_TRUE(array.empty());
+  EXPECT_EQ(array.size(), 0);
+  EXPECT_TRUE(array.values().empty());
+  ASSERT_EQ(array.offsets().size(), 1);
+  EXPECT_EQ(array.offsets()[0], 0);
+}
+
+TEST(JaggedArray, Rows) {
+  const std::vector<std::vector<double>> rows{{1., 2., 3.}, {}, {4.}, {5., 6.}};
+  const JaggedArray<double> array(rows);
+
+  EXPECT_FALSE(array.empty());
+  ASSERT_EQ(array.size(), rows.size());
+  for (std::size_t i = 0; i < rows.size(); i++) {
+    ASSERT_EQ(array[i].size(), rows[i].size());
+    for (std::size_t j = 0; j < rows[i].size(); j++) {
+      EXPECT_EQ(array[i][j], rows[i][j]);
+    }
+  }
+  EXPECT_EQ(array.front().data(), array.values().data());
+  EXPECT_EQ(array.back()[1], 6.);
+  EXPECT_EQ(array.rows(), rows);
+
+  // All values are stored contiguously, one row after the other
+  const std::vector<double> values{1., 2., 3., 4., 5., 6.};
+  const std::vector<std::size_t> offsets{0, 3, 3, 4, 6};
+  EXPECT_EQ(array.values(), values);
+  EXPECT_EQ(array.offsets(), offsets);
+}
+
+TEST(JaggedArray, PushBack) {
+  JaggedArray<int> array;
+  array.push_back(std::vector<int>{1, 2});
+  array.push_back(std::vector<int>{3, 4, 5});
+  ASSERT_EQ(array.size(), 2);
+  EXPECT_EQ(array[1].size(), 3);
+  EXPECT_EQ(array[1][0], 3);
+
+  // Rows of a non-const array may be modified in place
+  array[0][1] = 7;
+  EXPECT_EQ(array.values()[1], 7);
+}
+
+}  // namespace
+}  // namespace pndl
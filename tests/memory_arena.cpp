@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/cross_section.hpp>
+#include <PapillonNDL/energy_grid.hpp>
+#include <PapillonNDL/memory_arena.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+TEST(MemoryArena, Allocate) {
+  MemoryArena arena(1024);
+  EXPECT_EQ(arena.footprint(), 0);
+  EXPECT_EQ(arena.num_blocks(), 0);
+
+  void* a = arena.allocate(100, 8);
+  void* b = arena.allocate(24, 64);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0);
+  EXPECT_TRUE(arena.contains(a));
+  EXPECT_TRUE(arena.contains(b));
+  EXPECT_EQ(arena.num_blocks(), 1);
+  EXPECT_EQ(arena.footprint(), 1024);
+  EXPECT_GE(arena.bytes_allocated(), 124);
+  EXPECT_LE(arena.bytes_allocated(), 124 + 64);
+
+  // Deallocation does not release any memory
+  arena.deallocate(a, 100, 8);
+  EXPECT_EQ(arena.footprint(), 1024);
+
+  // Allocations which do not fit in the current block start a new block,
+  // which is at least twice as large as the previous one
+  void* c = arena.allocate(4000, 8);
+  EXPECT_TRUE(arena.contains(c));
+  EXPECT_EQ(arena.num_blocks(), 2);
+  EXPECT_GE(arena.footprint(), 1024 + 4000);
+
+  int x = 0;
+  EXPECT_FALSE(arena.contains(&x));
+}
+
+TEST(MemoryArena, HugePages) {
+  MemoryArena arena(1024, true);
+  void* a = arena.allocate(100, 8);
+  EXPECT_TRUE(arena.contains(a));
+  if (arena.huge_pages()) {
+    EXPECT_EQ(arena.footprint(), MemoryArena::HUGE_PAGE_SIZE);
+  } else {
+    EXPECT_EQ(arena.footprint(), 1024);
+  }
+}
+
+TEST(MemoryArena, CrossSection) {
+  auto arena = std::make_shared<MemoryArena>();
+  const std::vector<double> energy{1., 2., 3., 4.};
+  auto egrid = std::make_shared<EnergyGrid>(energy, 8192, arena);
+  EXPECT_TRUE(arena->contains(egrid->grid().data()));
+
+  const CrossSection xs({1., 5., 3.}, egrid, 1, arena);
+  EXPECT_TRUE(arena->contains(xs.xs().data()));
+  EXPECT_EQ(xs.xs().size(), 3);
+  EXPECT_EQ(xs(2.5), 3.);
+
+  // The arena is kept alive by the data allocated from it
+  std::weak_ptr<MemoryArena> weak = arena;
+  arena.reset();
+  egrid.reset();
+  EXPECT_FALSE(weak.expired());
+  EXPECT_EQ(xs(3.5), 4.);
+  EXPECT_EQ(xs.energy_grid().max_energy(), 4.);
+}
+
+}  // namespace
+}  // namespace pndl
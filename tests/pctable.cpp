@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <PapillonNDL/guide_table.hpp>
+#include <PapillonNDL/log_hash_table.hpp>
 #include <PapillonNDL/pctable.hpp>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace pndl {
@@ -167,5 +171,122 @@ TEST(PCTable, Interpolation) {
   EXPECT_EQ(Interpolation::Histogram, hist.interpolation());
 }
 
+//==============================================================================
+// GuideTable Tests
+std::size_t lower_bound_index(const std::vector<double>& cdf, double xi) {
+  return static_cast<std::size_t>(
+      std::lower_bound(cdf.begin(), cdf.end(), xi) - cdf.begin());
+}
+
+TEST(GuideTable, LowerBound) {
+  // CDF with most of the probability in a few points, repeated values, and
+  // a point exactly on a bin boundary.
+  const std::vector<double> cdf{0.,  1.E-9, 1.E-8, 1.E-7, 0.25, 0.25,
+                                0.25, 0.5,  0.99,  0.999, 1.};
+  const GuideTable guide(cdf);
+  EXPECT_EQ(guide.size(), cdf.size());
+
+  // Grid points, points between them, and the ends of the unit interval
+  std::vector<double> xis(cdf);
+  for (std::size_t i = 0; i < cdf.size() - 1; i++) {
+    xis.push_back(0.5 * (cdf[i] + cdf[i + 1]));
+  }
+  for (std::size_t i = 0; i <= 1000; i++) {
+    xis.push_back(static_cast<double>(i) / 1000.);
+  }
+  xis.push_back(std::nextafter(1., 0.));
+
+  for (const auto& xi : xis) {
+    EXPECT_EQ(guide.lower_bound(cdf, xi), lower_bound_index(cdf, xi));
+  }
+
+  // Values outside of [0,1] fall back to the full search
+  EXPECT_EQ(guide.lower_bound(cdf, -0.5), 0u);
+  EXPECT_EQ(guide.lower_bound(cdf, 1.5), cdf.size());
+}
+
+TEST(GuideTable, Empty) {
+  const std::vector<double> cdf{0., 0.5, 1.};
+  const GuideTable guide;
+  EXPECT_EQ(guide.size(), 0u);
+  EXPECT_EQ(guide.lower_bound(cdf, 0.25), 1u);
+  EXPECT_EQ(guide.lower_bound(cdf, 0.75), 2u);
+}
+
+TEST(PCTable, SampleValueGuided) {
+  // Sampling with the guide table must be identical to inverting the CDF
+  // with a search over the entire table.
+  const std::vector<double> v{-1., -0.5, 0., 0.2, 0.25, 0.5, 1.};
+  const std::vector<double> p{0.1, 0.2, 0.2, 0.4, 3.8, 0.3, 0.2};
+  std::vector<double> c(v.size(), 0.);
+  for (std::size_t i = 1; i < v.size(); i++) {
+    c[i] = c[i - 1] + 0.5 * (p[i] + p[i - 1]) * (v[i] - v[i - 1]);
+  }
+  for (auto& ci : c) ci /= c.back();
+
+  const PCTable lin(v, p, c, Interpolation::LinLin);
+  for (std::size_t i = 0; i < 1000; i++) {
+    const double xi = static_cast<double>(i) / 1000.;
+    std::size_t l = lower_bound_index(lin.cdf(), xi);
+    if (lin.cdf()[l] == xi) {
+      EXPECT_EQ(lin.sample_value(xi), v[l]);
+      continue;
+    }
+    l--;
+    if (p[l] == p[l + 1]) {
+      EXPECT_EQ(lin.sample_value(xi), v[l] + (xi - lin.cdf()[l]) / p[l]);
+      continue;
+    }
+    const double m = (p[l + 1] - p[l]) / (v[l + 1] - v[l]);
+    const double arg = p[l] * p[l] + 2. * m * (xi - lin.cdf()[l]);
+    const double ref = v[l] + (1. / m) * (std::sqrt(std::max(arg, 0.)) - p[l]);
+    EXPECT_EQ(lin.sample_value(xi), ref);
+  }
+}
+
+//==============================================================================
+// LogHashTable Tests
+TEST(LogHashTable, LowerBound) {
+  // A grid spanning many decades, with repeated points and a dense region
+  std::vector<double> grid{1.E-11, 1.E-10, 1.E-10, 1.E-9, 1.E-5};
+  for (std::size_t i = 0; i < 100; i++)
+    grid.push_back(1.E-3 + 1.E-5 * static_cast<double>(i));
+  grid.push_back(1.);
+  grid.push_back(20.);
+  const LogHashTable hash(grid);
+  EXPECT_EQ(hash.size(), grid.size());
+
+  // Grid points, their neighbours, points between them, and values outside
+  // of the grid
+  std::vector<double> xs{0., 1.E-12, 25., 1.E3};
+  for (std::size_t i = 0; i < grid.size(); i++) {
+    xs.push_back(grid[i]);
+    xs.push_back(std::nextafter(grid[i], 0.));
+    xs.push_back(std::nextafter(grid[i], 100.));
+    if (i + 1 < grid.size()) xs.push_back(0.5 * (grid[i] + grid[i + 1]));
+  }
+
+  for (const auto& x : xs) {
+    EXPECT_EQ(hash.lower_bound(grid, x), lower_bound_index(grid, x));
+  }
+}
+
+TEST(LogHashTable, Empty) {
+  // No table is built for a grid starting at zero, or for a single point
+  const std::vector<double> zero{0., 0.5, 1.};
+  const std::vector<double> single{2.};
+  const LogHashTable zero_hash(zero);
+  const LogHashTable single_hash(single);
+  EXPECT_EQ(zero_hash.size(), 0u);
+  EXPECT_EQ(single_hash.size(), 0u);
+  EXPECT_EQ(zero_hash.lower_bound(zero, 0.25), 1u);
+  EXPECT_EQ(single_hash.lower_bound(single, 3.), 1u);
+
+  // A table built for another grid is not used
+  const LogHashTable hash;
+  EXPECT_EQ(hash.size(), 0u);
+  EXPECT_EQ(hash.lower_bound(zero, 0.75), 2u);
+}
+
 }  // namespace
 }  // namespace pndl
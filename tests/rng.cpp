@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/rng.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace pndl {
+namespace {
+
+// The generator which was originally used by rng
+using LCG = std::linear_congruential_engine<uint64_t, 2806196910506780709ULL, 1,
+                                            0x8000000000000000>;
+
+//==============================================================================
+// RNGStream Tests
+TEST(RNGStream, MatchesLCG) {
+  LCG lcg;
+  std::uniform_real_distribution<double> unit_dist;
+  RNGStream stream;
+
+  for (std::size_t i = 0; i < 1000; i++) {
+    EXPECT_EQ(stream(), unit_dist(lcg));
+  }
+
+  lcg.seed(17);
+  stream.seed(17);
+  for (std::size_t i = 0; i < 1000; i++) {
+    EXPECT_EQ(stream(), unit_dist(lcg));
+  }
+}
+
+TEST(RNGStream, Advance) {
+  for (std::uint64_t n : {0, 1, 2, 3, 7, 100, 12345}) {
+    RNGStream stream1(42);
+    RNGStream stream2(42);
+
+    for (std::uint64_t i = 0; i < n; i++) stream1();
+    stream2.advance(n);
+
+    EXPECT_EQ(stream1.state(), stream2.state());
+    EXPECT_EQ(stream1(), stream2());
+  }
+
+  // The period of the generator is 2^63
+  RNGStream stream(42);
+  stream.advance(0x8000000000000000ULL);
+  EXPECT_EQ(stream.state(), 42);
+}
+
+TEST(RNGStream, Split) {
+  RNGStream stream(42);
+  RNGStream split = stream.split(3, 100);
+
+  stream.advance(300);
+  EXPECT_EQ(split.state(), stream.state());
+
+  // Splitting does not modify the parent stream
+  RNGStream parent(42);
+  parent.split(5);
+  EXPECT_EQ(parent.state(), 42);
+}
+
+TEST(RNGStream, Checkpoint) {
+  RNGStream stream(42);
+  for (std::size_t i = 0; i < 10; i++) stream();
+
+  RNGStream restored(stream.state());
+  for (std::size_t i = 0; i < 10; i++) {
+    EXPECT_EQ(stream(), restored());
+  }
+}
+
+TEST(RNGStream, Range) {
+  RNGStream stream;
+  for (std::size_t i = 0; i < 10000; i++) {
+    const double xi = stream();
+    EXPECT_GE(xi, 0.);
+    EXPECT_LT(xi, 1.);
+  }
+}
+
+//==============================================================================
+// rng Tests
+// Returns the index of the block of rng_thread_stride random numbers after
+// the seed at which a stream starts, or -1 if it is not at the start of one
+// of the first 64 blocks.
+int thread_block(const RNGStream& start, std::uint64_t seed) {
+  for (std::uint64_t n = 0; n < 64; n++) {
+    if (RNGStream(seed).split(n, rng_thread_stride).state() == start.state())
+      return static_cast<int>(n);
+  }
+  return -1;
+}
+
+TEST(RNG, ThreadLocal) {
+  constexpr std::size_t NTHREADS = 4;
+
+  rng_reset();
+  std::vector<RNGStream> starts(NTHREADS + 1);
+  starts[0] = rng_stream();
+  std::vector<std::vector<double>> values(NTHREADS + 1,
+                                          std::vector<double>(100, 0.));
+  for (auto& xi : values[0]) xi = rng();
+
+  // Each new thread starts in its own block after the default seed,
+  // independently of the state of the stream on the main thread.
+  std::vector<std::thread> threads;
+  for (std::size_t t = 1; t <= NTHREADS; t++) {
+    threads.emplace_back([&starts, &values, t]() {
+      starts[t] = rng_stream();
+      for (auto& xi : values[t]) xi = rng();
+    });
+  }
+  for (auto& t : threads) t.join();
+
+  std::vector<int> blocks;
+  for (std::size_t t = 0; t <= NTHREADS; t++) {
+    const int block = thread_block(starts[t], RNGStream::default_seed);
+    EXPECT_GE(block, 0);
+    EXPECT_EQ(std::count(blocks.begin(), blocks.end(), block), 0);
+    blocks.push_back(block);
+
+    for (std::size_t u = 0; u < t; u++) EXPECT_NE(values[t], values[u]);
+  }
+}
+
+TEST(RNG, Seed) {
+  // Seeding keeps the stream of the thread in its own block
+  rng_seed(42);
+  const RNGStream main_start = rng_stream();
+
+  RNGStream thread_start;
+  std::thread t([&thread_start]() {
+    rng_seed(42);
+    thread_start = rng_stream();
+  });
+  t.join();
+
+  const int main_block = thread_block(main_start, 42);
+  const int other_block = thread_block(thread_start, 42);
+  EXPECT_GE(main_block, 0);
+  EXPECT_GE(other_block, 0);
+  EXPECT_NE(main_block, other_block);
+}
+
+TEST(RNG, Advance) {
+  rng_reset();
+  for (std::size_t i = 0; i < 50; i++) rng();
+  const double xi = rng();
+
+  rng_reset();
+  const RNGStream start = rng_stream();
+  rng_advance(50);
+  EXPECT_EQ(rng(), xi);
+  EXPECT_EQ(rng_stream().state(), start.split(51, 1).state());
+}
+
+}  // namespace
+}  // namespace pndl
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/pndl_exception.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/st_neutron.hpp>
+#include <PapillonNDL/xs_packet_batch.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/fissile_ace.hpp"
+
+namespace pndl {
+namespace {
+
+using namespace synthetic;
+
+//==============================================================================
+// The synthetic fissile nuclide of fissile_ace.hpp, on an energy grid of NES
+// points.
+constexpr std::size_t NES = 300;
+
+// Energies at the grid points and between them, along with values outside of
+// the grid.
+std::vector<double> test_energies() {
+  const std::vector<double> grid = log_grid(NES);
+  std::vector<double> E{1.E-12, 25.};
+  for (std::size_t i = 0; i < grid.size(); i++) {
+    E.push_back(grid[i]);
+    if (i + 1 < grid.size()) E.push_back(0.5 * (grid[i] + grid[i + 1]));
+  }
+  RNGStream rng(19);
+  for (std::size_t i = 0; i < 1000; i++)
+    E.push_back(1.E-11 * std::pow(2.E12, rng()));
+  return E;
+}
+
+// Cumulative probabilities of the delayed families, evaluated directly from
+// their probability functions and normalized to one.
+std::vector<double> family_cdf(const Fission& fission, double E) {
+  std::vector<double> cdf(fission.n_delayed_families(), 0.);
+  double P = 0.;
+  for (std::size_t g = 0; g < cdf.size(); g++) {
+    P += std::max(fission.delayed_family(g).probability()(E), 0.);
+    cdf[g] = P;
+  }
+  for (auto& c : cdf) c /= P;
+  return cdf;
+}
+
+TEST(STNeutron, EvaluateXSBatch) {
+  const ACE ace = fissile_ace(NES);
+  const STNeutron nuclide(ace);
+  const std::vector<double> E = test_energies();
+
+  XSPacketBatch batch;
+  nuclide.evaluate_xs(E, batch);
+  ASSERT_EQ(batch.size(), E.size());
+
+  for (std::size_t j = 0; j < E.size(); j++) {
+    const XSPacket ref = nuclide.evaluate_xs(E[j]);
+    const XSPacket xs = batch.get(j);
+    EXPECT_EQ(xs.total, ref.total);
+    EXPECT_EQ(xs.elastic, ref.elastic);
+    EXPECT_EQ(xs.inelastic, ref.inelastic);
+    EXPECT_EQ(xs.absorption, ref.absorption);
+    EXPECT_EQ(xs.fission, ref.fission);
+    EXPECT_EQ(xs.capture, ref.capture);
+    EXPECT_EQ(xs.heating, ref.heating);
+    EXPECT_EQ(xs.nu_fission, ref.nu_fission);
+  }
+
+  // The capture and fission cross sections are those of the reactions
+  const XSPacket xs = nuclide.evaluate_xs(1.E-6);
+  EXPECT_NEAR(xs.capture, capture_xs(1.E-6), 1.E-3 * capture_xs(1.E-6));
+  EXPECT_NEAR(xs.fission, fission_xs(1.E-6), 1.E-3 * fission_xs(1.E-6));
+  EXPECT_GT(xs.nu_fission, 2. * xs.fission);
+}
+
+TEST(CrossSection, EvaluateBatchSizes) {
+  const ACE ace = fissile_ace(NES);
+  const STNeutron nuclide(ace);
+  const CrossSection& total = nuclide.total_xs();
+  const std::vector<double> E{1.E-6, 1.E-3};
+  const std::vector<std::size_t> i{nuclide.energy_grid().get_lower_index(E[0]),
+                                   nuclide.energy_grid().get_lower_index(E[1])};
+
+  std::vector<double> xs(2, 0.);
+  total.evaluate(E, i, xs);
+  EXPECT_EQ(xs[0], total(E[0], i[0]));
+  EXPECT_EQ(xs[1], total(E[1], i[1]));
+
+  std::vector<double> short_xs(1, 0.);
+  EXPECT_THROW(total.evaluate(E, i, short_xs), PNDLException);
+  EXPECT_THROW(total.evaluate(E, std::span(i).first(1), xs), PNDLException);
+}
+
+//==============================================================================
+// Fission
+TEST(Fission, TabulatedNu) {
+  const ACE ace = fissile_ace(NES);
+  STNeutron nuclide(ace);
+  const Fission& fission = nuclide.fission();
+  const EnergyGrid& grid = nuclide.energy_grid();
+
+  // At the grid points, the tabulated nu matches the functions
+  for (std::size_t i = 0; i < grid.size(); i++) {
+    const double E = grid[i];
+    EXPECT_DOUBLE_EQ(fission.nu_total(E, i), fission.nu_total()(E));
+    EXPECT_DOUBLE_EQ(fission.nu_delayed(E, i), fission.nu_delayed()(E));
+    EXPECT_DOUBLE_EQ(fission.nu_prompt(E, i),
+                     fission.nu_total()(E) - fission.nu_delayed()(E));
+  }
+}
+
+TEST(Fission, SampleFissionNeutrons) {
+  const ACE ace = fissile_ace(NES);
+  STNeutron nuclide(ace);
+  const Fission& fission = nuclide.fission();
+  const EnergyGrid& grid = nuclide.energy_grid();
+
+  constexpr std::size_t N = 200000;
+  RNGStream rng(23);
+  for (const double E : {1.E-8, 0.5, 2., 14.}) {
+    const std::size_t i = grid.get_lower_index(E);
+    const double nu_t = fission.nu_total(E, i);
+    const double nu_d = fission.nu_delayed(E, i);
+
+    std::vector<FissionNeutron> neutrons;
+    const std::size_t n = fission.sample_fission_neutrons(E, N, rng, neutrons);
+    ASSERT_EQ(n, neutrons.size());
+
+    // The number of neutrons of an event is floor(nu) or floor(nu) + 1
+    const double frac = nu_t - std::floor(nu_t);
+    const double count_sigma =
+        std::sqrt(frac * (1. - frac) / static_cast<double>(N));
+    const double mean = static_cast<double>(n) / static_cast<double>(N);
+    EXPECT_NEAR(mean, nu_t, 5. * count_sigma);
+
+    // The delayed fraction, and the fraction of each family
+    std::array<std::size_t, DECAY.size() + 1> counts{};
+    for (const auto& neutron : neutrons) {
+      ASSERT_LE(neutron.family, DECAY.size());
+      EXPECT_GE(neutron.cosine_angle, -1.);
+      EXPECT_LE(neutron.cosine_angle, 1.);
+      EXPECT_GT(neutron.energy, 0.);
+      counts[neutron.family]++;
+    }
+    const double beta = nu_d / nu_t;
+    const double n_total = static_cast<double>(n);
+    const double n_delayed = static_cast<double>(n - counts[0]);
+    const double beta_sigma = std::sqrt(beta * (1. - beta) / n_total);
+    EXPECT_NEAR(n_delayed / n_total, beta, 5. * beta_sigma);
+
+    const std::vector<double> cdf = family_cdf(fission, E);
+    for (std::size_t g = 0; g < DECAY.size(); g++) {
+      const double p = g == 0 ? cdf[0] : cdf[g] - cdf[g - 1];
+      const double sigma = std::sqrt(p * (1. - p) / n_delayed);
+      EXPECT_NEAR(static_cast<double>(counts[g + 1]) / n_delayed, p,
+                  5. * sigma);
+    }
+  }
+}
+
+TEST(Fission, SelectDelayedFamily) {
+  for (const Families families : {Families::LinLin, Families::Histogram}) {
+    const ACE ace = fissile_ace(NES, families);
+    STNeutron nuclide(ace);
+    const Fission& fission = nuclide.fission();
+    ASSERT_EQ(fission.n_delayed_families(), DECAY.size());
+
+    // Energies at and around the points of the family probabilities, and
+    // outside of their range
+    std::vector<double> energies{1.E-12, 1.E-11, 1., 5., 20., 25.};
+    RNGStream rng(29);
+    for (std::size_t j = 0; j < 500; j++)
+      energies.push_back(1.E-11 * std::pow(2.E12, rng()));
+
+    for (const double E : energies) {
+      const std::vector<double> cdf = family_cdf(fission, E);
+      for (std::size_t k = 0; k < 50; k++) {
+        const double xi = rng();
+        const std::size_t g = fission.select_delayed_family(E, xi);
+        ASSERT_LT(g, DECAY.size());
+
+        // The direct scan, skipping values of xi which fall within rounding
+        // of a boundary between two families
+        std::size_t ref = 0;
+        while (ref + 1 < cdf.size() && xi >= cdf[ref]) ref++;
+        bool near_boundary = false;
+        for (const double c : cdf) {
+          if (std::abs(xi - c) < 1.E-12) near_boundary = true;
+        }
+        if (near_boundary == false) EXPECT_EQ(g, ref);
+      }
+    }
+  }
+}
+
+TEST(Fission, NoDelayedFamilies) {
+  const ACE ace = fissile_ace(NES, Families::None);
+  STNeutron nuclide(ace);
+  const Fission& fission = nuclide.fission();
+  ASSERT_EQ(fission.n_delayed_families(), 0);
+  EXPECT_THROW(fission.select_delayed_family(1., 0.5), PNDLException);
+
+  // Every neutron is prompt
+  RNGStream rng(31);
+  std::vector<FissionNeutron> neutrons;
+  EXPECT_GT(fission.sample_fission_neutrons(1., 1000, rng, neutrons), 0);
+  for (const auto& neutron : neutrons) EXPECT_EQ(neutron.family, 0);
+}
+
+//==============================================================================
+// URRPTables
+TEST(URRPTables, NuFission) {
+  const ACE ace = fissile_ace(NES);
+  STNeutron nuclide(ace);
+  const URRPTables& urr = nuclide.urr_ptables();
+  ASSERT_TRUE(urr.is_valid());
+
+  for (const double E : {1.E-3, 5.E-3, 1.E-2, 2.E-2, 0.1}) {
+    const std::size_t i = nuclide.energy_grid().get_lower_index(E);
+    const double nu = nuclide.fission().nu_total(E, i);
+    for (const double xi : {0.2, 0.7}) {
+      const std::optional<XSPacket> xs = urr.evaluate_xs(E, i, xi);
+      ASSERT_TRUE(xs.has_value());
+      EXPECT_GT(xs->fission, 0.);
+      EXPECT_DOUBLE_EQ(xs->nu_fission, xs->fission * nu);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace pndl
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <PapillonNDL/ace.hpp>
+#include <PapillonNDL/rng_stream.hpp>
+#include <PapillonNDL/st_coherent_elastic.hpp>
+#include <PapillonNDL/st_thermal_scattering_law.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "common/tsl_ace.hpp"
+
+namespace pndl {
+namespace {
+
+using namespace synthetic;
+
+//==============================================================================
+// The synthetic thermal scattering law of tsl_ace.hpp, with discrete
+// outgoing energies.
+constexpr std::size_t Ne = 40;
+constexpr std::size_t NBRAGG = 300;
+constexpr SyntheticTSL TSL{Ne, 8, 8, NBRAGG};
+
+// Energies at every point of the reaction grids, between them, and outside
+// of them, followed by random energies.
+std::vector<double> test_energies(const STThermalScatteringLaw& tsl) {
+  std::vector<double> E{0.5E-11, 1.E-11, 4.E-6, 5.E-6, 1.E-3};
+  for (std::size_t ie = 0; ie < Ne; ie++) {
+    E.push_back(TSL.incident_energy(ie));
+    if (ie + 1 < Ne) E.push_back(TSL.elastic_energy(ie));
+  }
+  if (tsl.has_coherent_elastic()) {
+    for (std::size_t b = 0; b < NBRAGG; b++) {
+      E.push_back(TSL.bragg_edge(b));
+      E.push_back(std::nextafter(TSL.bragg_edge(b), 0.));
+      E.push_back(std::nextafter(TSL.bragg_edge(b), 1.));
+    }
+  }
+  RNGStream rng(37);
+  for (std::size_t i = 0; i < 5000; i++)
+    E.push_back(1.E-11 * std::pow(4.E5, rng()));
+  return E;
+}
+
+//==============================================================================
+// STThermalScatteringLaw
+TEST(STThermalScatteringLaw, UnionGridXS) {
+  for (const bool coherent : {false, true}) {
+    const ACE ace = TSL.ace(false, coherent);
+    const STThermalScatteringLaw tsl(ace);
+    EXPECT_EQ(tsl.has_coherent_elastic(), coherent);
+    EXPECT_EQ(tsl.has_incoherent_elastic(), !coherent);
+
+    for (const double E : test_energies(tsl)) {
+      const double ii = tsl.incoherent_inelastic().xs(E);
+      const double ie = tsl.incoherent_elastic().xs(E);
+      const double ce = tsl.coherent_elastic().xs(E);
+      const double ref = ii + ie + ce;
+      EXPECT_NEAR(tsl.xs(E), ref, 1.E-13 * ref);
+    }
+  }
+}
+
+TEST(STThermalScatteringLaw, EvaluateAndSelect) {
+  for (const bool coherent : {false, true}) {
+    const ACE ace = TSL.ace(false, coherent);
+    const STThermalScatteringLaw tsl(ace);
+    RNGStream rng(41);
+
+    for (const double E : test_energies(tsl)) {
+      const double ii = tsl.incoherent_inelastic().xs(E);
+      const double ie = tsl.incoherent_elastic().xs(E);
+      const double ce = tsl.coherent_elastic().xs(E);
+      const double total = ii + ie + ce;
+
+      for (std::size_t k = 0; k < 4; k++) {
+        const double xi = rng();
+        const TSLSelection sel = tsl.evaluate_and_select(E, xi);
+        EXPECT_NEAR(sel.xs, total, 1.E-13 * total);
+
+        // Select with the per-reaction cross sections, skipping values of
+        // xi which fall within rounding of a boundary between reactions
+        const double x = xi * total;
+        if (std::abs(x - ii) < 1.E-12 * total ||
+            std::abs(x - ii - ie) < 1.E-12 * total)
+          continue;
+
+        TSLChannel ref = TSLChannel::CoherentElastic;
+        const STTSLReaction* reaction = &tsl.coherent_elastic();
+        if (x < ii) {
+          ref = TSLChannel::IncoherentInelastic;
+          reaction = &tsl.incoherent_inelastic();
+        } else if (x < ii + ie) {
+          ref = TSLChannel::IncoherentElastic;
+          reaction = &tsl.incoherent_elastic();
+        }
+        EXPECT_EQ(sel.channel, ref);
+        EXPECT_EQ(sel.reaction, reaction);
+      }
+    }
+  }
+}
+
+//==============================================================================
+// STCoherentElastic
+TEST(STCoherentElastic, BraggIndex) {
+  const ACE ace = TSL.ace(false, true);
+  const STCoherentElastic ce(ace);
+  const std::vector<double>& edges = ce.bragg_edges();
+  ASSERT_EQ(edges.size(), NBRAGG);
+
+  std::vector<double> energies{0., 1.E-11, 1.E-3};
+  for (const double E : edges) {
+    energies.push_back(E);
+    energies.push_back(std::nextafter(E, 0.));
+    energies.push_back(std::nextafter(E, 1.));
+  }
+  RNGStream rng(43);
+  for (std::size_t i = 0; i < 5000; i++)
+    energies.push_back(1.E-9 * std::pow(5.E3, rng()));
+
+  for (const double E : energies) {
+    const std::size_t n = static_cast<std::size_t>(
+        std::lower_bound(edges.begin(), edges.end(), E) - edges.begin());
+    EXPECT_EQ(ce.bragg_index(E), n);
+    EXPECT_EQ(ce.xs(E), ce.xs(E, n));
+  }
+}
+
+TEST(STCoherentElastic, SampleAngleEnergy) {
+  const ACE ace = TSL.ace(false, true);
+  const STCoherentElastic ce(ace);
+  const std::vector<double>& edges = ce.bragg_edges();
+  const std::vector<double>& S = ce.structure_factor_sum();
+
+  // Structure factor sums normalized by the last sum, as used for sampling
+  std::vector<double> cdf(S);
+  for (auto& c : cdf) c /= S.back();
+
+  RNGStream rng(47);
+  RNGStream ref_rng(47);
+  for (std::size_t i = 0; i < 20000; i++) {
+    const double E = 1.E-9 * std::pow(5.E3, rng());
+    ref_rng();
+    const std::size_t n = ce.bragg_index(E);
+
+    const AngleEnergyPacket out = ce.sample_angle_energy(E, rng);
+    EXPECT_EQ(out.energy, E);
+    if (n == 0) {
+      EXPECT_EQ(out.cosine_angle, 1.);
+      continue;
+    }
+
+    // The first normalized sum which is not less than xi, found with a
+    // search of all the edges below E.
+    const double xi = ref_rng() * cdf[n - 1];
+    const auto end = cdf.begin() + static_cast<std::ptrdiff_t>(n);
+    const std::size_t Si = static_cast<std::size_t>(
+        std::lower_bound(cdf.begin(), end, xi) - cdf.begin());
+    const double mu = 1. - 2. * edges[std::min(Si, n - 1)] / E;
+    EXPECT_EQ(out.cosine_angle, mu);
+  }
+}
+
+}  // namespace
+}  // namespace pndl
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <PapillonNDL/xs_packet.hpp>
+#include <PapillonNDL/xs_packet_batch.hpp>
+#include <vector>
 
 namespace pndl {
 namespace {
@@ -16,6 +18,7 @@ TEST(XSPacket, Add) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1;
 
@@ -28,6 +31,7 @@ TEST(XSPacket, Add) {
   EXPECT_DOUBLE_EQ(xs3.fission, 2. * xs1.fission);
   EXPECT_DOUBLE_EQ(xs3.capture, 2. * xs1.capture);
   EXPECT_DOUBLE_EQ(xs3.heating, 2. * xs1.heating);
+  EXPECT_DOUBLE_EQ(xs3.nu_fission, 2. * xs1.nu_fission);
 }
 
 TEST(XSPacket, Sub) {
@@ -39,6 +43,7 @@ TEST(XSPacket, Sub) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1;
 
@@ -51,6 +56,7 @@ TEST(XSPacket, Sub) {
   EXPECT_DOUBLE_EQ(xs3.fission, 0.);
   EXPECT_DOUBLE_EQ(xs3.capture, 0.);
   EXPECT_DOUBLE_EQ(xs3.heating, 0.);
+  EXPECT_DOUBLE_EQ(xs3.nu_fission, 0.);
 }
 
 TEST(XSPacket, Mult) {
@@ -62,6 +68,7 @@ TEST(XSPacket, Mult) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1 * 2.;
 
@@ -72,6 +79,7 @@ TEST(XSPacket, Mult) {
   EXPECT_DOUBLE_EQ(xs2.fission, 2. * xs1.fission);
   EXPECT_DOUBLE_EQ(xs2.capture, 2. * xs1.capture);
   EXPECT_DOUBLE_EQ(xs2.heating, 2. * xs1.heating);
+  EXPECT_DOUBLE_EQ(xs2.nu_fission, 2. * xs1.nu_fission);
 
   XSPacket xs3 = 3. * xs1;
 
@@ -82,6 +90,7 @@ TEST(XSPacket, Mult) {
   EXPECT_DOUBLE_EQ(xs3.fission, 3. * xs1.fission);
   EXPECT_DOUBLE_EQ(xs3.capture, 3. * xs1.capture);
   EXPECT_DOUBLE_EQ(xs3.heating, 3. * xs1.heating);
+  EXPECT_DOUBLE_EQ(xs3.nu_fission, 3. * xs1.nu_fission);
 }
 
 TEST(XSPacket, Div) {
@@ -93,6 +102,7 @@ TEST(XSPacket, Div) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1 / 2.;
 
@@ -103,6 +113,7 @@ TEST(XSPacket, Div) {
   EXPECT_DOUBLE_EQ(xs2.fission, 0.5 * xs1.fission);
   EXPECT_DOUBLE_EQ(xs2.capture, 0.5 * xs1.capture);
   EXPECT_DOUBLE_EQ(xs2.heating, 0.5 * xs1.heating);
+  EXPECT_DOUBLE_EQ(xs2.nu_fission, 0.5 * xs1.nu_fission);
 }
 
 TEST(XSPacket, AddAssign) {
@@ -114,6 +125,7 @@ TEST(XSPacket, AddAssign) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1;
 
@@ -126,6 +138,7 @@ TEST(XSPacket, AddAssign) {
   EXPECT_DOUBLE_EQ(xs1.fission, 2. * xs2.fission);
   EXPECT_DOUBLE_EQ(xs1.capture, 2. * xs2.capture);
   EXPECT_DOUBLE_EQ(xs1.heating, 2. * xs2.heating);
+  EXPECT_DOUBLE_EQ(xs1.nu_fission, 2. * xs2.nu_fission);
 }
 
 TEST(XSPacket, SubAssign) {
@@ -137,6 +150,7 @@ TEST(XSPacket, SubAssign) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1;
 
@@ -149,6 +163,7 @@ TEST(XSPacket, SubAssign) {
   EXPECT_DOUBLE_EQ(xs1.fission, 0.);
   EXPECT_DOUBLE_EQ(xs1.capture, 0.);
   EXPECT_DOUBLE_EQ(xs1.heating, 0.);
+  EXPECT_DOUBLE_EQ(xs1.nu_fission, 0.);
 }
 
 TEST(XSPacket, MultAssign) {
@@ -160,6 +175,7 @@ TEST(XSPacket, MultAssign) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1;
   xs2 *= 2.;
@@ -171,6 +187,7 @@ TEST(XSPacket, MultAssign) {
   EXPECT_DOUBLE_EQ(xs2.fission, 2. * xs1.fission);
   EXPECT_DOUBLE_EQ(xs2.capture, 2. * xs1.capture);
   EXPECT_DOUBLE_EQ(xs2.heating, 2. * xs1.heating);
+  EXPECT_DOUBLE_EQ(xs2.nu_fission, 2. * xs1.nu_fission);
 }
 
 TEST(XSPacket, DivAssign) {
@@ -182,6 +199,7 @@ TEST(XSPacket, DivAssign) {
   xs1.fission = 5.;
   xs1.capture = 6.;
   xs1.heating = 7.;
+  xs1.nu_fission = 8.;
 
   XSPacket xs2 = xs1;
   xs2 /= 2.;
@@ -193,6 +211,144 @@ TEST(XSPacket, DivAssign) {
   EXPECT_DOUBLE_EQ(xs2.fission, 0.5 * xs1.fission);
   EXPECT_DOUBLE_EQ(xs2.capture, 0.5 * xs1.capture);
   EXPECT_DOUBLE_EQ(xs2.heating, 0.5 * xs1.heating);
+  EXPECT_DOUBLE_EQ(xs2.nu_fission, 0.5 * xs1.nu_fission);
+}
+
+TEST(XSPacket, Neg) {
+  XSPacket xs1;
+  xs1.total = 1.;
+  xs1.elastic = 2.;
+  xs1.inelastic = 3.;
+  xs1.absorption = 4.;
+  xs1.fission = 5.;
+  xs1.capture = 6.;
+  xs1.heating = 7.;
+  xs1.nu_fission = 8.;
+
+  XSPacket xs2 = -xs1;
+
+  EXPECT_DOUBLE_EQ(xs2.total, -xs1.total);
+  EXPECT_DOUBLE_EQ(xs2.elastic, -xs1.elastic);
+  EXPECT_DOUBLE_EQ(xs2.inelastic, -xs1.inelastic);
+  EXPECT_DOUBLE_EQ(xs2.absorption, -xs1.absorption);
+  EXPECT_DOUBLE_EQ(xs2.fission, -xs1.fission);
+  EXPECT_DOUBLE_EQ(xs2.capture, -xs1.capture);
+  EXPECT_DOUBLE_EQ(xs2.heating, -xs1.heating);
+  EXPECT_DOUBLE_EQ(xs2.nu_fission, -xs1.nu_fission);
+}
+
+//================================================
+// XSPacketBatch Tests
+XSPacket make_packet(double base) {
+  XSPacket xs;
+  xs.total = base + 1.;
+  xs.elastic = base + 2.;
+  xs.inelastic = base + 3.;
+  xs.absorption = base + 4.;
+  xs.fission = base + 5.;
+  xs.capture = base + 6.;
+  xs.heating = base + 7.;
+  xs.nu_fission = base + 8.;
+  return xs;
+}
+
+void expect_packet_eq(const XSPacket& xs1, const XSPacket& xs2) {
+  EXPECT_DOUBLE_EQ(xs1.total, xs2.total);
+  EXPECT_DOUBLE_EQ(xs1.elastic, xs2.elastic);
+  EXPECT_DOUBLE_EQ(xs1.inelastic, xs2.inelastic);
+  EXPECT_DOUBLE_EQ(xs1.absorption, xs2.absorption);
+  EXPECT_DOUBLE_EQ(xs1.fission, xs2.fission);
+  EXPECT_DOUBLE_EQ(xs1.capture, xs2.capture);
+  EXPECT_DOUBLE_EQ(xs1.heating, xs2.heating);
+  EXPECT_DOUBLE_EQ(xs1.nu_fission, xs2.nu_fission);
+}
+
+TEST(XSPacketBatch, SetGet) {
+  XSPacketBatch batch(3);
+  EXPECT_EQ(batch.size(), 3);
+
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    expect_packet_eq(batch.get(i), XSPacket{});
+    batch.set(i, make_packet(10. * static_cast<double>(i)));
+  }
+
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    expect_packet_eq(batch.get(i), make_packet(10. * static_cast<double>(i)));
+  }
+
+  EXPECT_DOUBLE_EQ(batch.total()[1], 11.);
+  EXPECT_DOUBLE_EQ(batch.fission()[2], 25.);
+  EXPECT_DOUBLE_EQ(batch.heating()[0], 7.);
+  EXPECT_DOUBLE_EQ(batch.nu_fission()[1], 18.);
+
+  batch.zero();
+  expect_packet_eq(batch.get(1), XSPacket{});
+}
+
+TEST(XSPacketBatch, AddSub) {
+  XSPacketBatch batch1(2), batch2(2);
+  batch1.set(0, make_packet(0.));
+  batch1.set(1, make_packet(1.));
+  batch2.set(0, make_packet(2.));
+  batch2.set(1, make_packet(3.));
+
+  batch1 += batch2;
+  expect_packet_eq(batch1.get(0), make_packet(0.) + make_packet(2.));
+  expect_packet_eq(batch1.get(1), make_packet(1.) + make_packet(3.));
+
+  batch1 -= batch2;
+  expect_packet_eq(batch1.get(0), make_packet(0.));
+  expect_packet_eq(batch1.get(1), make_packet(1.));
+
+  XSPacketBatch batch3(3);
+  EXPECT_THROW(batch1 += batch3, PNDLException);
+}
+
+TEST(XSPacketBatch, MultDiv) {
+  XSPacketBatch batch(2);
+  batch.set(0, make_packet(0.));
+  batch.set(1, make_packet(1.));
+
+  batch *= 2.;
+  expect_packet_eq(batch.get(0), 2. * make_packet(0.));
+  expect_packet_eq(batch.get(1), 2. * make_packet(1.));
+
+  batch /= 4.;
+  expect_packet_eq(batch.get(0), 0.5 * make_packet(0.));
+  expect_packet_eq(batch.get(1), 0.5 * make_packet(1.));
+}
+
+TEST(XSPacketBatch, Scale) {
+  XSPacketBatch batch(2);
+  batch.set(0, make_packet(0.));
+  batch.set(1, make_packet(1.));
+
+  std::vector<double> factors{3., 0.25};
+  batch.scale(factors);
+  expect_packet_eq(batch.get(0), 3. * make_packet(0.));
+  expect_packet_eq(batch.get(1), 0.25 * make_packet(1.));
+
+  std::vector<double> bad_factors{1., 2., 3.};
+  EXPECT_THROW(batch.scale(bad_factors), PNDLException);
+}
+
+TEST(XSPacketBatch, Accumulate) {
+  XSPacketBatch micro1(2), micro2(2), macro(2);
+  micro1.set(0, make_packet(0.));
+  micro1.set(1, make_packet(1.));
+  micro2.set(0, make_packet(2.));
+  micro2.set(1, make_packet(3.));
+
+  macro.accumulate(micro1, 0.5);
+  macro.accumulate(micro2, 2.);
+  expect_packet_eq(macro.get(0), 0.5 * make_packet(0.) + 2. * make_packet(2.));
+  expect_packet_eq(macro.get(1), 0.5 * make_packet(1.) + 2. * make_packet(3.));
+
+  macro.zero();
+  std::vector<double> densities{0.1, 0.2};
+  macro.accumulate(micro1, densities);
+  expect_packet_eq(macro.get(0), 0.1 * make_packet(0.));
+  expect_packet_eq(macro.get(1), 0.2 * make_packet(1.));
 }
 
 }  // namespace
@@ -246,7 +246,7 @@ int reaction(const std::uint32_t mt, const std::uint64_t nsamples,
   return 0;
 }
 
-enum class ElasticMode { SVT, DBRC };
+enum class ElasticMode { SVT, DBRC, RVS };
 int elastic(ElasticMode mode, const std::uint64_t nsamples, const double Ein,
             const double T, const hid_t h5file, NDArray<double>& data) {
   openmc::settings::res_scat_on = true;
@@ -268,12 +268,17 @@ int elastic(ElasticMode mode, const std::uint64_t nsamples, const double Ein,
   } else if (mode == ElasticMode::DBRC && nuclide.resonant_ == false) {
     std::cerr << " Cannot use DBRC as no 0K elastic xs is provided.";
     return 1;
+  } else if (mode == ElasticMode::RVS && nuclide.resonant_ == false) {
+    std::cerr << " Cannot use RVS as no 0K elastic xs is provided.";
+    return 1;
   }
 
   if (mode == ElasticMode::SVT) {
     openmc::settings::res_scat_method = openmc::ResScatMethod::cxs;
-  } else {
+  } else if (mode == ElasticMode::DBRC) {
     openmc::settings::res_scat_method = openmc::ResScatMethod::dbrc;
+  } else {
+    openmc::settings::res_scat_method = openmc::ResScatMethod::rvs;
   }
 
   // Make the particle which will be used as a template
@@ -377,6 +382,7 @@ const std::string HELP_STR =
     "  sopenmc reaction <mt> <h5file> <nsamples> <energy> <npyfile>\n"
     "  sopenmc elastic-svt <h5file> <nsamples> <energy> <T> <npyfile>\n"
     "  sopenmc elastic-dbrc <h5file> <nsamples> <energy> <T> <npyfile>\n"
+    "  sopenmc elastic-rvs <h5file> <nsamples> <energy> <T> <npyfile>\n"
     "  sopenmc coherent-elastic <h5file> [--temp <tmpgroup>] <nsamples> "
     "<energy> <npyfile>\n"
     "  sopenmc incoherent-elastic <h5file> [--temp <tmpgroup>] <nsamples> "
@@ -397,6 +403,7 @@ enum class RunMode {
   REACTION,
   ELASTIC_SVT,
   ELASTIC_DBRC,
+  ELASTIC_RVS,
   COHERENT_ELASTIC,
   INCOHERENT_ELASTIC,
   INCOHERENT_INELASTIC
@@ -435,6 +442,9 @@ int main(int argc, char** argv) {
   } else if (args["elastic-dbrc"].asBool()) {
     mode = RunMode::ELASTIC_DBRC;
     T = std::stod(args["<T>"].asString());
+  } else if (args["elastic-rvs"].asBool()) {
+    mode = RunMode::ELASTIC_RVS;
+    T = std::stod(args["<T>"].asString());
   } else if (args["coherent-elastic"].asBool()) {
     mode = RunMode::COHERENT_ELASTIC;
   } else if (args["incoherent-elastic"].asBool()) {
@@ -469,6 +479,9 @@ int main(int argc, char** argv) {
     case RunMode::ELASTIC_DBRC:
       std::cout << "Elastic DBRC\n";
       break;
+    case RunMode::ELASTIC_RVS:
+      std::cout << "Elastic RVS\n";
+      break;
     case RunMode::COHERENT_ELASTIC:
       std::cout << "Coherent Elastic\n";
       break;
@@ -483,7 +496,8 @@ int main(int argc, char** argv) {
     std::cout << " MT: " << MT << "\n";
   }
   std::cout << " NSAMPLES: " << NSAMPLES << "\n";
-  if (mode == RunMode::ELASTIC_SVT || mode == RunMode::ELASTIC_DBRC) {
+  if (mode == RunMode::ELASTIC_SVT || mode == RunMode::ELASTIC_DBRC ||
+      mode == RunMode::ELASTIC_RVS) {
     std::cout << " Temperature: " << T << " Kelvin\n";
   }
   std::cout << " Energy: " << E * 1.E-6 << " MeV\n\n";
@@ -498,7 +512,8 @@ int main(int argc, char** argv) {
   }
 
   if (mode != RunMode::REACTION && mode != RunMode::ELASTIC_SVT &&
-      mode != RunMode::ELASTIC_DBRC && E > 4.) {
+      mode != RunMode::ELASTIC_DBRC && mode != RunMode::ELASTIC_RVS &&
+      E > 4.) {
     std::cerr << "\n WARNING: Sampling a thermal scattering law with an energy "
                  "greater than 4 eV.\n";
     std::cerr << "            Results might not be reliable.\n";
@@ -522,6 +537,9 @@ int main(int argc, char** argv) {
       case RunMode::ELASTIC_DBRC:
         result = elastic(ElasticMode::DBRC, NSAMPLES, E, T, h5_file_id, data);
         break;
+      case RunMode::ELASTIC_RVS:
+        result = elastic(ElasticMode::RVS, NSAMPLES, E, T, h5_file_id, data);
+        break;
       case RunMode::COHERENT_ELASTIC:
         result = coherent_elastic(NSAMPLES, E, h5_file_id, temp_group, data);
         break;
@@ -3,11 +3,13 @@
 #include <PapillonNDL/absorption.hpp>
 #include <PapillonNDL/st_neutron.hpp>
 #include <PapillonNDL/elastic_dbrc.hpp>
+#include <PapillonNDL/elastic_rvs.hpp>
 #include <PapillonNDL/st_coherent_elastic.hpp>
 #include <PapillonNDL/st_incoherent_elastic_ace.hpp>
 #include <PapillonNDL/st_incoherent_inelastic.hpp>
 #include <PapillonNDL/st_thermal_scattering_law.hpp>
 #include <PapillonNDL/rng.hpp>
+#include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -49,7 +51,7 @@ int reaction(const std::uint32_t mt, const std::uint64_t nsamples,
   return 0;
 }
 
-enum class ElasticMode { SVT, DBRC };
+enum class ElasticMode { SVT, DBRC, RVS };
 int elastic(const ElasticMode mode, const std::uint64_t nsamples,
             const double Ein, const double T, const pndl::ACE& ace,
             NDArray<double>& data) {
@@ -61,6 +63,10 @@ int elastic(const ElasticMode mode, const std::uint64_t nsamples,
     nuclide.elastic().set_use_tar(false);
     nuclide.elastic().set_elastic_doppler_broadener(
         std::make_shared<pndl::ElasticDBRC>(nuclide.elastic_xs()));
+  } else if (mode == ElasticMode::RVS) {
+    nuclide.elastic().set_use_tar(false);
+    nuclide.elastic().set_elastic_doppler_broadener(
+        std::make_shared<pndl::ElasticRVS>(nuclide.elastic_xs()));
   }
 
   // Get all samples
@@ -134,6 +140,7 @@ const std::string HELP_STR =
     "  spndl reaction <mt> <acefile> <nsamples> <energy> <npyfile>\n"
     "  spndl elastic-svt <acefile> <nsamples> <energy> <T> <npyfile>\n"
     "  spndl elastic-dbrc <acefile> <nsamples> <energy> <T> <npyfile>\n"
+    "  spndl elastic-rvs <acefile> <nsamples> <energy> <T> <npyfile>\n"
     "  spndl coherent-elastic <acefile> <nsamples> <energy> <npyfile>\n"
     "  spndl incoherent-elastic <acefile> <nsamples> <energy> <npyfile>\n"
     "  spndl incoherent-inelastic <acefile> <nsamples> <energy> <npyfile>\n\n"
@@ -150,6 +157,7 @@ enum class RunMode {
   REACTION,
   ELASTIC_SVT,
   ELASTIC_DBRC,
+  ELASTIC_RVS,
   COHERENT_ELASTIC,
   INCOHERENT_ELASTIC,
   INCOHERENT_INELASTIC
@@ -184,6 +192,9 @@ int main(int argc, char** argv) {
   } else if (args["elastic-dbrc"].asBool()) {
     mode = RunMode::ELASTIC_DBRC;
     T = std::stod(args["<T>"].asString());
+  } else if (args["elastic-rvs"].asBool()) {
+    mode = RunMode::ELASTIC_RVS;
+    T = std::stod(args["<T>"].asString());
   } else if (args["coherent-elastic"].asBool()) {
     mode = RunMode::COHERENT_ELASTIC;
   } else if (args["incoherent-elastic"].asBool()) {
@@ -218,6 +229,9 @@ int main(int argc, char** argv) {
     case RunMode::ELASTIC_DBRC:
       std::cout << "Elastic DBRC\n";
       break;
+    case RunMode::ELASTIC_RVS:
+      std::cout << "Elastic RVS\n";
+      break;
     case RunMode::COHERENT_ELASTIC:
       std::cout << "Coherent Elastic\n";
       break;
@@ -232,7 +246,8 @@ int main(int argc, char** argv) {
     std::cout << " MT: " << MT << "\n";
   }
   std::cout << " NSAMPLES: " << NSAMPLES << "\n";
-  if (mode == RunMode::ELASTIC_SVT || mode == RunMode::ELASTIC_DBRC) {
+  if (mode == RunMode::ELASTIC_SVT || mode == RunMode::ELASTIC_DBRC ||
+      mode == RunMode::ELASTIC_RVS) {
     std::cout << " Temperature: " << T << " Kelvin\n";
   }
   std::cout << " Energy: " << E << " MeV\n\n";
@@ -247,6 +262,10 @@ int main(int argc, char** argv) {
     std::cerr << "\n WARNING: Sampling Elastic DBRC without 0K elastic xs.\n";
   }
 
+  if (ace.temperature() > 1. && mode == RunMode::ELASTIC_RVS) {
+    std::cerr << "\n WARNING: Sampling Elastic RVS without 0K elastic xs.\n";
+  }
+
   if (mode == RunMode::ELASTIC_SVT &&
       E >= (400. * (8.617333262E-5) * T * 1.E-6)) {
     std::cerr << "\n WARNING: Asked for SVT, but E > 400 kT. Asymptotic "
@@ -255,6 +274,7 @@ int main(int argc, char** argv) {
 
   // Get Samples
   int result = 0;
+  const auto start = std::chrono::steady_clock::now();
   try {
     switch (mode) {
       case RunMode::REACTION:
@@ -266,6 +286,9 @@ int main(int argc, char** argv) {
       case RunMode::ELASTIC_DBRC:
         result = elastic(ElasticMode::DBRC, NSAMPLES, E, T, ace, data);
         break;
+      case RunMode::ELASTIC_RVS:
+        result = elastic(ElasticMode::RVS, NSAMPLES, E, T, ace, data);
+        break;
       case RunMode::COHERENT_ELASTIC:
         result = coherent_elastic(NSAMPLES, E, ace, data);
         break;
@@ -285,12 +308,18 @@ int main(int argc, char** argv) {
                  "========\n";
     return 1;
   }
+  const std::chrono::duration<double> sampling_time =
+      std::chrono::steady_clock::now() - start;
 
   if (result != 0) {
     std::cout << "\n\n !!! ERROR !!!\n\n";
     std::cout << " Could not generate samples.\n";
   } else {
     std::cout << " Sampling suceeded !\n";
+    std::cout << " Sampling Time: " << sampling_time.count() << " s\n";
+    std::cout << " Sampling Rate: "
+              << static_cast<double>(NSAMPLES) / sampling_time.count()
+              << " samples/s\n";
     data.save(npy_file);
     std::cout << " NPY File: " << npy_file << "\n";
   }